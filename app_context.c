@@ -44,6 +44,11 @@ device_t *bt_context_get_devices(void)
     return ctx.bt->devices;
 }
 
+device_t *bt_context_find_device(const char *mac)
+{
+    return bt_find_device(mac);
+}
+
 const device_t *bt_context_get_selected(void)
 {
     if (ctx.bt->selected.mac[0] == '\0')
@@ -69,13 +74,17 @@ void bt_context_clear_devices(void)
     memset(&ctx.bt->selected, 0, sizeof(ctx.bt->selected));
 }
 
-void bt_context_add_device(device_t *device)
+/*
+ * Inserts `device` or merges it into the entry with the same MAC.
+ * Returns true only when a new entry was created.
+ */
+bool bt_context_add_device(device_t *device)
 {
     if (device == NULL)
-        return;
+        return false;
 
     if (device->mac[0] == '\0')
-        return;
+        return false;
 
     bt_context_t *bt = ctx.bt;
     device_t *dev_found = bt_find_device(device->mac);
@@ -96,13 +105,25 @@ void bt_context_add_device(device_t *device)
         if (device->appearance[0] && strcmp(dev_found->appearance, UNKNOWN_NAME) == 0)
             snprintf(dev_found->appearance, sizeof(dev_found->appearance), "%s", device->appearance);
 
-        return;
+        // Advertising and scan response arrive in separate reports; keep the latest of each.
+        if (device->adv_len)
+        {
+            memcpy(dev_found->adv_data, device->adv_data, device->adv_len);
+            dev_found->adv_len = device->adv_len;
+        }
+        if (device->scan_rsp_len)
+        {
+            memcpy(dev_found->scan_rsp, device->scan_rsp, device->scan_rsp_len);
+            dev_found->scan_rsp_len = device->scan_rsp_len;
+        }
+
+        return false;
     }
 
     if (bt->current_device_amount >= BT_ALLOWED_MAX_DEVICES)
     {
         log_info("Can't save more devices, is in the limit of %d", BT_ALLOWED_MAX_DEVICES);
-        return;
+        return false;
     }
 
     dev_found = &bt->devices[bt->current_device_amount++];
@@ -124,4 +145,11 @@ void bt_context_add_device(device_t *device)
 
     snprintf(dev_found->appearance, sizeof(dev_found->appearance), "%s",
              device->appearance[0] ? device->appearance : UNKNOWN_NAME);
+
+    memcpy(dev_found->adv_data, device->adv_data, device->adv_len);
+    dev_found->adv_len = device->adv_len;
+    memcpy(dev_found->scan_rsp, device->scan_rsp, device->scan_rsp_len);
+    dev_found->scan_rsp_len = device->scan_rsp_len;
+
+    return true;
 }
\ No newline at end of file
@@ -1,6 +1,7 @@
 #ifndef APP_CONTEXT_H
 #define APP_CONTEXT_H
 
+#include <stdbool.h>
 #include <stdio.h>
 #include "types.h"
 
@@ -15,9 +16,10 @@ typedef struct {
 
 app_context_t *app_context_get();
 
-void bt_context_add_device(device_t *device);
+bool bt_context_add_device(device_t *device);
 void bt_context_clear_devices(void);
 device_t *bt_context_get_devices(void);
+device_t *bt_context_find_device(const char *mac);
 void bt_context_set_selected(const device_t *device);
 const device_t *bt_context_get_selected(void);
 int bt_context_devices_length(void);
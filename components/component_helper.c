@@ -2,6 +2,8 @@
 #include "components/ui_theme.h"
 
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 
 #define ICON_IDENTIFYER 100
 
@@ -140,3 +142,92 @@ lv_obj_t *create_btn(lv_obj_t *parent, const char *text, int width, int height)
 
     return btn;
 }
+
+/*
+ * LVGL 9 has no call to drop a single dropdown option, so both helpers
+ * rebuild the "\n" separated list and keep the selected option selected.
+ */
+static bool dropdown_rebuild(lv_obj_t *dd, const char *insert, const char *remove)
+{
+    const char *opts = lv_dropdown_get_options(dd);
+    size_t len = strlen(opts);
+    char *out = (char *)malloc(len + (insert ? strlen(insert) + 2 : 1));
+    if (!out)
+        return false;
+
+    char selected[128];
+    lv_dropdown_get_selected_str(dd, selected, sizeof(selected));
+
+    bool changed = false;
+    int index = 0;
+    int new_selected = -1;
+    size_t pos = 0;
+    const char *line = opts;
+    while (len > 0 && line)
+    {
+        const char *end = strchr(line, '\n');
+        size_t line_len = end ? (size_t)(end - line) : strlen(line);
+
+        if (insert && !changed)
+        {
+            size_t insert_len = strlen(insert);
+            int cmp = strncmp(line, insert, line_len < insert_len ? line_len : insert_len);
+            if (cmp == 0 && line_len == insert_len)
+            {
+                free(out);
+                return false;
+            }
+            if (cmp > 0 || (cmp == 0 && line_len > insert_len))
+            {
+                pos += (size_t)sprintf(out + pos, "%s%s", pos ? "\n" : "", insert);
+                index++;
+                changed = true;
+            }
+        }
+
+        bool drop = remove && strlen(remove) == line_len && strncmp(line, remove, line_len) == 0;
+        if (drop)
+            changed = true;
+        else
+        {
+            if (strlen(selected) == line_len && strncmp(line, selected, line_len) == 0)
+                new_selected = index;
+            pos += (size_t)sprintf(out + pos, "%s%.*s", pos ? "\n" : "", (int)line_len, line);
+            index++;
+        }
+
+        line = end ? end + 1 : NULL;
+    }
+
+    if (insert && !changed)
+    {
+        pos += (size_t)sprintf(out + pos, "%s%s", pos ? "\n" : "", insert);
+        changed = true;
+    }
+    out[pos] = '\0';
+
+    if (changed)
+    {
+        lv_dropdown_set_options(dd, out);
+        lv_dropdown_set_selected(dd, new_selected >= 0 ? (uint32_t)new_selected : 0);
+    }
+
+    free(out);
+    return changed;
+}
+
+bool dropdown_insert_sorted(lv_obj_t *dd, const char *option)
+{
+    if (!dd || !option || !option[0])
+        return false;
+
+    return dropdown_rebuild(dd, option, NULL);
+}
+
+bool dropdown_remove_option(lv_obj_t *dd, const char *option)
+{
+    if (!dd || !option || !option[0])
+        return false;
+
+    return dropdown_rebuild(dd, NULL, option);
+}
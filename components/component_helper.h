@@ -17,6 +17,10 @@ lv_obj_t *create_transparent_flex_row(lv_obj_t *parent, lv_coord_t width, lv_coo
 
 void rotate_icon_by_tag(lv_obj_t * btn, int32_t angle);
 
+// Patch a dropdown holding sorted options; false when nothing changed.
+bool dropdown_insert_sorted(lv_obj_t *dd, const char *option);
+bool dropdown_remove_option(lv_obj_t *dd, const char *option);
+
 #ifdef __cplusplus
 }
 #endif
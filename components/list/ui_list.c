@@ -77,6 +77,11 @@ static void on_item_delete(lv_event_t *e)
     }
 }
 
+static void on_list_delete(lv_event_t *e)
+{
+    free(lv_event_get_user_data(e));
+}
+
 ui_list *create_list(lv_obj_t *parent, int width, int height)
 {
     ui_list *list = (ui_list *)malloc(sizeof(ui_list));
@@ -105,6 +110,9 @@ ui_list *create_list(lv_obj_t *parent, int width, int height)
     list->item_count = 0;
     list->cb = NULL;
 
+    // Freed with its object, so lists inside a deleted page don't leak.
+    lv_obj_add_event_cb(list_obj, on_list_delete, LV_EVENT_DELETE, list);
+
     return list;
 }
 
@@ -159,6 +167,7 @@ lv_obj_t *add_item(ui_list *list, const list_item_t *item)
 
     lv_obj_add_event_cb(btn, on_item_click, LV_EVENT_CLICKED, ctx);
     lv_obj_add_event_cb(btn, on_item_delete, LV_EVENT_DELETE, ctx);
+    lv_obj_set_user_data(btn, ctx);
 
     lv_obj_set_style_bg_color(btn, ZV_COLOR_BG_CARD, LV_STATE_DEFAULT);
     lv_obj_set_style_bg_color(btn, ZV_COLOR_BG_PRESSED, LV_STATE_PRESSED);
@@ -270,6 +279,34 @@ lv_obj_t *add_item(ui_list *list, const list_item_t *item)
     return btn;
 }
 
+lv_obj_t *find_item(ui_list *list, const char *raw_value)
+{
+    if (!list || !list->list || !raw_value)
+        return NULL;
+
+    uint32_t count = lv_obj_get_child_count(list->list);
+    for (uint32_t i = 0; i < count; i++)
+    {
+        lv_obj_t *btn = lv_obj_get_child(list->list, (int32_t)i);
+        const ui_list_item_ctx_t *ctx = (const ui_list_item_ctx_t *)lv_obj_get_user_data(btn);
+        if (ctx && ctx->raw_value_buf && strcmp(ctx->raw_value_buf, raw_value) == 0)
+            return btn;
+    }
+
+    return NULL;
+}
+
+bool remove_item(ui_list *list, const char *raw_value)
+{
+    lv_obj_t *btn = find_item(list, raw_value);
+    if (!btn)
+        return false;
+
+    lv_obj_del(btn);
+    list->item_count -= 1;
+    return true;
+}
+
 void set_event_data(ui_list *list, ui_list_item_event_cb_t cb, void *user_data)
 {
     list->user_data = user_data;
@@ -309,6 +346,6 @@ void clean_list(ui_list *list)
 
 void destroy_list(ui_list *list)
 {
-    clean_list(list);
-    free(list);
+    if (list)
+        lv_obj_del(list->list);
 }
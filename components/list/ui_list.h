@@ -49,6 +49,9 @@ typedef void (*ui_list_item_event_cb_t)(ui_list *list, const list_item_t *item,
 
 ui_list *create_list(lv_obj_t *parent, int width, int height);
 lv_obj_t *add_item(ui_list *list, const list_item_t *item);
+// Items are matched on raw_value, so only lists that set it can be patched in place.
+lv_obj_t *find_item(ui_list *list, const char *raw_value);
+bool remove_item(ui_list *list, const char *raw_value);
 void set_event_data(ui_list *list, ui_list_item_event_cb_t cb, void *user_data);
 void set_list_border(ui_list *list, bool enabled);
 void set_list_bg_color(ui_list *list, lv_color_t color);
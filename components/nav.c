@@ -1,7 +1,38 @@
 #include "components/nav.h"
 
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * Objects of one subtree (a menu page or the header) that can ever take
+ * focus, in tree order. Built by walking the subtree once and rebuilt only
+ * after something under it is created, deleted or moved; hidden and
+ * disabled objects are filtered when the group is filled, so toggling them
+ * does not need a rebuild.
+ */
+typedef struct {
+    lv_obj_t *root;
+    lv_obj_t **objs;
+    uint32_t count;
+    uint32_t capacity;
+    bool dirty;
+} focus_cache;
+
 static lv_group_t *g_nav_group = NULL;
 
+static focus_cache *g_caches = NULL;
+static size_t g_cache_count = 0;
+static size_t g_cache_capacity = 0;
+
+// What the group holds right now, to skip refilling it for the same page.
+static lv_obj_t *g_shown_page = NULL;
+static bool g_shown_stale = true;
+
+static bool obj_is_candidate(lv_obj_t *obj)
+{
+    return lv_obj_has_flag(obj, LV_OBJ_FLAG_CLICKABLE) || lv_obj_is_editable(obj);
+}
+
 static bool obj_is_focusable(lv_obj_t *obj)
 {
     if (!obj || !lv_obj_is_valid(obj))
@@ -10,11 +41,102 @@ static bool obj_is_focusable(lv_obj_t *obj)
         return false;
     if (lv_obj_has_state(obj, LV_STATE_DISABLED))
         return false;
-    if (lv_obj_has_flag(obj, LV_OBJ_FLAG_CLICKABLE))
-        return true;
-    if (lv_obj_is_editable(obj))
-        return true;
-    return false;
+    return true;
+}
+
+static focus_cache *find_cache(lv_obj_t *root)
+{
+    for (size_t i = 0; i < g_cache_count; i++) {
+        if (g_caches[i].root == root)
+            return &g_caches[i];
+    }
+    return NULL;
+}
+
+static void on_tree_changed(lv_event_t *e)
+{
+    lv_obj_t *root = (lv_obj_t *)lv_event_get_user_data(e);
+    focus_cache *cache = find_cache(root);
+    if (!cache)
+        return;
+
+    cache->dirty = true;
+    if (root == g_shown_page)
+        g_shown_stale = true;
+}
+
+static void on_root_deleted(lv_event_t *e)
+{
+    lv_obj_t *root = (lv_obj_t *)lv_event_get_user_data(e);
+    focus_cache *cache = find_cache(root);
+    if (!cache)
+        return;
+
+    free(cache->objs);
+    *cache = g_caches[--g_cache_count];
+
+    if (root == g_shown_page) {
+        g_shown_page = NULL;
+        g_shown_stale = true;
+    }
+}
+
+static focus_cache *get_cache(lv_obj_t *root)
+{
+    focus_cache *cache = find_cache(root);
+    if (cache)
+        return cache;
+
+    if (g_cache_count == g_cache_capacity) {
+        size_t new_capacity = g_cache_capacity ? g_cache_capacity * 2 : 8;
+        focus_cache *grown = (focus_cache *)realloc(g_caches, new_capacity * sizeof(focus_cache));
+        if (!grown)
+            return NULL;
+
+        g_caches = grown;
+        g_cache_capacity = new_capacity;
+    }
+
+    cache = &g_caches[g_cache_count++];
+    memset(cache, 0, sizeof(*cache));
+    cache->root = root;
+    cache->dirty = true;
+
+    lv_obj_add_event_cb(root, on_root_deleted, LV_EVENT_DELETE, root);
+    return cache;
+}
+
+static void cache_push(focus_cache *cache, lv_obj_t *obj)
+{
+    if (cache->count == cache->capacity) {
+        uint32_t new_capacity = cache->capacity ? cache->capacity * 2 : 16;
+        lv_obj_t **grown = (lv_obj_t **)realloc(cache->objs, new_capacity * sizeof(lv_obj_t *));
+        if (!grown)
+            return;
+
+        cache->objs = grown;
+        cache->capacity = new_capacity;
+    }
+
+    cache->objs[cache->count++] = obj;
+}
+
+/*
+ * Every object under the root reports child changes back to it. Objects
+ * that appear later are covered by their parent's report and get their own
+ * hook on the next rebuild.
+ */
+static void collect_candidates(focus_cache *cache, lv_obj_t *obj)
+{
+    lv_obj_remove_event_cb_with_user_data(obj, on_tree_changed, cache->root);
+    lv_obj_add_event_cb(obj, on_tree_changed, LV_EVENT_CHILD_CHANGED, cache->root);
+
+    if (obj_is_candidate(obj))
+        cache_push(cache, obj);
+
+    uint32_t n = lv_obj_get_child_count(obj);
+    for (uint32_t i = 0; i < n; i++)
+        collect_candidates(cache, lv_obj_get_child(obj, i));
 }
 
 static void group_add_focusables(lv_group_t *group, lv_obj_t *root)
@@ -22,19 +144,27 @@ static void group_add_focusables(lv_group_t *group, lv_obj_t *root)
     if (!group || !root)
         return;
 
-    if (obj_is_focusable(root))
-        lv_group_add_obj(group, root);
+    focus_cache *cache = get_cache(root);
+    if (!cache)
+        return;
+
+    if (cache->dirty) {
+        cache->count = 0;
+        collect_candidates(cache, root);
+        cache->dirty = false;
+    }
 
-    uint32_t n = lv_obj_get_child_count(root);
-    for (uint32_t i = 0; i < n; i++) {
-        lv_obj_t *child = lv_obj_get_child(root, i);
-        group_add_focusables(group, child);
+    for (uint32_t i = 0; i < cache->count; i++) {
+        if (obj_is_focusable(cache->objs[i]))
+            lv_group_add_obj(group, cache->objs[i]);
     }
 }
 
 void zv_nav_set_group(lv_group_t *group)
 {
     g_nav_group = group;
+    g_shown_page = NULL;
+    g_shown_stale = true;
 }
 
 void zv_nav_update_group(lv_obj_t *menu, lv_obj_t *page)
@@ -42,6 +172,10 @@ void zv_nav_update_group(lv_obj_t *menu, lv_obj_t *page)
     if (!g_nav_group || !page)
         return;
 
+    // The page-change event usually got here first; don't refill for nothing.
+    if (page == g_shown_page && !g_shown_stale)
+        return;
+
     lv_group_remove_all_objs(g_nav_group);
 
     if (menu) {
@@ -55,6 +189,21 @@ void zv_nav_update_group(lv_obj_t *menu, lv_obj_t *page)
     lv_obj_t *first = lv_group_get_obj_by_index(g_nav_group, 0);
     if (first)
         lv_group_focus_obj(first);
+
+    g_shown_page = page;
+    g_shown_stale = false;
+}
+
+static void on_menu_page_changed(lv_event_t *e)
+{
+    lv_obj_t *menu = (lv_obj_t *)lv_event_get_target(e);
+    zv_nav_update_group(menu, lv_menu_get_cur_main_page(menu));
+}
+
+void zv_nav_attach_menu(lv_obj_t *menu)
+{
+    if (menu)
+        lv_obj_add_event_cb(menu, on_menu_page_changed, LV_EVENT_VALUE_CHANGED, NULL);
 }
 
 void zv_goto_page_cb(lv_event_t *e)
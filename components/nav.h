@@ -16,6 +16,9 @@ void zv_goto_page_cb(lv_event_t *e);
 void zv_nav_set_group(lv_group_t *group);
 void zv_nav_update_group(lv_obj_t *menu, lv_obj_t *page);
 
+// Refills the group from the menu's page-change event instead of polling.
+void zv_nav_attach_menu(lv_obj_t *menu);
+
 #ifdef __cplusplus
 }
 #endif
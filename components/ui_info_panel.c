@@ -98,10 +98,10 @@ void add_info_panel_item(ui_info_panel *panel, kv_item_t item)
         lv_obj_set_style_text_color(value, ZV_COLOR_TEXT_MAIN, 0);
 }
 
-void add_info_panel_header(ui_info_panel *panel, const char *text, lv_color_t color)
+lv_obj_t *add_info_panel_header(ui_info_panel *panel, const char *text, lv_color_t color)
 {
     if (!panel || !panel->main_layout || !text)
-        return;
+        return NULL;
 
     apply_divider_to_prev(panel);
 
@@ -119,6 +119,7 @@ void add_info_panel_header(ui_info_panel *panel, const char *text, lv_color_t co
     lv_obj_set_style_text_font(lb, &lv_font_montserrat_12, 0);
 
     panel->item_count += 1;
+    return lb;
 }
 
 lv_obj_t *add_info_panel_custom_row(ui_info_panel *panel, const char *label)
@@ -19,7 +19,8 @@ typedef struct ui_info_panel ui_info_panel;
 
 ui_info_panel *create_info_panel(lv_obj_t *parent, int width, int height);
 void add_info_panel_item(ui_info_panel *panel, kv_item_t item);
-void add_info_panel_header(ui_info_panel *panel, const char *text, lv_color_t color);
+// Returns the header label, for callers that relabel it later.
+lv_obj_t *add_info_panel_header(ui_info_panel *panel, const char *text, lv_color_t color);
 lv_obj_t *add_info_panel_custom_row(ui_info_panel *panel, const char *label);
 
 void clear_info_panel(ui_info_panel *panel);
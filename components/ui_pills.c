@@ -67,6 +67,16 @@ static void on_pill_delete(lv_event_t *e)
     free(ctx);
 }
 
+// The struct goes with its container, so pills inside a deleted page don't leak.
+static void on_container_delete(lv_event_t *e)
+{
+    ui_pills *pills = (ui_pills *)lv_event_get_user_data(e);
+    for (int i = 0; i < pills->count; i++)
+        free(pills->labels[i]);
+
+    free(pills);
+}
+
 ui_pills *create_pills_sized(lv_obj_t *parent, int container_width, int pill_height)
 {
     ui_pills *p = (ui_pills *)calloc(1, sizeof(ui_pills));
@@ -84,6 +94,7 @@ ui_pills *create_pills_sized(lv_obj_t *parent, int container_width, int pill_hei
     lv_obj_set_style_pad_column(p->container, 4, 0);
     lv_obj_set_style_pad_row(p->container, 4, 0);
     lv_obj_clear_flag(p->container, LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_add_event_cb(p->container, on_container_delete, LV_EVENT_DELETE, p);
 
     return p;
 }
@@ -211,9 +222,6 @@ void destroy_pills(ui_pills *pills)
     if (!pills)
         return;
 
-    pills_clear(pills);
-    if (pills->container)
-        lv_obj_del(pills->container);
-
-    free(pills);
+    // on_container_delete frees the labels and the struct.
+    lv_obj_del(pills->container);
 }
@@ -18,13 +18,35 @@ void config_set_defaults(void)
     _config.hid.selected_file[0] = '\0';
     _config.hid.is_enabled = false;
     _config.ir.remotes_path[0] = '\0';
+    snprintf(_config.ir.import_path, sizeof(_config.ir.import_path), "%s", "data/ir/import/");
+    snprintf(_config.ir.macros_path, sizeof(_config.ir.macros_path), "%s", "data/ir/macros/");
     snprintf(_config.ir.backend, sizeof(_config.ir.backend), "%s", "irctl");
     snprintf(_config.ir.tx_device, sizeof(_config.ir.tx_device), "%s", "/dev/lirc0");
     snprintf(_config.ir.rx_device, sizeof(_config.ir.rx_device), "%s", "/dev/lirc1");
     _config.ir.learn_timeout_ms = 5000;
+    _config.ir.carrier_hz = 38000;
+    _config.ir.duty_cycle = 33;
+    _config.ir.learn_presses = 3;
     _config.ir.use_on_screen_keyboard = true;
 
     snprintf(_config.display.fb_device, sizeof(_config.display.fb_device), "%s", "/dev/fb0");
+    _config.display.page_cache_max = 2;
+    _config.display.page_idle_timeout_s = 300;
+
+    snprintf(_config.bt.gatt_cache_path, sizeof(_config.bt.gatt_cache_path), "%s", "data/bt/gatt_cache/");
+    _config.bt.raw_advertising = true;
+    snprintf(_config.bt.scan_log_path, sizeof(_config.bt.scan_log_path), "%s", "data/bt/scan_log/");
+    _config.bt.scan_log_max_mb = 32;
+    _config.bt.continuous_scan = false;
+    _config.bt.scan_interval_ms = 100;
+    _config.bt.scan_window_ms = 50;
+    _config.bt.scan_budget_backlog = 2048;
+    _config.bt.scan_budget_cpu_pct = 60;
+    _config.bt.link_tune_on_connect = false;
+    _config.bt.link_mtu = 247;
+    _config.bt.link_data_length = 251;
+    _config.bt.link_interval_ms = 15;
+    _config.bt.link_timeout_ms = 4000;
 
     snprintf(_config.uart.device, sizeof(_config.uart.device), "%s", "/dev/ttyAMA5");
     _config.uart.baudrate = 115200;
@@ -103,14 +125,37 @@ static cJSON *cfg_to_json(void)
 
     cJSON *ir = cJSON_AddObjectToObject(root, "ir");
     cJSON_AddStringToObject(ir, "remotes_path", strip_project_root(_config.ir.remotes_path));
+    cJSON_AddStringToObject(ir, "import_path", strip_project_root(_config.ir.import_path));
+    cJSON_AddStringToObject(ir, "macros_path", strip_project_root(_config.ir.macros_path));
     cJSON_AddStringToObject(ir, "backend", _config.ir.backend);
     cJSON_AddStringToObject(ir, "tx_device", _config.ir.tx_device);
     cJSON_AddStringToObject(ir, "rx_device", _config.ir.rx_device);
     cJSON_AddNumberToObject(ir, "learn_timeout_ms", _config.ir.learn_timeout_ms);
+    cJSON_AddNumberToObject(ir, "carrier_hz", _config.ir.carrier_hz);
+    cJSON_AddNumberToObject(ir, "duty_cycle", _config.ir.duty_cycle);
+    cJSON_AddNumberToObject(ir, "learn_presses", _config.ir.learn_presses);
     cJSON_AddBoolToObject(ir, "use_on_screen_keyboard", _config.ir.use_on_screen_keyboard);
 
     cJSON *display = cJSON_AddObjectToObject(root, "display");
     cJSON_AddStringToObject(display, "fb_device", _config.display.fb_device);
+    cJSON_AddNumberToObject(display, "page_cache_max", _config.display.page_cache_max);
+    cJSON_AddNumberToObject(display, "page_idle_timeout_s", _config.display.page_idle_timeout_s);
+
+    cJSON *bt = cJSON_AddObjectToObject(root, "bt");
+    cJSON_AddStringToObject(bt, "gatt_cache_path", strip_project_root(_config.bt.gatt_cache_path));
+    cJSON_AddBoolToObject(bt, "raw_advertising", _config.bt.raw_advertising);
+    cJSON_AddStringToObject(bt, "scan_log_path", strip_project_root(_config.bt.scan_log_path));
+    cJSON_AddNumberToObject(bt, "scan_log_max_mb", _config.bt.scan_log_max_mb);
+    cJSON_AddBoolToObject(bt, "continuous_scan", _config.bt.continuous_scan);
+    cJSON_AddNumberToObject(bt, "scan_interval_ms", _config.bt.scan_interval_ms);
+    cJSON_AddNumberToObject(bt, "scan_window_ms", _config.bt.scan_window_ms);
+    cJSON_AddNumberToObject(bt, "scan_budget_backlog", _config.bt.scan_budget_backlog);
+    cJSON_AddNumberToObject(bt, "scan_budget_cpu_pct", _config.bt.scan_budget_cpu_pct);
+    cJSON_AddBoolToObject(bt, "link_tune_on_connect", _config.bt.link_tune_on_connect);
+    cJSON_AddNumberToObject(bt, "link_mtu", _config.bt.link_mtu);
+    cJSON_AddNumberToObject(bt, "link_data_length", _config.bt.link_data_length);
+    cJSON_AddNumberToObject(bt, "link_interval_ms", _config.bt.link_interval_ms);
+    cJSON_AddNumberToObject(bt, "link_timeout_ms", _config.bt.link_timeout_ms);
 
     cJSON *uart = cJSON_AddObjectToObject(root, "uart");
     cJSON_AddStringToObject(uart, "device", _config.uart.device);
@@ -143,6 +188,10 @@ static void json_to_cfg(cJSON *root)
     {
         json_get_string(ir, "remotes_path", _config.ir.remotes_path, _config.ir.remotes_path,
             sizeof(_config.ir.remotes_path));
+        json_get_string(ir, "import_path", _config.ir.import_path, _config.ir.import_path,
+            sizeof(_config.ir.import_path));
+        json_get_string(ir, "macros_path", _config.ir.macros_path, _config.ir.macros_path,
+            sizeof(_config.ir.macros_path));
         json_get_string(ir, "backend", _config.ir.backend, _config.ir.backend,
             sizeof(_config.ir.backend));
         json_get_string(ir, "tx_device", _config.ir.tx_device, _config.ir.tx_device,
@@ -150,6 +199,9 @@ static void json_to_cfg(cJSON *root)
         json_get_string(ir, "rx_device", _config.ir.rx_device, _config.ir.rx_device,
             sizeof(_config.ir.rx_device));
         _config.ir.learn_timeout_ms = json_get_int(ir, "learn_timeout_ms", _config.ir.learn_timeout_ms);
+        _config.ir.carrier_hz = json_get_int(ir, "carrier_hz", _config.ir.carrier_hz);
+        _config.ir.duty_cycle = json_get_int(ir, "duty_cycle", _config.ir.duty_cycle);
+        _config.ir.learn_presses = json_get_int(ir, "learn_presses", _config.ir.learn_presses);
         _config.ir.use_on_screen_keyboard =
             json_get_bool(ir, "use_on_screen_keyboard", _config.ir.use_on_screen_keyboard);
     }
@@ -159,6 +211,31 @@ static void json_to_cfg(cJSON *root)
     {
         json_get_string(display, "fb_device", _config.display.fb_device,
             _config.display.fb_device, sizeof(_config.display.fb_device));
+        _config.display.page_cache_max =
+            json_get_int(display, "page_cache_max", _config.display.page_cache_max);
+        _config.display.page_idle_timeout_s =
+            json_get_int(display, "page_idle_timeout_s", _config.display.page_idle_timeout_s);
+    }
+
+    cJSON *bt = cJSON_GetObjectItemCaseSensitive(root, "bt");
+    if (cJSON_IsObject(bt))
+    {
+        json_get_string(bt, "gatt_cache_path", _config.bt.gatt_cache_path,
+            _config.bt.gatt_cache_path, sizeof(_config.bt.gatt_cache_path));
+        _config.bt.raw_advertising = json_get_bool(bt, "raw_advertising", _config.bt.raw_advertising);
+        json_get_string(bt, "scan_log_path", _config.bt.scan_log_path,
+            _config.bt.scan_log_path, sizeof(_config.bt.scan_log_path));
+        _config.bt.scan_log_max_mb = json_get_int(bt, "scan_log_max_mb", _config.bt.scan_log_max_mb);
+        _config.bt.continuous_scan = json_get_bool(bt, "continuous_scan", _config.bt.continuous_scan);
+        _config.bt.scan_interval_ms = json_get_int(bt, "scan_interval_ms", _config.bt.scan_interval_ms);
+        _config.bt.scan_window_ms = json_get_int(bt, "scan_window_ms", _config.bt.scan_window_ms);
+        _config.bt.scan_budget_backlog = json_get_int(bt, "scan_budget_backlog", _config.bt.scan_budget_backlog);
+        _config.bt.scan_budget_cpu_pct = json_get_int(bt, "scan_budget_cpu_pct", _config.bt.scan_budget_cpu_pct);
+        _config.bt.link_tune_on_connect = json_get_bool(bt, "link_tune_on_connect", _config.bt.link_tune_on_connect);
+        _config.bt.link_mtu = json_get_int(bt, "link_mtu", _config.bt.link_mtu);
+        _config.bt.link_data_length = json_get_int(bt, "link_data_length", _config.bt.link_data_length);
+        _config.bt.link_interval_ms = json_get_int(bt, "link_interval_ms", _config.bt.link_interval_ms);
+        _config.bt.link_timeout_ms = json_get_int(bt, "link_timeout_ms", _config.bt.link_timeout_ms);
     }
 
     cJSON *uart = cJSON_GetObjectItemCaseSensitive(root, "uart");
@@ -246,11 +323,35 @@ void config_resolve_paths(const char *root)
         snprintf(_config.ir.remotes_path, sizeof(_config.ir.remotes_path), "%s", tmp);
     }
 
+    if (_config.ir.import_path[0] && _config.ir.import_path[0] != '/') {
+        char tmp[512];
+        snprintf(tmp, sizeof(tmp), "%s/%s", root, _config.ir.import_path);
+        snprintf(_config.ir.import_path, sizeof(_config.ir.import_path), "%s", tmp);
+    }
+
+    if (_config.ir.macros_path[0] && _config.ir.macros_path[0] != '/') {
+        char tmp[512];
+        snprintf(tmp, sizeof(tmp), "%s/%s", root, _config.ir.macros_path);
+        snprintf(_config.ir.macros_path, sizeof(_config.ir.macros_path), "%s", tmp);
+    }
+
     if (_config.hid.list_path[0] && _config.hid.list_path[0] != '/') {
         char tmp[512];
         snprintf(tmp, sizeof(tmp), "%s/%s", root, _config.hid.list_path);
         snprintf(_config.hid.list_path, sizeof(_config.hid.list_path), "%s", tmp);
     }
+
+    if (_config.bt.gatt_cache_path[0] && _config.bt.gatt_cache_path[0] != '/') {
+        char tmp[512];
+        snprintf(tmp, sizeof(tmp), "%s/%s", root, _config.bt.gatt_cache_path);
+        snprintf(_config.bt.gatt_cache_path, sizeof(_config.bt.gatt_cache_path), "%s", tmp);
+    }
+
+    if (_config.bt.scan_log_path[0] && _config.bt.scan_log_path[0] != '/') {
+        char tmp[512];
+        snprintf(tmp, sizeof(tmp), "%s/%s", root, _config.bt.scan_log_path);
+        snprintf(_config.bt.scan_log_path, sizeof(_config.bt.scan_log_path), "%s", tmp);
+    }
 }
 
 int config_get_asset_path(const char *asset_path, char *out, size_t out_sz)
@@ -23,17 +23,47 @@ typedef struct {
 
     struct {
         char remotes_path[512];
+        char import_path[512];      // lircd.conf / Flipper .ir libraries for the importer
+        char macros_path[512];      // macro .json files, see page/ir/ir_macro.h
         char backend[32];
         char tx_device[128];
         char rx_device[128];
         int learn_timeout_ms;
+        int carrier_hz;
+        int duty_cycle;
+        int learn_presses;
         bool use_on_screen_keyboard;
     } ir;
 
     struct {
         char fb_device[128];
+
+        // Home modules: how many pages stay built, and how long an unused one survives.
+        int page_cache_max;
+        int page_idle_timeout_s;
     } display;
 
+    struct {
+        char gatt_cache_path[512];
+        bool raw_advertising;
+        char scan_log_path[512];
+        int scan_log_max_mb;            // scan.log + the rotated scan.log.1 stay under this; 0 = no cap
+
+        // Continuous scan: duty cycle asked to the ESP32 and the budget that throttles it.
+        bool continuous_scan;
+        int scan_interval_ms;
+        int scan_window_ms;
+        int scan_budget_backlog;
+        int scan_budget_cpu_pct;
+
+        // Link parameters asked for by bt_tune_link(), optionally right after connecting.
+        bool link_tune_on_connect;
+        int link_mtu;
+        int link_data_length;
+        int link_interval_ms;
+        int link_timeout_ms;
+    } bt;
+
     uart_config_t uart;
 } zv_config;
 
@@ -20,11 +20,14 @@
 #include "page/ir/ir.h"
 #include "page/ir/ir_controller.h"
 #include "page/bt/bt_controller.h"
+#include "page/bt/bt_gatt_cache.h"
+#include "page/bt/bt_scan_log.h"
 #include "page/ir/learn_button.h"
 #include "page/ir/new_remote.h"
 #include "page/bt/bt_view.h"
 #include "page/base_view.h"
 #include "config.h"
+#include "service/fs_watch.h"
 #include "service/uart_service.h"
 #include "utils/error_handler.h"
 #include "utils/file.h"
@@ -177,6 +180,7 @@ void setup_navigation_groups(lv_obj_t *menu, lv_obj_t *page)
     lv_group_set_wrap(group, true);
     zv_nav_set_group(group);
     zv_nav_update_group(menu, page);
+    zv_nav_attach_menu(menu);
 
     nav_btn = gpio_btn_init(NAV_GPIO);
     select_btn = gpio_btn_init(SELECT_GPIO);
@@ -248,13 +252,21 @@ int main(void)
     lv_obj_set_flex_flow(scr, LV_FLEX_FLOW_COLUMN);
     lv_obj_set_style_pad_row(scr, 0, 0);
 
+    // Not fatal: without inotify the lists only change on a manual refresh.
+    if (fs_watch_init() != 0)
+        log_warning("Filesystem watch unavailable, lists will not update live\n");
+
     ir_remote_ctx ir_cfg;
     memset(&ir_cfg, 0, sizeof(ir_cfg));
     ir_cfg.remotes_root = (char *)config->ir.remotes_path;
+    ir_cfg.macros_root = (char *)config->ir.macros_path;
     ir_cfg.ir_ctx.backend = config->ir.backend;
     snprintf(ir_cfg.ir_ctx.tx_dev, sizeof(ir_cfg.ir_ctx.tx_dev), "%s", config->ir.tx_device);
     snprintf(ir_cfg.ir_ctx.rx_dev, sizeof(ir_cfg.ir_ctx.rx_dev), "%s", config->ir.rx_device);
     ir_cfg.ir_ctx.timeout_ms = config->ir.learn_timeout_ms;
+    ir_cfg.ir_ctx.carrier_hz = config->ir.carrier_hz;
+    ir_cfg.ir_ctx.duty_cycle = config->ir.duty_cycle;
+    ir_cfg.learn_presses = config->ir.learn_presses;
 
     if (ir_controller_init(&ir_cfg) != IR_OK) {
         log_error("IR init failed: %s\n", ir_controller_last_error());
@@ -266,6 +278,10 @@ int main(void)
     snprintf(uart_cfg.device, sizeof(uart_cfg.device), "%s", config->uart.device);
     uart_cfg.baudrate = config->uart.baudrate;
 
+    bt_gatt_cache_init(config->bt.gatt_cache_path);
+    size_t scan_log_max = config->bt.scan_log_max_mb > 0 ? (size_t)config->bt.scan_log_max_mb * 1024 * 1024 : 0;
+    bt_scan_log_init(config->bt.scan_log_path, scan_log_max);
+
     if (bt_controller_init(&uart_cfg) != UART_OK )
     {
         log_error("Bluetooth init failed\n");
@@ -297,12 +313,15 @@ int main(void)
             .label = "Bad USB",
             .icon = LV_SYMBOL_USB,
             .create_page = hid_view_create,
+            .destroy_page = hid_view_destroy,
             .rotate_icon_90 = false,
         },
         {
             .label = "Infrared",
             .icon = LV_SYMBOL_WIFI,
             .create_page = ir_page_create,
+            .destroy_page = ir_page_destroy,
+            .busy = ir_page_busy,
             .rotate_icon_90 = true,
         },
         {
@@ -335,20 +354,12 @@ int main(void)
     lv_menu_set_page(menu, home_page);
 
     setup_navigation_groups(menu, home_page);
-    lv_obj_t *last_page = lv_menu_get_cur_main_page(menu);
     while (1)
     {
         lv_timer_handler();
 
         uart_process_loop();
-
-        lv_obj_t *cur_page = lv_menu_get_cur_main_page(menu);
-
-        if (cur_page && cur_page != last_page)
-        {
-            zv_nav_update_group(menu, cur_page);
-            last_page = cur_page;
-        }
+        fs_watch_process();
 
         usleep(5000);
     }
@@ -0,0 +1,212 @@
+#include "bt_ad_decoder.h"
+#include "bt_uuid_registry.h"
+
+#include <stdio.h>
+#include <string.h>
+
+static uint16_t read_le16(const uint8_t *p)
+{
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+void bt_ad_iter_init(bt_ad_iter_t *it, const uint8_t *buf, size_t len)
+{
+    if (!it)
+        return;
+
+    it->buf = buf;
+    it->len = buf ? len : 0;
+    it->pos = 0;
+}
+
+/*
+ * Each AD structure is [length][type][length - 1 bytes]. A zero length marks
+ * early termination (padding) and a structure running past the end means the
+ * payload is malformed; both end the iteration.
+ */
+bool bt_ad_iter_next(bt_ad_iter_t *it, bt_ad_field_t *out)
+{
+    if (!it || !out || it->pos >= it->len)
+        return false;
+
+    uint8_t field_len = it->buf[it->pos];
+    if (field_len == 0 || it->pos + 1 + field_len > it->len)
+    {
+        it->pos = it->len;
+        return false;
+    }
+
+    out->type = it->buf[it->pos + 1];
+    out->len = (uint8_t)(field_len - 1);
+    out->data = &it->buf[it->pos + 2];
+
+    it->pos += 1 + field_len;
+    return true;
+}
+
+bool bt_ad_find(const uint8_t *buf, size_t len, uint8_t type, bt_ad_field_t *out)
+{
+    bt_ad_iter_t it;
+    bt_ad_field_t field;
+
+    bt_ad_iter_init(&it, buf, len);
+    while (bt_ad_iter_next(&it, &field))
+    {
+        if (field.type == type)
+        {
+            if (out)
+                *out = field;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static size_t uuid_width(uint8_t type)
+{
+    switch (type)
+    {
+        case BT_AD_UUID16_SOME:
+        case BT_AD_UUID16_ALL:
+        case BT_AD_SVC_DATA16:   return 2;
+        case BT_AD_UUID32_SOME:
+        case BT_AD_UUID32_ALL:
+        case BT_AD_SVC_DATA32:   return 4;
+        case BT_AD_UUID128_SOME:
+        case BT_AD_UUID128_ALL:
+        case BT_AD_SVC_DATA128:  return 16;
+        default:                 return 0;
+    }
+}
+
+static bool is_service_data(uint8_t type)
+{
+    return type == BT_AD_SVC_DATA16 || type == BT_AD_SVC_DATA32 || type == BT_AD_SVC_DATA128;
+}
+
+size_t bt_ad_uuid_count(const bt_ad_field_t *field)
+{
+    if (!field)
+        return 0;
+
+    size_t width = uuid_width(field->type);
+    if (width == 0 || field->len < width)
+        return 0;
+
+    return is_service_data(field->type) ? 1 : field->len / width;
+}
+
+bool bt_ad_uuid_at(const bt_ad_field_t *field, size_t index, bt_uuid_t *out)
+{
+    if (!out || index >= bt_ad_uuid_count(field))
+        return false;
+
+    size_t width = uuid_width(field->type);
+    const uint8_t *p = field->data + index * width;
+
+    // Over the air every UUID is little-endian; bt_uuid_t is big-endian.
+    if (width == 16)
+    {
+        for (int i = 0; i < 16; i++)
+            out->bytes[i] = p[15 - i];
+        return true;
+    }
+
+    char text[9];
+    if (width == 2)
+        snprintf(text, sizeof(text), "%04X", read_le16(p));
+    else
+        snprintf(text, sizeof(text), "%04X%04X", read_le16(p + 2), read_le16(p));
+
+    return bt_uuid_parse(text, out);
+}
+
+bool bt_ad_get_name(const uint8_t *buf, size_t len, char *out, size_t out_size)
+{
+    if (!out || out_size == 0)
+        return false;
+
+    bt_ad_field_t field;
+    if (!bt_ad_find(buf, len, BT_AD_NAME_COMPLETE, &field) &&
+        !bt_ad_find(buf, len, BT_AD_NAME_SHORT, &field))
+        return false;
+
+    size_t n = field.len < out_size - 1 ? field.len : out_size - 1;
+    memcpy(out, field.data, n);
+    out[n] = '\0';
+    return n > 0;
+}
+
+bool bt_ad_get_flags(const uint8_t *buf, size_t len, uint8_t *out)
+{
+    bt_ad_field_t field;
+    if (!bt_ad_find(buf, len, BT_AD_FLAGS, &field) || field.len < 1)
+        return false;
+
+    if (out)
+        *out = field.data[0];
+    return true;
+}
+
+bool bt_ad_get_tx_power(const uint8_t *buf, size_t len, int8_t *out)
+{
+    bt_ad_field_t field;
+    if (!bt_ad_find(buf, len, BT_AD_TX_POWER, &field) || field.len < 1)
+        return false;
+
+    if (out)
+        *out = (int8_t)field.data[0];
+    return true;
+}
+
+bool bt_ad_get_appearance(const uint8_t *buf, size_t len, uint16_t *out)
+{
+    bt_ad_field_t field;
+    if (!bt_ad_find(buf, len, BT_AD_APPEARANCE, &field) || field.len < 2)
+        return false;
+
+    if (out)
+        *out = read_le16(field.data);
+    return true;
+}
+
+bool bt_ad_get_manufacturer(const uint8_t *buf, size_t len, uint16_t *company_id,
+                            const uint8_t **payload, size_t *payload_len)
+{
+    bt_ad_field_t field;
+    if (!bt_ad_find(buf, len, BT_AD_MANUFACTURER, &field) || field.len < 2)
+        return false;
+
+    if (company_id)
+        *company_id = read_le16(field.data);
+    if (payload)
+        *payload = field.data + 2;
+    if (payload_len)
+        *payload_len = field.len - 2;
+
+    return true;
+}
+
+const char *bt_ad_type_name(uint8_t type)
+{
+    switch (type)
+    {
+        case BT_AD_FLAGS:         return "Flags";
+        case BT_AD_UUID16_SOME:
+        case BT_AD_UUID16_ALL:    return "UUID16";
+        case BT_AD_UUID32_SOME:
+        case BT_AD_UUID32_ALL:    return "UUID32";
+        case BT_AD_UUID128_SOME:
+        case BT_AD_UUID128_ALL:   return "UUID128";
+        case BT_AD_NAME_SHORT:    return "Short Name";
+        case BT_AD_NAME_COMPLETE: return "Name";
+        case BT_AD_TX_POWER:      return "TX Power";
+        case BT_AD_SVC_DATA16:
+        case BT_AD_SVC_DATA32:
+        case BT_AD_SVC_DATA128:   return "Service Data";
+        case BT_AD_APPEARANCE:    return "Appearance";
+        case BT_AD_MANUFACTURER:  return "Manufacturer";
+        default:                  return NULL;
+    }
+}
@@ -0,0 +1,68 @@
+#ifndef BT_AD_DECODER_H
+#define BT_AD_DECODER_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// AD types (Core Spec Supplement, Part A).
+#define BT_AD_FLAGS             0x01
+#define BT_AD_UUID16_SOME       0x02
+#define BT_AD_UUID16_ALL        0x03
+#define BT_AD_UUID32_SOME       0x04
+#define BT_AD_UUID32_ALL        0x05
+#define BT_AD_UUID128_SOME      0x06
+#define BT_AD_UUID128_ALL       0x07
+#define BT_AD_NAME_SHORT        0x08
+#define BT_AD_NAME_COMPLETE     0x09
+#define BT_AD_TX_POWER          0x0A
+#define BT_AD_SVC_DATA16        0x16
+#define BT_AD_APPEARANCE        0x19
+#define BT_AD_SVC_DATA32        0x20
+#define BT_AD_SVC_DATA128       0x21
+#define BT_AD_MANUFACTURER      0xFF
+
+/*
+ * One AD structure. `data` points into the caller's buffer, nothing is
+ * copied, so a field is only valid while that buffer is.
+ */
+typedef struct {
+    uint8_t type;
+    uint8_t len;
+    const uint8_t *data;
+} bt_ad_field_t;
+
+typedef struct {
+    const uint8_t *buf;
+    size_t len;
+    size_t pos;
+} bt_ad_iter_t;
+
+void bt_ad_iter_init(bt_ad_iter_t *it, const uint8_t *buf, size_t len);
+bool bt_ad_iter_next(bt_ad_iter_t *it, bt_ad_field_t *out);
+bool bt_ad_find(const uint8_t *buf, size_t len, uint8_t type, bt_ad_field_t *out);
+
+// UUID lists (0x02-0x07) and service data (0x16/0x20/0x21, one UUID).
+size_t bt_ad_uuid_count(const bt_ad_field_t *field);
+bool bt_ad_uuid_at(const bt_ad_field_t *field, size_t index, bt_uuid_t *out);
+
+bool bt_ad_get_name(const uint8_t *buf, size_t len, char *out, size_t out_size);
+bool bt_ad_get_flags(const uint8_t *buf, size_t len, uint8_t *out);
+bool bt_ad_get_tx_power(const uint8_t *buf, size_t len, int8_t *out);
+bool bt_ad_get_appearance(const uint8_t *buf, size_t len, uint16_t *out);
+bool bt_ad_get_manufacturer(const uint8_t *buf, size_t len, uint16_t *company_id,
+                            const uint8_t **payload, size_t *payload_len);
+
+const char *bt_ad_type_name(uint8_t type);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BT_AD_DECODER_H */
@@ -0,0 +1,883 @@
+// Generated by scripts/gen_bt_assigned_numbers.py. Do not edit by hand.
+// Entries: 69 services, 201 characteristics, 18 descriptors, 10 member_services, 230 companies, 120 appearances, 16 vendor_uuids.
+
+#include "bt_assigned_numbers.h"
+
+const char bt_an_names[] =
+    "GAP\000GATT\000Immediate Alert\000Link Loss\000Tx Power\000Current Time\000"
+    "Reference Time Update\000Next DST Change\000Glucose\000Health Thermometer\000"
+    "Device Info\000Heart Rate\000Phone Alert Status\000Battery\000Blood Pressure\000"
+    "Alert Notification\000HID\000Scan Parameters\000Running Speed and Cadence\000"
+    "Automation IO\000Cycling Speed\000Cycling Power\000Location and Navigation\000"
+    "Environmental\000Body Composition\000User Data\000Weight Scale\000Bond Management\000"
+    "Continuous Glucose Monitoring\000Internet Protocol Support\000Indoor Positioning\000"
+    "Pulse Oximeter\000HTTP Proxy\000Transport Discovery\000Object Transfer\000"
+    "Fitness Machine\000Mesh Provisioning\000Mesh Proxy\000Reconnection Configuration\000"
+    "Insulin Delivery\000Binary Sensor\000Emergency Configuration\000Authorization Control\000"
+    "Physical Activity Monitor\000Elapsed Time\000Generic Health Sensor\000"
+    "Audio Input Control\000Volume Control\000Volume Offset Control\000"
+    "Coordinated Set Identification\000Device Time\000Media Control\000"
+    "Generic Media Control\000Constant Tone Extension\000Telephone Bearer\000"
+    "Generic Telephone Bearer\000Microphone Control\000Audio Stream Control\000"
+    "Broadcast Audio Scan\000Published Audio Capabilities\000Basic Audio Announcement\000"
+    "Broadcast Audio Announcement\000Common Audio\000Hearing Access\000"
+    "Telephony and Media Audio\000Public Broadcast Announcement\000Electronic Shelf Label\000"
+    "Gaming Audio\000Mesh Proxy Solicitation\000Device Name\000Appearance\000"
+    "Peripheral Privacy Flag\000Reconnection Address\000"
+    "Peripheral Preferred Connection Parameters\000Service Changed\000Alert Level\000"
+    "Tx Power Level\000Date Time\000Day of Week\000Day Date Time\000Exact Time 256\000"
+    "DST Offset\000Time Zone\000Local Time Information\000Time with DST\000Time Accuracy\000"
+    "Time Source\000Reference Time Information\000Time Update Control Point\000"
+    "Time Update State\000Glucose Measurement\000Battery Lvl\000Temperature Measurement\000"
+    "Temperature Type\000Intermediate Temperature\000Measurement Interval\000"
+    "Boot Keyboard Input Report\000System ID\000Model Number\000Serial Number\000"
+    "Firmware Rev\000Hardware Rev\000Software Rev\000Manufacturer\000"
+    "IEEE 11073-20601 Regulatory Certification Data List\000Magnetic Declination\000"
+    "Scan Refresh\000Boot Keyboard Output Report\000Boot Mouse Input Report\000"
+    "Glucose Measurement Context\000Blood Pressure Measurement\000"
+    "Intermediate Cuff Pressure\000HR Meas.\000Body Loc.\000Heart Rate Control Point\000"
+    "Alert Status\000Ringer Control Point\000Ringer Setting\000Alert Category ID Bit Mask\000"
+    "Alert Category ID\000Alert Notification Control Point\000Unread Alert Status\000"
+    "New Alert\000Supported New Alert Category\000Supported Unread Alert Category\000"
+    "Blood Pressure Feature\000HID Information\000Report Map\000HID Control Point\000"
+    "HID Report\000Protocol Mode\000Scan Interval Window\000PnP ID\000Glucose Feature\000"
+    "Record Access Control Point\000RSC Measurement\000RSC Feature\000SC Control Point\000"
+    "Aggregate\000CSC Measurement\000CSC Feature\000Sensor Location\000"
+    "PLX Spot-Check Measurement\000PLX Continuous Measurement\000PLX Features\000"
+    "Cycling Power Measurement\000Cycling Power Vector\000Cycling Power Feature\000"
+    "Cycling Power Control Point\000Location and Speed\000Navigation\000Position Quality\000"
+    "LN Feature\000LN Control Point\000Elevation\000Pressure\000Temperature\000Humidity\000"
+    "True Wind Speed\000True Wind Direction\000Apparent Wind Speed\000"
+    "Apparent Wind Direction\000Gust Factor\000Pollen Concentration\000UV Index\000"
+    "Irradiance\000Rainfall\000Wind Chill\000Heat Index\000Dew Point\000"
+    "Descriptor Value Changed\000Aerobic Heart Rate Lower Limit\000Aerobic Threshold\000Age\000"
+    "Anaerobic Heart Rate Lower Limit\000Anaerobic Heart Rate Upper Limit\000"
+    "Anaerobic Threshold\000Aerobic Heart Rate Upper Limit\000Date of Birth\000"
+    "Date of Threshold Assessment\000Email Address\000Fat Burn Heart Rate Lower Limit\000"
+    "Fat Burn Heart Rate Upper Limit\000First Name\000Five Zone Heart Rate Limits\000Gender\000"
+    "Heart Rate Max\000Height\000Hip Circumference\000Last Name\000"
+    "Maximum Recommended Heart Rate\000Resting Heart Rate\000"
+    "Sport Type for Aerobic and Anaerobic Thresholds\000Three Zone Heart Rate Limits\000"
+    "Two Zone Heart Rate Limits\000VO2 Max\000Waist Circumference\000Weight\000"
+    "Database Change Increment\000User Index\000Body Composition Feature\000"
+    "Body Composition Measurement\000Weight Measurement\000Weight Scale Feature\000"
+    "User Control Point\000Magnetic Flux Density - 2D\000Magnetic Flux Density - 3D\000"
+    "Language\000Barometric Pressure Trend\000Bond Management Control Point\000"
+    "Bond Management Feature\000Central Address Resolution\000CGM Measurement\000"
+    "CGM Feature\000CGM Status\000CGM Session Start Time\000CGM Session Run Time\000"
+    "CGM Specific Ops Control Point\000Indoor Positioning Configuration\000Latitude\000"
+    "Longitude\000Local North Coordinate\000Local East Coordinate\000Floor Number\000"
+    "Altitude\000Uncertainty\000Location Name\000URI\000HTTP Headers\000HTTP Status Code\000"
+    "HTTP Entity Body\000HTTP Control Point\000HTTPS Security\000TDS Control Point\000"
+    "OTS Feature\000Object Name\000Object Type\000Object Size\000Object First-Created\000"
+    "Object Last-Modified\000Object ID\000Object Properties\000Object Action Control Point\000"
+    "Object List Control Point\000Object List Filter\000Object Changed\000"
+    "Resolvable Private Address Only\000Fitness Machine Feature\000Treadmill Data\000"
+    "Cross Trainer Data\000Step Climber Data\000Stair Climber Data\000Rower Data\000"
+    "Indoor Bike Data\000Training Status\000Supported Speed Range\000"
+    "Supported Inclination Range\000Supported Resistance Level Range\000"
+    "Supported Heart Rate Range\000Supported Power Range\000Fitness Machine Control Point\000"
+    "Fitness Machine Status\000Mesh Provisioning Data In\000Mesh Provisioning Data Out\000"
+    "Mesh Proxy Data In\000Mesh Proxy Data Out\000Client Supported Features\000"
+    "Database Hash\000Server Supported Features\000Characteristic Extended Properties\000"
+    "Characteristic User Description\000CCCD\000Server Characteristic Configuration\000"
+    "Characteristic Presentation Format\000Characteristic Aggregate Format\000Valid Range\000"
+    "External Report Reference\000Report Reference\000Number of Digitals\000"
+    "Value Trigger Setting\000Environmental Sensing Configuration\000"
+    "Environmental Sensing Measurement\000Environmental Sensing Trigger Setting\000"
+    "Time Trigger Setting\000Complete BR-EDR Transport Block Data\000Observation Schedule\000"
+    "Valid Range and Accuracy\000Exposure Notification\000Google LLC\000"
+    "Nordic Semiconductor ASA\000Xiaomi Inc.\000Apple, Inc.\000Tile, Inc.\000Ericsson AB\000"
+    "Nokia Mobile Phones\000Intel Corp.\000IBM Corp.\000Toshiba Corp.\0003Com\000Microsoft\000"
+    "Lucent\000Motorola\000Infineon Technologies AG\000"
+    "Qualcomm Technologies International, Ltd. (QTIL)\000Silicon Wave\000Digianswer A/S\000"
+    "Texas Instruments Inc.\000Parthus Technologies Inc.\000Broadcom Corporation\000"
+    "Mitel Semiconductor\000Widcomm, Inc.\000Zeevo, Inc.\000Atmel Corporation\000"
+    "Mitsubishi Electric Corporation\000RTX A/S\000KC Technology Inc.\000Newlogic\000"
+    "Transilica, Inc.\000Rohde & Schwarz GmbH & Co. KG\000TTPCom Limited\000"
+    "Signia Technologies, Inc.\000Conexant Systems Inc.\000Qualcomm\000Inventel\000"
+    "AVM Berlin\000BandSpeed, Inc.\000Mansella Ltd\000NEC Corporation\000"
+    "WavePlus Technology Co., Ltd.\000Alcatel\000NXP B.V.\000C Technologies\000"
+    "Open Interface\000R F Micro Devices\000Hitachi Ltd\000Symbol Technologies, Inc.\000"
+    "Tenovis\000Macronix International Co. Ltd.\000GCT Semiconductor\000Norwood Systems\000"
+    "MewTel Technology Inc.\000ST Microelectronics\000Synopsys, Inc.\000"
+    "Red-M (Communications) Ltd\000Commil Ltd\000"
+    "Computer Access Technology Corporation (CATC)\000Eclipse (HQ Espana) S.L.\000"
+    "Renesas Electronics Corporation\000Mobilian Corporation\000"
+    "Integrated System Solution Corp.\000Panasonic Holdings Corporation\000"
+    "Gennum Corporation\000BlackBerry Limited\000IPextreme, Inc.\000Systems and Chips, Inc\000"
+    "Bluetooth SIG, Inc\000Seiko Epson Corporation\000"
+    "Integrated Silicon Solution Taiwan, Inc.\000CONWISE Technology Corporation Ltd\000"
+    "PARROT AUTOMOTIVE SAS\000Socket Mobile\000Atheros Communications, Inc.\000"
+    "MediaTek, Inc.\000Bluegiga\000Marvell Technology Group Ltd.\0003DSP Corporation\000"
+    "Accel Semiconductor Ltd.\000Continental Automotive Systems\000"
+    "Staccato Communications, Inc.\000Avago Technologies\000APT Ltd.\000"
+    "SiRF Technology, Inc.\000Tzero Technologies, Inc.\000J&M Corporation\000Free2move AB\000"
+    "3DiJoy Corporation\000Plantronics, Inc.\000Sony Ericsson Mobile Communications\000"
+    "Harman International Industries, Inc.\000Vizio, Inc.\000EM Microelectronic-Marin SA\000"
+    "Ralink Technology Corporation\000Belkin International, Inc.\000"
+    "Realtek Semiconductor Corporation\000Stonestreet One, LLC\000Wicentric, Inc.\000"
+    "RivieraWaves S.A.S\000RDA Microelectronics\000Gibson Guitars\000MiCommand Inc.\000"
+    "Band XI International, LLC\000HP, Inc.\0009Solutions Oy\000GN Audio A/S\000"
+    "General Motors\000A&D Engineering, Inc.\000LTIMINDTREE LIMITED\000Polar Electro OY\000"
+    "Beautiful Enterprise Co., Ltd.\000BriarTek, Inc\000Summit Data Communications, Inc.\000"
+    "Sound ID\000Monster, LLC\000connectBlue AB\000"
+    "ShangHai Super Smart Electronics Co. Ltd.\000Group Sense Ltd.\000Zomm, LLC\000"
+    "Samsung Electronics Co. Ltd.\000Creative Technology Ltd.\000Laird Connectivity LLC\000"
+    "Nike, Inc.\000lesswire AG\000MStar Semiconductor, Inc.\000Hanlynn Technologies\000"
+    "A & R Cambridge\000Seers Technology Co., Ltd.\000Sports Tracking Technologies Ltd.\000"
+    "Autonet Mobile\000DeLorme Publishing Company, Inc.\000WuXi Vimicro\000DSEA A/S\000"
+    "TimeKeeping Systems, Inc.\000Ludus Helsinki Ltd.\000BlueRadios, Inc.\000Equinux AG\000"
+    "Garmin International, Inc.\000Ecotest\000GN Hearing A/S\000Jawbone\000"
+    "Topcon Positioning Systems, LLC\000Gimbal Inc.\000Zscan Software\000Quintic Corp\000"
+    "Telit Wireless Solutions GmbH\000Funai Electric Co., Ltd.\000"
+    "Advanced PANMOBIL systems GmbH & Co.\000ThinkOptics, Inc.\000"
+    "Universal Electronics, Inc.\000Airoha Technology Corp.\000NEC Lighting, Ltd.\000"
+    "ODM Technology, Inc.\000ConnecteDevice Ltd.\000zero1.tv GmbH\000"
+    "i.Tech Dynamic Global Distribution Ltd.\000Alpwise\000"
+    "Jiangsu Toppower Automotive Electronics Co., Ltd.\000Colorfy, Inc.\000Geoforce Inc.\000"
+    "Bose Corporation\000Suunto Oy\000Kensington Computer Products Group\000"
+    "SR-Medizinelektronik\000Vertu Corporation Limited\000Meta Watch Ltd.\000LINAK A/S\000"
+    "OTL Dynamics LLC\000Panda Ocean Inc.\000Visteon Corporation\000ARP Devices Limited\000"
+    "MARELLI EUROPE S.P.A.\000CAEN RFID srl\000Ingenieur-Systemgruppe Zahn GmbH\000"
+    "Green Throttle Games\000Peter Systemtechnik GmbH\000Omegawave Oy\000Cinetix\000"
+    "Passif Semiconductor Corp\000Saris Cycling Group, Inc\000Bekey A/S\000"
+    "Clarinox Technologies Pty. Ltd.\000BDE Technology Co., Ltd.\000Swirl Networks\000"
+    "Meso international\000TreLab Ltd\000Qualcomm Innovation Center, Inc. (QuIC)\000"
+    "Johnson Controls, Inc.\000Starkey Hearing Technologies\000S-Power Electronics Limited\000"
+    "Ace Sensor Inc\000Aplix Corporation\000AAMP of America\000Stalmart Technology Limited\000"
+    "AMICCOM Electronics Corporation\000Shenzhen Excelsecu Data Technology Co.,Ltd\000"
+    "Geneq Inc.\000adidas AG\000LG Electronics\000Onset Computer Corporation\000Selfly BV\000"
+    "Quuppa Oy.\000GeLo Inc\000Evluma\000MC10\000Binauric SE\000Beats Electronics\000"
+    "Microchip Technology Inc.\000Eve Systems GmbH\000ARCHOS SA\000Dexcom, Inc.\000"
+    "Polar Electro Europe B.V.\000Dialog Semiconductor B.V.\000"
+    "Taixingbang Technology (HK) Co,. LTD.\000Kawantech\000Austco Communication Systems\000"
+    "Timex Group USA, Inc.\000Qualcomm Technologies, Inc.\000"
+    "Qualcomm Connected Experiences, Inc.\000Voyetra Turtle Beach\000txtr GmbH\000"
+    "Procter & Gamble\000Hosiden Corporation\000Muzik LLC\000Misfit Wearables Corp\000"
+    "Google\000Cypress Semiconductor\000Anhui Huami Information Technology Co., Ltd.\000"
+    "Amazon.com Services LLC\000HUAWEI Technologies Co., Ltd.\000"
+    "Espressif Systems (Shanghai) Co., Ltd.\000Ruuvi Innovations Ltd.\000Unknown\000Phone\000"
+    "Computer\000Desktop Workstation\000Server-class Computer\000Laptop\000"
+    "Handheld PC/PDA (clamshell)\000Palm-size PC/PDA\000Wearable computer (watch size)\000"
+    "Tablet\000Docking Station\000All in One\000Blade Server\000Convertible\000Detachable\000"
+    "IoT Gateway\000Mini PC\000Stick PC\000Watch\000Sports Watch\000Smartwatch\000Clock\000"
+    "Display\000Remote Control\000Eye-glasses\000Tag\000Keyring\000Media Player\000"
+    "Barcode Scanner\000Thermometer\000Ear Thermometer\000Heart Rate Sensor\000"
+    "Heart Rate Belt\000Arm Blood Pressure\000Wrist Blood Pressure\000"
+    "Human Interface Device\000Keyboard\000Mouse\000Joystick\000Gamepad\000Digitizer Tablet\000"
+    "Card Reader\000Digital Pen\000Touchpad\000Presentation Remote\000Glucose Meter\000"
+    "Running Walking Sensor\000In-Shoe Running Walking Sensor\000"
+    "On-Shoe Running Walking Sensor\000On-Hip Running Walking Sensor\000Cycling\000"
+    "Cycling Computer\000Speed Sensor\000Cadence Sensor\000Power Sensor\000"
+    "Speed and Cadence Sensor\000Control Device\000Network Device\000Sensor\000"
+    "Light Fixtures\000Fan\000HVAC\000Air Conditioning\000Humidifier\000Heating\000"
+    "Access Control\000Motorized Device\000Power Device\000Light Source\000Window Covering\000"
+    "Audio Sink\000Standalone Speaker\000Soundbar\000Bookshelf Speaker\000"
+    "Standmounted Speaker\000Speakerphone\000Audio Source\000Microphone\000Alarm\000Bell\000"
+    "Horn\000Broadcasting Device\000Service Desk\000Kiosk\000Broadcasting Room\000"
+    "Auditorium\000Motorized Vehicle\000Domestic Appliance\000Wearable Audio Device\000"
+    "Earbud\000Headset\000Headphones\000Neck Band\000Aircraft\000AV Equipment\000"
+    "Display Equipment\000Hearing aid\000In-ear hearing aid\000Behind-ear hearing aid\000"
+    "Cochlear Implant\000Gaming\000Home Video Game Console\000Portable handheld console\000"
+    "Signage\000Fingertip Pulse Oximeter\000Wrist Worn Pulse Oximeter\000"
+    "Personal Mobility Device\000Continuous Glucose Monitor\000Insulin Pump\000"
+    "Medication Delivery\000Spirometer\000Outdoor Sports Activity\000Location Display\000"
+    "Location and Navigation Display\000Location Pod\000Location and Navigation Pod\000"
+    "Nordic Legacy DFU\000Nordic DFU Control\000Nordic DFU Packet\000ANCS Data Source\000"
+    "ANCS Control Point\000Nordic UART\000Nordic UART RX\000Nordic UART TX\000Apple ANCS\000"
+    "Continuity Char.\000Apple Media Service\000Buttonless DFU\000Apple Nearby\000"
+    "ANCS Notif. Source\000Nearby Char.\000Apple Continuity\000"
+    ;
+
+const bt_an_entry16_t bt_an_services[] = {
+    { 0x1800,      0 }, // GAP
+    { 0x1801,      4 }, // GATT
+    { 0x1802,      9 }, // Immediate Alert
+    { 0x1803,     25 }, // Link Loss
+    { 0x1804,     35 }, // Tx Power
+    { 0x1805,     44 }, // Current Time
+    { 0x1806,     57 }, // Reference Time Update
+    { 0x1807,     79 }, // Next DST Change
+    { 0x1808,     95 }, // Glucose
+    { 0x1809,    103 }, // Health Thermometer
+    { 0x180A,    122 }, // Device Info
+    { 0x180D,    134 }, // Heart Rate
+    { 0x180E,    145 }, // Phone Alert Status
+    { 0x180F,    164 }, // Battery
+    { 0x1810,    172 }, // Blood Pressure
+    { 0x1811,    187 }, // Alert Notification
+    { 0x1812,    206 }, // HID
+    { 0x1813,    210 }, // Scan Parameters
+    { 0x1814,    226 }, // Running Speed and Cadence
+    { 0x1815,    252 }, // Automation IO
+    { 0x1816,    266 }, // Cycling Speed
+    { 0x1818,    280 }, // Cycling Power
+    { 0x1819,    294 }, // Location and Navigation
+    { 0x181A,    318 }, // Environmental
+    { 0x181B,    332 }, // Body Composition
+    { 0x181C,    349 }, // User Data
+    { 0x181D,    359 }, // Weight Scale
+    { 0x181E,    372 }, // Bond Management
+    { 0x181F,    388 }, // Continuous Glucose Monitoring
+    { 0x1820,    418 }, // Internet Protocol Support
+    { 0x1821,    444 }, // Indoor Positioning
+    { 0x1822,    463 }, // Pulse Oximeter
+    { 0x1823,    478 }, // HTTP Proxy
+    { 0x1824,    489 }, // Transport Discovery
+    { 0x1825,    509 }, // Object Transfer
+    { 0x1826,    525 }, // Fitness Machine
+    { 0x1827,    541 }, // Mesh Provisioning
+    { 0x1828,    559 }, // Mesh Proxy
+    { 0x1829,    570 }, // Reconnection Configuration
+    { 0x183A,    597 }, // Insulin Delivery
+    { 0x183B,    614 }, // Binary Sensor
+    { 0x183C,    628 }, // Emergency Configuration
+    { 0x183D,    652 }, // Authorization Control
+    { 0x183E,    674 }, // Physical Activity Monitor
+    { 0x183F,    700 }, // Elapsed Time
+    { 0x1840,    713 }, // Generic Health Sensor
+    { 0x1843,    735 }, // Audio Input Control
+    { 0x1844,    755 }, // Volume Control
+    { 0x1845,    770 }, // Volume Offset Control
+    { 0x1846,    792 }, // Coordinated Set Identification
+    { 0x1847,    823 }, // Device Time
+    { 0x1848,    835 }, // Media Control
+    { 0x1849,    849 }, // Generic Media Control
+    { 0x184A,    871 }, // Constant Tone Extension
+    { 0x184B,    895 }, // Telephone Bearer
+    { 0x184C,    912 }, // Generic Telephone Bearer
+    { 0x184D,    937 }, // Microphone Control
+    { 0x184E,    956 }, // Audio Stream Control
+    { 0x184F,    977 }, // Broadcast Audio Scan
+    { 0x1850,    998 }, // Published Audio Capabilities
+    { 0x1851,   1027 }, // Basic Audio Announcement
+    { 0x1852,   1052 }, // Broadcast Audio Announcement
+    { 0x1853,   1081 }, // Common Audio
+    { 0x1854,   1094 }, // Hearing Access
+    { 0x1855,   1109 }, // Telephony and Media Audio
+    { 0x1856,   1135 }, // Public Broadcast Announcement
+    { 0x1857,   1165 }, // Electronic Shelf Label
+    { 0x1858,   1188 }, // Gaming Audio
+    { 0x1859,   1201 }, // Mesh Proxy Solicitation
+};
+const size_t bt_an_services_count = sizeof(bt_an_services) / sizeof(bt_an_services[0]);
+
+const bt_an_entry16_t bt_an_characteristics[] = {
+    { 0x2A00,   1225 }, // Device Name
+    { 0x2A01,   1237 }, // Appearance
+    { 0x2A02,   1248 }, // Peripheral Privacy Flag
+    { 0x2A03,   1272 }, // Reconnection Address
+    { 0x2A04,   1293 }, // Peripheral Preferred Connection Parameters
+    { 0x2A05,   1336 }, // Service Changed
+    { 0x2A06,   1352 }, // Alert Level
+    { 0x2A07,   1364 }, // Tx Power Level
+    { 0x2A08,   1379 }, // Date Time
+    { 0x2A09,   1389 }, // Day of Week
+    { 0x2A0A,   1401 }, // Day Date Time
+    { 0x2A0C,   1415 }, // Exact Time 256
+    { 0x2A0D,   1430 }, // DST Offset
+    { 0x2A0E,   1441 }, // Time Zone
+    { 0x2A0F,   1451 }, // Local Time Information
+    { 0x2A11,   1474 }, // Time with DST
+    { 0x2A12,   1488 }, // Time Accuracy
+    { 0x2A13,   1502 }, // Time Source
+    { 0x2A14,   1514 }, // Reference Time Information
+    { 0x2A16,   1541 }, // Time Update Control Point
+    { 0x2A17,   1567 }, // Time Update State
+    { 0x2A18,   1585 }, // Glucose Measurement
+    { 0x2A19,   1605 }, // Battery Lvl
+    { 0x2A1C,   1617 }, // Temperature Measurement
+    { 0x2A1D,   1641 }, // Temperature Type
+    { 0x2A1E,   1658 }, // Intermediate Temperature
+    { 0x2A21,   1683 }, // Measurement Interval
+    { 0x2A22,   1704 }, // Boot Keyboard Input Report
+    { 0x2A23,   1731 }, // System ID
+    { 0x2A24,   1741 }, // Model Number
+    { 0x2A25,   1754 }, // Serial Number
+    { 0x2A26,   1768 }, // Firmware Rev
+    { 0x2A27,   1781 }, // Hardware Rev
+    { 0x2A28,   1794 }, // Software Rev
+    { 0x2A29,   1807 }, // Manufacturer
+    { 0x2A2A,   1820 }, // IEEE 11073-20601 Regulatory Certification Data List
+    { 0x2A2B,     44 }, // Current Time
+    { 0x2A2C,   1872 }, // Magnetic Declination
+    { 0x2A31,   1893 }, // Scan Refresh
+    { 0x2A32,   1906 }, // Boot Keyboard Output Report
+    { 0x2A33,   1934 }, // Boot Mouse Input Report
+    { 0x2A34,   1958 }, // Glucose Measurement Context
+    { 0x2A35,   1986 }, // Blood Pressure Measurement
+    { 0x2A36,   2013 }, // Intermediate Cuff Pressure
+    { 0x2A37,   2040 }, // HR Meas.
+    { 0x2A38,   2049 }, // Body Loc.
+    { 0x2A39,   2059 }, // Heart Rate Control Point
+    { 0x2A3F,   2084 }, // Alert Status
+    { 0x2A40,   2097 }, // Ringer Control Point
+    { 0x2A41,   2118 }, // Ringer Setting
+    { 0x2A42,   2133 }, // Alert Category ID Bit Mask
+    { 0x2A43,   2160 }, // Alert Category ID
+    { 0x2A44,   2178 }, // Alert Notification Control Point
+    { 0x2A45,   2211 }, // Unread Alert Status
+    { 0x2A46,   2231 }, // New Alert
+    { 0x2A47,   2241 }, // Supported New Alert Category
+    { 0x2A48,   2270 }, // Supported Unread Alert Category
+    { 0x2A49,   2302 }, // Blood Pressure Feature
+    { 0x2A4A,   2325 }, // HID Information
+    { 0x2A4B,   2341 }, // Report Map
+    { 0x2A4C,   2352 }, // HID Control Point
+    { 0x2A4D,   2370 }, // HID Report
+    { 0x2A4E,   2381 }, // Protocol Mode
+    { 0x2A4F,   2395 }, // Scan Interval Window
+    { 0x2A50,   2416 }, // PnP ID
+    { 0x2A51,   2423 }, // Glucose Feature
+    { 0x2A52,   2439 }, // Record Access Control Point
+    { 0x2A53,   2467 }, // RSC Measurement
+    { 0x2A54,   2483 }, // RSC Feature
+    { 0x2A55,   2495 }, // SC Control Point
+    { 0x2A5A,   2512 }, // Aggregate
+    { 0x2A5B,   2522 }, // CSC Measurement
+    { 0x2A5C,   2538 }, // CSC Feature
+    { 0x2A5D,   2550 }, // Sensor Location
+    { 0x2A5E,   2566 }, // PLX Spot-Check Measurement
+    { 0x2A5F,   2593 }, // PLX Continuous Measurement
+    { 0x2A60,   2620 }, // PLX Features
+    { 0x2A63,   2633 }, // Cycling Power Measurement
+    { 0x2A64,   2659 }, // Cycling Power Vector
+    { 0x2A65,   2680 }, // Cycling Power Feature
+    { 0x2A66,   2702 }, // Cycling Power Control Point
+    { 0x2A67,   2730 }, // Location and Speed
+    { 0x2A68,   2749 }, // Navigation
+    { 0x2A69,   2760 }, // Position Quality
+    { 0x2A6A,   2777 }, // LN Feature
+    { 0x2A6B,   2788 }, // LN Control Point
+    { 0x2A6C,   2805 }, // Elevation
+    { 0x2A6D,   2815 }, // Pressure
+    { 0x2A6E,   2824 }, // Temperature
+    { 0x2A6F,   2836 }, // Humidity
+    { 0x2A70,   2845 }, // True Wind Speed
+    { 0x2A71,   2861 }, // True Wind Direction
+    { 0x2A72,   2881 }, // Apparent Wind Speed
+    { 0x2A73,   2901 }, // Apparent Wind Direction
+    { 0x2A74,   2925 }, // Gust Factor
+    { 0x2A75,   2937 }, // Pollen Concentration
+    { 0x2A76,   2958 }, // UV Index
+    { 0x2A77,   2967 }, // Irradiance
+    { 0x2A78,   2978 }, // Rainfall
+    { 0x2A79,   2987 }, // Wind Chill
+    { 0x2A7A,   2998 }, // Heat Index
+    { 0x2A7B,   3009 }, // Dew Point
+    { 0x2A7D,   3019 }, // Descriptor Value Changed
+    { 0x2A7E,   3044 }, // Aerobic Heart Rate Lower Limit
+    { 0x2A7F,   3075 }, // Aerobic Threshold
+    { 0x2A80,   3093 }, // Age
+    { 0x2A81,   3097 }, // Anaerobic Heart Rate Lower Limit
+    { 0x2A82,   3130 }, // Anaerobic Heart Rate Upper Limit
+    { 0x2A83,   3163 }, // Anaerobic Threshold
+    { 0x2A84,   3183 }, // Aerobic Heart Rate Upper Limit
+    { 0x2A85,   3214 }, // Date of Birth
+    { 0x2A86,   3228 }, // Date of Threshold Assessment
+    { 0x2A87,   3257 }, // Email Address
+    { 0x2A88,   3271 }, // Fat Burn Heart Rate Lower Limit
+    { 0x2A89,   3303 }, // Fat Burn Heart Rate Upper Limit
+    { 0x2A8A,   3335 }, // First Name
+    { 0x2A8B,   3346 }, // Five Zone Heart Rate Limits
+    { 0x2A8C,   3374 }, // Gender
+    { 0x2A8D,   3381 }, // Heart Rate Max
+    { 0x2A8E,   3396 }, // Height
+    { 0x2A8F,   3403 }, // Hip Circumference
+    { 0x2A90,   3421 }, // Last Name
+    { 0x2A91,   3431 }, // Maximum Recommended Heart Rate
+    { 0x2A92,   3462 }, // Resting Heart Rate
+    { 0x2A93,   3481 }, // Sport Type for Aerobic and Anaerobic Thresholds
+    { 0x2A94,   3529 }, // Three Zone Heart Rate Limits
+    { 0x2A95,   3558 }, // Two Zone Heart Rate Limits
+    { 0x2A96,   3585 }, // VO2 Max
+    { 0x2A97,   3593 }, // Waist Circumference
+    { 0x2A98,   3613 }, // Weight
+    { 0x2A99,   3620 }, // Database Change Increment
+    { 0x2A9A,   3646 }, // User Index
+    { 0x2A9B,   3657 }, // Body Composition Feature
+    { 0x2A9C,   3682 }, // Body Composition Measurement
+    { 0x2A9D,   3711 }, // Weight Measurement
+    { 0x2A9E,   3730 }, // Weight Scale Feature
+    { 0x2A9F,   3751 }, // User Control Point
+    { 0x2AA0,   3770 }, // Magnetic Flux Density - 2D
+    { 0x2AA1,   3797 }, // Magnetic Flux Density - 3D
+    { 0x2AA2,   3824 }, // Language
+    { 0x2AA3,   3833 }, // Barometric Pressure Trend
+    { 0x2AA4,   3859 }, // Bond Management Control Point
+    { 0x2AA5,   3889 }, // Bond Management Feature
+    { 0x2AA6,   3913 }, // Central Address Resolution
+    { 0x2AA7,   3940 }, // CGM Measurement
+    { 0x2AA8,   3956 }, // CGM Feature
+    { 0x2AA9,   3968 }, // CGM Status
+    { 0x2AAA,   3979 }, // CGM Session Start Time
+    { 0x2AAB,   4002 }, // CGM Session Run Time
+    { 0x2AAC,   4023 }, // CGM Specific Ops Control Point
+    { 0x2AAD,   4054 }, // Indoor Positioning Configuration
+    { 0x2AAE,   4087 }, // Latitude
+    { 0x2AAF,   4096 }, // Longitude
+    { 0x2AB0,   4106 }, // Local North Coordinate
+    { 0x2AB1,   4129 }, // Local East Coordinate
+    { 0x2AB2,   4151 }, // Floor Number
+    { 0x2AB3,   4164 }, // Altitude
+    { 0x2AB4,   4173 }, // Uncertainty
+    { 0x2AB5,   4185 }, // Location Name
+    { 0x2AB6,   4199 }, // URI
+    { 0x2AB7,   4203 }, // HTTP Headers
+    { 0x2AB8,   4216 }, // HTTP Status Code
+    { 0x2AB9,   4233 }, // HTTP Entity Body
+    { 0x2ABA,   4250 }, // HTTP Control Point
+    { 0x2ABB,   4269 }, // HTTPS Security
+    { 0x2ABC,   4284 }, // TDS Control Point
+    { 0x2ABD,   4302 }, // OTS Feature
+    { 0x2ABE,   4314 }, // Object Name
+    { 0x2ABF,   4326 }, // Object Type
+    { 0x2AC0,   4338 }, // Object Size
+    { 0x2AC1,   4350 }, // Object First-Created
+    { 0x2AC2,   4371 }, // Object Last-Modified
+    { 0x2AC3,   4392 }, // Object ID
+    { 0x2AC4,   4402 }, // Object Properties
+    { 0x2AC5,   4420 }, // Object Action Control Point
+    { 0x2AC6,   4448 }, // Object List Control Point
+    { 0x2AC7,   4474 }, // Object List Filter
+    { 0x2AC8,   4493 }, // Object Changed
+    { 0x2AC9,   4508 }, // Resolvable Private Address Only
+    { 0x2ACC,   4540 }, // Fitness Machine Feature
+    { 0x2ACD,   4564 }, // Treadmill Data
+    { 0x2ACE,   4579 }, // Cross Trainer Data
+    { 0x2ACF,   4598 }, // Step Climber Data
+    { 0x2AD0,   4616 }, // Stair Climber Data
+    { 0x2AD1,   4635 }, // Rower Data
+    { 0x2AD2,   4646 }, // Indoor Bike Data
+    { 0x2AD3,   4663 }, // Training Status
+    { 0x2AD4,   4679 }, // Supported Speed Range
+    { 0x2AD5,   4701 }, // Supported Inclination Range
+    { 0x2AD6,   4729 }, // Supported Resistance Level Range
+    { 0x2AD7,   4762 }, // Supported Heart Rate Range
+    { 0x2AD8,   4789 }, // Supported Power Range
+    { 0x2AD9,   4811 }, // Fitness Machine Control Point
+    { 0x2ADA,   4841 }, // Fitness Machine Status
+    { 0x2ADB,   4864 }, // Mesh Provisioning Data In
+    { 0x2ADC,   4890 }, // Mesh Provisioning Data Out
+    { 0x2ADD,   4917 }, // Mesh Proxy Data In
+    { 0x2ADE,   4936 }, // Mesh Proxy Data Out
+    { 0x2B29,   4956 }, // Client Supported Features
+    { 0x2B2A,   4982 }, // Database Hash
+    { 0x2B3A,   4996 }, // Server Supported Features
+};
+const size_t bt_an_characteristics_count = sizeof(bt_an_characteristics) / sizeof(bt_an_characteristics[0]);
+
+const bt_an_entry16_t bt_an_descriptors[] = {
+    { 0x2900,   5022 }, // Characteristic Extended Properties
+    { 0x2901,   5057 }, // Characteristic User Description
+    { 0x2902,   5089 }, // CCCD
+    { 0x2903,   5094 }, // Server Characteristic Configuration
+    { 0x2904,   5130 }, // Characteristic Presentation Format
+    { 0x2905,   5165 }, // Characteristic Aggregate Format
+    { 0x2906,   5197 }, // Valid Range
+    { 0x2907,   5209 }, // External Report Reference
+    { 0x2908,   5235 }, // Report Reference
+    { 0x2909,   5252 }, // Number of Digitals
+    { 0x290A,   5271 }, // Value Trigger Setting
+    { 0x290B,   5293 }, // Environmental Sensing Configuration
+    { 0x290C,   5329 }, // Environmental Sensing Measurement
+    { 0x290D,   5363 }, // Environmental Sensing Trigger Setting
+    { 0x290E,   5401 }, // Time Trigger Setting
+    { 0x290F,   5422 }, // Complete BR-EDR Transport Block Data
+    { 0x2910,   5459 }, // Observation Schedule
+    { 0x2911,   5480 }, // Valid Range and Accuracy
+};
+const size_t bt_an_descriptors_count = sizeof(bt_an_descriptors) / sizeof(bt_an_descriptors[0]);
+
+const bt_an_entry16_t bt_an_member_services[] = {
+    { 0xFD6F,   5505 }, // Exposure Notification
+    { 0xFE2C,   5527 }, // Google LLC
+    { 0xFE59,   5538 }, // Nordic Semiconductor ASA
+    { 0xFE95,   5563 }, // Xiaomi Inc.
+    { 0xFE9F,   5527 }, // Google LLC
+    { 0xFEAA,   5527 }, // Google LLC
+    { 0xFEC7,   5575 }, // Apple, Inc.
+    { 0xFEC8,   5575 }, // Apple, Inc.
+    { 0xFEC9,   5575 }, // Apple, Inc.
+    { 0xFEED,   5587 }, // Tile, Inc.
+};
+const size_t bt_an_member_services_count = sizeof(bt_an_member_services) / sizeof(bt_an_member_services[0]);
+
+const bt_an_entry16_t bt_an_companies[] = {
+    { 0x0000,   5598 }, // Ericsson AB
+    { 0x0001,   5610 }, // Nokia Mobile Phones
+    { 0x0002,   5630 }, // Intel Corp.
+    { 0x0003,   5642 }, // IBM Corp.
+    { 0x0004,   5652 }, // Toshiba Corp.
+    { 0x0005,   5666 }, // 3Com
+    { 0x0006,   5671 }, // Microsoft
+    { 0x0007,   5681 }, // Lucent
+    { 0x0008,   5688 }, // Motorola
+    { 0x0009,   5697 }, // Infineon Technologies AG
+    { 0x000A,   5722 }, // Qualcomm Technologies International, Ltd. (QTIL)
+    { 0x000B,   5771 }, // Silicon Wave
+    { 0x000C,   5784 }, // Digianswer A/S
+    { 0x000D,   5799 }, // Texas Instruments Inc.
+    { 0x000E,   5822 }, // Parthus Technologies Inc.
+    { 0x000F,   5848 }, // Broadcom Corporation
+    { 0x0010,   5869 }, // Mitel Semiconductor
+    { 0x0011,   5889 }, // Widcomm, Inc.
+    { 0x0012,   5903 }, // Zeevo, Inc.
+    { 0x0013,   5915 }, // Atmel Corporation
+    { 0x0014,   5933 }, // Mitsubishi Electric Corporation
+    { 0x0015,   5965 }, // RTX A/S
+    { 0x0016,   5973 }, // KC Technology Inc.
+    { 0x0017,   5992 }, // Newlogic
+    { 0x0018,   6001 }, // Transilica, Inc.
+    { 0x0019,   6018 }, // Rohde & Schwarz GmbH & Co. KG
+    { 0x001A,   6048 }, // TTPCom Limited
+    { 0x001B,   6063 }, // Signia Technologies, Inc.
+    { 0x001C,   6089 }, // Conexant Systems Inc.
+    { 0x001D,   6111 }, // Qualcomm
+    { 0x001E,   6120 }, // Inventel
+    { 0x001F,   6129 }, // AVM Berlin
+    { 0x0020,   6140 }, // BandSpeed, Inc.
+    { 0x0021,   6156 }, // Mansella Ltd
+    { 0x0022,   6169 }, // NEC Corporation
+    { 0x0023,   6185 }, // WavePlus Technology Co., Ltd.
+    { 0x0024,   6215 }, // Alcatel
+    { 0x0025,   6223 }, // NXP B.V.
+    { 0x0026,   6232 }, // C Technologies
+    { 0x0027,   6247 }, // Open Interface
+    { 0x0028,   6262 }, // R F Micro Devices
+    { 0x0029,   6280 }, // Hitachi Ltd
+    { 0x002A,   6292 }, // Symbol Technologies, Inc.
+    { 0x002B,   6318 }, // Tenovis
+    { 0x002C,   6326 }, // Macronix International Co. Ltd.
+    { 0x002D,   6358 }, // GCT Semiconductor
+    { 0x002E,   6376 }, // Norwood Systems
+    { 0x002F,   6392 }, // MewTel Technology Inc.
+    { 0x0030,   6415 }, // ST Microelectronics
+    { 0x0031,   6435 }, // Synopsys, Inc.
+    { 0x0032,   6450 }, // Red-M (Communications) Ltd
+    { 0x0033,   6477 }, // Commil Ltd
+    { 0x0034,   6488 }, // Computer Access Technology Corporation (CATC)
+    { 0x0035,   6534 }, // Eclipse (HQ Espana) S.L.
+    { 0x0036,   6559 }, // Renesas Electronics Corporation
+    { 0x0037,   6591 }, // Mobilian Corporation
+    { 0x0039,   6612 }, // Integrated System Solution Corp.
+    { 0x003A,   6645 }, // Panasonic Holdings Corporation
+    { 0x003B,   6676 }, // Gennum Corporation
+    { 0x003C,   6695 }, // BlackBerry Limited
+    { 0x003D,   6714 }, // IPextreme, Inc.
+    { 0x003E,   6730 }, // Systems and Chips, Inc
+    { 0x003F,   6753 }, // Bluetooth SIG, Inc
+    { 0x0040,   6772 }, // Seiko Epson Corporation
+    { 0x0041,   6796 }, // Integrated Silicon Solution Taiwan, Inc.
+    { 0x0042,   6837 }, // CONWISE Technology Corporation Ltd
+    { 0x0043,   6872 }, // PARROT AUTOMOTIVE SAS
+    { 0x0044,   6894 }, // Socket Mobile
+    { 0x0045,   6908 }, // Atheros Communications, Inc.
+    { 0x0046,   6937 }, // MediaTek, Inc.
+    { 0x0047,   6952 }, // Bluegiga
+    { 0x0048,   6961 }, // Marvell Technology Group Ltd.
+    { 0x0049,   6991 }, // 3DSP Corporation
+    { 0x004A,   7008 }, // Accel Semiconductor Ltd.
+    { 0x004B,   7033 }, // Continental Automotive Systems
+    { 0x004C,   5575 }, // Apple, Inc.
+    { 0x004D,   7064 }, // Staccato Communications, Inc.
+    { 0x004E,   7094 }, // Avago Technologies
+    { 0x004F,   7113 }, // APT Ltd.
+    { 0x0050,   7122 }, // SiRF Technology, Inc.
+    { 0x0051,   7144 }, // Tzero Technologies, Inc.
+    { 0x0052,   7169 }, // J&M Corporation
+    { 0x0053,   7185 }, // Free2move AB
+    { 0x0054,   7198 }, // 3DiJoy Corporation
+    { 0x0055,   7217 }, // Plantronics, Inc.
+    { 0x0056,   7235 }, // Sony Ericsson Mobile Communications
+    { 0x0057,   7271 }, // Harman International Industries, Inc.
+    { 0x0058,   7309 }, // Vizio, Inc.
+    { 0x0059,   5538 }, // Nordic Semiconductor ASA
+    { 0x005A,   7321 }, // EM Microelectronic-Marin SA
+    { 0x005B,   7349 }, // Ralink Technology Corporation
+    { 0x005C,   7379 }, // Belkin International, Inc.
+    { 0x005D,   7406 }, // Realtek Semiconductor Corporation
+    { 0x005E,   7440 }, // Stonestreet One, LLC
+    { 0x005F,   7461 }, // Wicentric, Inc.
+    { 0x0060,   7477 }, // RivieraWaves S.A.S
+    { 0x0061,   7496 }, // RDA Microelectronics
+    { 0x0062,   7517 }, // Gibson Guitars
+    { 0x0063,   7532 }, // MiCommand Inc.
+    { 0x0064,   7547 }, // Band XI International, LLC
+    { 0x0065,   7574 }, // HP, Inc.
+    { 0x0066,   7583 }, // 9Solutions Oy
+    { 0x0067,   7597 }, // GN Audio A/S
+    { 0x0068,   7610 }, // General Motors
+    { 0x0069,   7625 }, // A&D Engineering, Inc.
+    { 0x006A,   7647 }, // LTIMINDTREE LIMITED
+    { 0x006B,   7667 }, // Polar Electro OY
+    { 0x006C,   7684 }, // Beautiful Enterprise Co., Ltd.
+    { 0x006D,   7715 }, // BriarTek, Inc
+    { 0x006E,   7729 }, // Summit Data Communications, Inc.
+    { 0x006F,   7762 }, // Sound ID
+    { 0x0070,   7771 }, // Monster, LLC
+    { 0x0071,   7784 }, // connectBlue AB
+    { 0x0072,   7799 }, // ShangHai Super Smart Electronics Co. Ltd.
+    { 0x0073,   7841 }, // Group Sense Ltd.
+    { 0x0074,   7858 }, // Zomm, LLC
+    { 0x0075,   7868 }, // Samsung Electronics Co. Ltd.
+    { 0x0076,   7897 }, // Creative Technology Ltd.
+    { 0x0077,   7922 }, // Laird Connectivity LLC
+    { 0x0078,   7945 }, // Nike, Inc.
+    { 0x0079,   7956 }, // lesswire AG
+    { 0x007A,   7968 }, // MStar Semiconductor, Inc.
+    { 0x007B,   7994 }, // Hanlynn Technologies
+    { 0x007C,   8015 }, // A & R Cambridge
+    { 0x007D,   8031 }, // Seers Technology Co., Ltd.
+    { 0x007E,   8058 }, // Sports Tracking Technologies Ltd.
+    { 0x007F,   8092 }, // Autonet Mobile
+    { 0x0080,   8107 }, // DeLorme Publishing Company, Inc.
+    { 0x0081,   8140 }, // WuXi Vimicro
+    { 0x0082,   8153 }, // DSEA A/S
+    { 0x0083,   8162 }, // TimeKeeping Systems, Inc.
+    { 0x0084,   8188 }, // Ludus Helsinki Ltd.
+    { 0x0085,   8208 }, // BlueRadios, Inc.
+    { 0x0086,   8225 }, // Equinux AG
+    { 0x0087,   8236 }, // Garmin International, Inc.
+    { 0x0088,   8263 }, // Ecotest
+    { 0x0089,   8271 }, // GN Hearing A/S
+    { 0x008A,   8286 }, // Jawbone
+    { 0x008B,   8294 }, // Topcon Positioning Systems, LLC
+    { 0x008C,   8326 }, // Gimbal Inc.
+    { 0x008D,   8338 }, // Zscan Software
+    { 0x008E,   8353 }, // Quintic Corp
+    { 0x008F,   8366 }, // Telit Wireless Solutions GmbH
+    { 0x0090,   8396 }, // Funai Electric Co., Ltd.
+    { 0x0091,   8421 }, // Advanced PANMOBIL systems GmbH & Co.
+    { 0x0092,   8458 }, // ThinkOptics, Inc.
+    { 0x0093,   8476 }, // Universal Electronics, Inc.
+    { 0x0094,   8504 }, // Airoha Technology Corp.
+    { 0x0095,   8528 }, // NEC Lighting, Ltd.
+    { 0x0096,   8547 }, // ODM Technology, Inc.
+    { 0x0097,   8568 }, // ConnecteDevice Ltd.
+    { 0x0098,   8588 }, // zero1.tv GmbH
+    { 0x0099,   8602 }, // i.Tech Dynamic Global Distribution Ltd.
+    { 0x009A,   8642 }, // Alpwise
+    { 0x009B,   8650 }, // Jiangsu Toppower Automotive Electronics Co., Ltd.
+    { 0x009C,   8700 }, // Colorfy, Inc.
+    { 0x009D,   8714 }, // Geoforce Inc.
+    { 0x009E,   8728 }, // Bose Corporation
+    { 0x009F,   8745 }, // Suunto Oy
+    { 0x00A0,   8755 }, // Kensington Computer Products Group
+    { 0x00A1,   8790 }, // SR-Medizinelektronik
+    { 0x00A2,   8811 }, // Vertu Corporation Limited
+    { 0x00A3,   8837 }, // Meta Watch Ltd.
+    { 0x00A4,   8853 }, // LINAK A/S
+    { 0x00A5,   8863 }, // OTL Dynamics LLC
+    { 0x00A6,   8880 }, // Panda Ocean Inc.
+    { 0x00A7,   8897 }, // Visteon Corporation
+    { 0x00A8,   8917 }, // ARP Devices Limited
+    { 0x00A9,   8937 }, // MARELLI EUROPE S.P.A.
+    { 0x00AA,   8959 }, // CAEN RFID srl
+    { 0x00AB,   8973 }, // Ingenieur-Systemgruppe Zahn GmbH
+    { 0x00AC,   9006 }, // Green Throttle Games
+    { 0x00AD,   9027 }, // Peter Systemtechnik GmbH
+    { 0x00AE,   9052 }, // Omegawave Oy
+    { 0x00AF,   9065 }, // Cinetix
+    { 0x00B0,   9073 }, // Passif Semiconductor Corp
+    { 0x00B1,   9099 }, // Saris Cycling Group, Inc
+    { 0x00B2,   9124 }, // Bekey A/S
+    { 0x00B3,   9134 }, // Clarinox Technologies Pty. Ltd.
+    { 0x00B4,   9166 }, // BDE Technology Co., Ltd.
+    { 0x00B5,   9191 }, // Swirl Networks
+    { 0x00B6,   9206 }, // Meso international
+    { 0x00B7,   9225 }, // TreLab Ltd
+    { 0x00B8,   9236 }, // Qualcomm Innovation Center, Inc. (QuIC)
+    { 0x00B9,   9276 }, // Johnson Controls, Inc.
+    { 0x00BA,   9299 }, // Starkey Hearing Technologies
+    { 0x00BB,   9328 }, // S-Power Electronics Limited
+    { 0x00BC,   9356 }, // Ace Sensor Inc
+    { 0x00BD,   9371 }, // Aplix Corporation
+    { 0x00BE,   9389 }, // AAMP of America
+    { 0x00BF,   9405 }, // Stalmart Technology Limited
+    { 0x00C0,   9433 }, // AMICCOM Electronics Corporation
+    { 0x00C1,   9465 }, // Shenzhen Excelsecu Data Technology Co.,Ltd
+    { 0x00C2,   9508 }, // Geneq Inc.
+    { 0x00C3,   9519 }, // adidas AG
+    { 0x00C4,   9529 }, // LG Electronics
+    { 0x00C5,   9544 }, // Onset Computer Corporation
+    { 0x00C6,   9571 }, // Selfly BV
+    { 0x00C7,   9581 }, // Quuppa Oy.
+    { 0x00C8,   9592 }, // GeLo Inc
+    { 0x00C9,   9601 }, // Evluma
+    { 0x00CA,   9608 }, // MC10
+    { 0x00CB,   9613 }, // Binauric SE
+    { 0x00CC,   9625 }, // Beats Electronics
+    { 0x00CD,   9643 }, // Microchip Technology Inc.
+    { 0x00CE,   9669 }, // Eve Systems GmbH
+    { 0x00CF,   9686 }, // ARCHOS SA
+    { 0x00D0,   9696 }, // Dexcom, Inc.
+    { 0x00D1,   9709 }, // Polar Electro Europe B.V.
+    { 0x00D2,   9735 }, // Dialog Semiconductor B.V.
+    { 0x00D3,   9761 }, // Taixingbang Technology (HK) Co,. LTD.
+    { 0x00D4,   9799 }, // Kawantech
+    { 0x00D5,   9809 }, // Austco Communication Systems
+    { 0x00D6,   9838 }, // Timex Group USA, Inc.
+    { 0x00D7,   9860 }, // Qualcomm Technologies, Inc.
+    { 0x00D8,   9888 }, // Qualcomm Connected Experiences, Inc.
+    { 0x00D9,   9925 }, // Voyetra Turtle Beach
+    { 0x00DA,   9946 }, // txtr GmbH
+    { 0x00DC,   9956 }, // Procter & Gamble
+    { 0x00DD,   9973 }, // Hosiden Corporation
+    { 0x00DE,   9993 }, // Muzik LLC
+    { 0x00DF,  10003 }, // Misfit Wearables Corp
+    { 0x00E0,  10025 }, // Google
+    { 0x0131,  10032 }, // Cypress Semiconductor
+    { 0x0157,  10054 }, // Anhui Huami Information Technology Co., Ltd.
+    { 0x0171,  10099 }, // Amazon.com Services LLC
+    { 0x027D,  10123 }, // HUAWEI Technologies Co., Ltd.
+    { 0x02E5,  10153 }, // Espressif Systems (Shanghai) Co., Ltd.
+    { 0x038F,   5563 }, // Xiaomi Inc.
+    { 0x0499,  10192 }, // Ruuvi Innovations Ltd.
+};
+const size_t bt_an_companies_count = sizeof(bt_an_companies) / sizeof(bt_an_companies[0]);
+
+const bt_an_entry16_t bt_an_appearances[] = {
+    { 0x0000,  10215 }, // Unknown
+    { 0x0040,  10223 }, // Phone
+    { 0x0080,  10229 }, // Computer
+    { 0x0081,  10238 }, // Desktop Workstation
+    { 0x0082,  10258 }, // Server-class Computer
+    { 0x0083,  10280 }, // Laptop
+    { 0x0084,  10287 }, // Handheld PC/PDA (clamshell)
+    { 0x0085,  10315 }, // Palm-size PC/PDA
+    { 0x0086,  10332 }, // Wearable computer (watch size)
+    { 0x0087,  10363 }, // Tablet
+    { 0x0088,  10370 }, // Docking Station
+    { 0x0089,  10386 }, // All in One
+    { 0x008A,  10397 }, // Blade Server
+    { 0x008B,  10410 }, // Convertible
+    { 0x008C,  10422 }, // Detachable
+    { 0x008D,  10433 }, // IoT Gateway
+    { 0x008E,  10445 }, // Mini PC
+    { 0x008F,  10453 }, // Stick PC
+    { 0x00C0,  10462 }, // Watch
+    { 0x00C1,  10468 }, // Sports Watch
+    { 0x00C2,  10481 }, // Smartwatch
+    { 0x0100,  10492 }, // Clock
+    { 0x0140,  10498 }, // Display
+    { 0x0180,  10506 }, // Remote Control
+    { 0x01C0,  10521 }, // Eye-glasses
+    { 0x0200,  10533 }, // Tag
+    { 0x0240,  10537 }, // Keyring
+    { 0x0280,  10545 }, // Media Player
+    { 0x02C0,  10558 }, // Barcode Scanner
+    { 0x0300,  10574 }, // Thermometer
+    { 0x0301,  10586 }, // Ear Thermometer
+    { 0x0340,  10602 }, // Heart Rate Sensor
+    { 0x0341,  10620 }, // Heart Rate Belt
+    { 0x0380,    172 }, // Blood Pressure
+    { 0x0381,  10636 }, // Arm Blood Pressure
+    { 0x0382,  10655 }, // Wrist Blood Pressure
+    { 0x03C0,  10676 }, // Human Interface Device
+    { 0x03C1,  10699 }, // Keyboard
+    { 0x03C2,  10708 }, // Mouse
+    { 0x03C3,  10714 }, // Joystick
+    { 0x03C4,  10723 }, // Gamepad
+    { 0x03C5,  10731 }, // Digitizer Tablet
+    { 0x03C6,  10748 }, // Card Reader
+    { 0x03C7,  10760 }, // Digital Pen
+    { 0x03C8,  10558 }, // Barcode Scanner
+    { 0x03C9,  10772 }, // Touchpad
+    { 0x03CA,  10781 }, // Presentation Remote
+    { 0x0400,  10801 }, // Glucose Meter
+    { 0x0440,  10815 }, // Running Walking Sensor
+    { 0x0441,  10838 }, // In-Shoe Running Walking Sensor
+    { 0x0442,  10869 }, // On-Shoe Running Walking Sensor
+    { 0x0443,  10900 }, // On-Hip Running Walking Sensor
+    { 0x0480,  10930 }, // Cycling
+    { 0x0481,  10938 }, // Cycling Computer
+    { 0x0482,  10955 }, // Speed Sensor
+    { 0x0483,  10968 }, // Cadence Sensor
+    { 0x0484,  10983 }, // Power Sensor
+    { 0x0485,  10996 }, // Speed and Cadence Sensor
+    { 0x04C0,  11021 }, // Control Device
+    { 0x0500,  11036 }, // Network Device
+    { 0x0540,  11051 }, // Sensor
+    { 0x0580,  11058 }, // Light Fixtures
+    { 0x05C0,  11073 }, // Fan
+    { 0x0600,  11077 }, // HVAC
+    { 0x0640,  11082 }, // Air Conditioning
+    { 0x0680,  11099 }, // Humidifier
+    { 0x06C0,  11110 }, // Heating
+    { 0x0700,  11118 }, // Access Control
+    { 0x0740,  11133 }, // Motorized Device
+    { 0x0780,  11150 }, // Power Device
+    { 0x07C0,  11163 }, // Light Source
+    { 0x0800,  11176 }, // Window Covering
+    { 0x0840,  11192 }, // Audio Sink
+    { 0x0841,  11203 }, // Standalone Speaker
+    { 0x0842,  11222 }, // Soundbar
+    { 0x0843,  11231 }, // Bookshelf Speaker
+    { 0x0844,  11249 }, // Standmounted Speaker
+    { 0x0845,  11270 }, // Speakerphone
+    { 0x0880,  11283 }, // Audio Source
+    { 0x0881,  11296 }, // Microphone
+    { 0x0882,  11307 }, // Alarm
+    { 0x0883,  11313 }, // Bell
+    { 0x0884,  11318 }, // Horn
+    { 0x0885,  11323 }, // Broadcasting Device
+    { 0x0886,  11343 }, // Service Desk
+    { 0x0887,  11356 }, // Kiosk
+    { 0x0888,  11362 }, // Broadcasting Room
+    { 0x0889,  11380 }, // Auditorium
+    { 0x08C0,  11391 }, // Motorized Vehicle
+    { 0x0900,  11409 }, // Domestic Appliance
+    { 0x0940,  11428 }, // Wearable Audio Device
+    { 0x0941,  11450 }, // Earbud
+    { 0x0942,  11457 }, // Headset
+    { 0x0943,  11465 }, // Headphones
+    { 0x0944,  11476 }, // Neck Band
+    { 0x0980,  11486 }, // Aircraft
+    { 0x09C0,  11495 }, // AV Equipment
+    { 0x0A00,  11508 }, // Display Equipment
+    { 0x0A40,  11526 }, // Hearing aid
+    { 0x0A41,  11538 }, // In-ear hearing aid
+    { 0x0A42,  11557 }, // Behind-ear hearing aid
+    { 0x0A43,  11580 }, // Cochlear Implant
+    { 0x0A80,  11597 }, // Gaming
+    { 0x0A81,  11604 }, // Home Video Game Console
+    { 0x0A82,  11628 }, // Portable handheld console
+    { 0x0AC0,  11654 }, // Signage
+    { 0x0C40,    463 }, // Pulse Oximeter
+    { 0x0C41,  11662 }, // Fingertip Pulse Oximeter
+    { 0x0C42,  11687 }, // Wrist Worn Pulse Oximeter
+    { 0x0C80,    359 }, // Weight Scale
+    { 0x0CC0,  11713 }, // Personal Mobility Device
+    { 0x0D00,  11738 }, // Continuous Glucose Monitor
+    { 0x0D40,  11765 }, // Insulin Pump
+    { 0x0D80,  11778 }, // Medication Delivery
+    { 0x0DC0,  11798 }, // Spirometer
+    { 0x1440,  11809 }, // Outdoor Sports Activity
+    { 0x1441,  11833 }, // Location Display
+    { 0x1442,  11850 }, // Location and Navigation Display
+    { 0x1443,  11882 }, // Location Pod
+    { 0x1444,  11895 }, // Location and Navigation Pod
+};
+const size_t bt_an_appearances_count = sizeof(bt_an_appearances) / sizeof(bt_an_appearances[0]);
+
+const bt_an_entry128_t bt_an_vendor_uuids[] = {
+    { { 0x00, 0x00, 0x15, 0x30, 0x12, 0x12, 0xEF, 0xDE, 0x15, 0x23, 0x78, 0x5F, 0xEA, 0xBC, 0xD1, 0x23 }, 11923 }, // Nordic Legacy DFU
+    { { 0x00, 0x00, 0x15, 0x31, 0x12, 0x12, 0xEF, 0xDE, 0x15, 0x23, 0x78, 0x5F, 0xEA, 0xBC, 0xD1, 0x23 }, 11941 }, // Nordic DFU Control
+    { { 0x00, 0x00, 0x15, 0x32, 0x12, 0x12, 0xEF, 0xDE, 0x15, 0x23, 0x78, 0x5F, 0xEA, 0xBC, 0xD1, 0x23 }, 11960 }, // Nordic DFU Packet
+    { { 0x22, 0xEA, 0xC6, 0xE9, 0x24, 0xD6, 0x4B, 0xB5, 0xBE, 0x44, 0xB3, 0x6A, 0xCE, 0x7C, 0x7B, 0xFB }, 11978 }, // ANCS Data Source
+    { { 0x69, 0xD1, 0xD8, 0xF3, 0x45, 0xE1, 0x49, 0xA8, 0x98, 0x21, 0x9B, 0xBD, 0xFD, 0xAA, 0xD9, 0xD9 }, 11995 }, // ANCS Control Point
+    { { 0x6E, 0x40, 0x00, 0x01, 0xB5, 0xA3, 0xF3, 0x93, 0xE0, 0xA9, 0xE5, 0x0E, 0x24, 0xDC, 0xCA, 0x9E }, 12014 }, // Nordic UART
+    { { 0x6E, 0x40, 0x00, 0x02, 0xB5, 0xA3, 0xF3, 0x93, 0xE0, 0xA9, 0xE5, 0x0E, 0x24, 0xDC, 0xCA, 0x9E }, 12026 }, // Nordic UART RX
+    { { 0x6E, 0x40, 0x00, 0x03, 0xB5, 0xA3, 0xF3, 0x93, 0xE0, 0xA9, 0xE5, 0x0E, 0x24, 0xDC, 0xCA, 0x9E }, 12041 }, // Nordic UART TX
+    { { 0x79, 0x05, 0xF4, 0x31, 0xB5, 0xCE, 0x4E, 0x99, 0xA4, 0x0F, 0x4B, 0x1E, 0x12, 0x2D, 0x00, 0xD0 }, 12056 }, // Apple ANCS
+    { { 0x86, 0x67, 0x55, 0x6C, 0x9A, 0x37, 0x4C, 0x91, 0x84, 0xED, 0x54, 0xEE, 0x27, 0xD9, 0x00, 0x49 }, 12067 }, // Continuity Char.
+    { { 0x89, 0xD3, 0x50, 0x2B, 0x0F, 0x36, 0x43, 0x3A, 0x8E, 0xF4, 0xC5, 0x02, 0xAD, 0x55, 0xF8, 0xDC }, 12084 }, // Apple Media Service
+    { { 0x8E, 0xC9, 0x00, 0x01, 0xF3, 0x15, 0x4F, 0x60, 0x9F, 0xB8, 0x83, 0x88, 0x30, 0xDA, 0xEA, 0x50 }, 12104 }, // Buttonless DFU
+    { { 0x9F, 0xA4, 0x80, 0xE0, 0x49, 0x67, 0x45, 0x42, 0x93, 0x90, 0xD3, 0x43, 0xDC, 0x5D, 0x04, 0xAE }, 12119 }, // Apple Nearby
+    { { 0x9F, 0xBF, 0x12, 0x0D, 0x63, 0x01, 0x42, 0xD9, 0x8C, 0x58, 0x25, 0xE6, 0x99, 0xA2, 0x1D, 0xBD }, 12132 }, // ANCS Notif. Source
+    { { 0xAF, 0x0B, 0xAD, 0xB1, 0x5B, 0x99, 0x43, 0xCD, 0x91, 0x7A, 0xA7, 0x7B, 0xC5, 0x49, 0xE3, 0xCC }, 12151 }, // Nearby Char.
+    { { 0xD0, 0x61, 0x1E, 0x78, 0xBB, 0xB4, 0x45, 0x91, 0xA5, 0xF8, 0x48, 0x79, 0x10, 0xAE, 0x43, 0x66 }, 12164 }, // Apple Continuity
+};
+const size_t bt_an_vendor_uuids_count = sizeof(bt_an_vendor_uuids) / sizeof(bt_an_vendor_uuids[0]);
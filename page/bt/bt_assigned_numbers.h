@@ -0,0 +1,58 @@
+#ifndef BT_ASSIGNED_NUMBERS_H
+#define BT_ASSIGNED_NUMBERS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Bluetooth SIG assigned numbers, generated into page/bt/bt_assigned_numbers.c
+ * by scripts/gen_bt_assigned_numbers.py. Every table is const, sorted by key
+ * and stores names as offsets into one string pool, so it all ends up in
+ * .rodata without relocations. Use the lookups in bt_uuid_registry.h.
+ *
+ * The checked-in tables are a subset of the SIG lists (counts in the .c
+ * header); unknown IDs fall back to their hex form.
+ */
+
+typedef struct {
+    uint16_t id;
+    uint32_t name;      // offset into bt_an_names
+} bt_an_entry16_t;
+
+typedef struct {
+    uint8_t uuid[16];   // big-endian, as written in the textual form
+    uint32_t name;
+} bt_an_entry128_t;
+
+extern const char bt_an_names[];
+
+extern const bt_an_entry16_t bt_an_services[];
+extern const size_t bt_an_services_count;
+
+extern const bt_an_entry16_t bt_an_characteristics[];
+extern const size_t bt_an_characteristics_count;
+
+extern const bt_an_entry16_t bt_an_descriptors[];
+extern const size_t bt_an_descriptors_count;
+
+extern const bt_an_entry16_t bt_an_member_services[];
+extern const size_t bt_an_member_services_count;
+
+extern const bt_an_entry16_t bt_an_companies[];
+extern const size_t bt_an_companies_count;
+
+extern const bt_an_entry16_t bt_an_appearances[];
+extern const size_t bt_an_appearances_count;
+
+extern const bt_an_entry128_t bt_an_vendor_uuids[];
+extern const size_t bt_an_vendor_uuids_count;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BT_ASSIGNED_NUMBERS_H */
@@ -0,0 +1,599 @@
+#include "bt_char_view.h"
+#include "bt_controller.h"
+#include "bt_uuid_registry.h"
+#include "bt_value_ring.h"
+#include "components/ui_info_panel.h"
+#include "components/ui_pills.h"
+#include "components/ui_theme.h"
+#include "utils/string_utils.h"
+#include "config.h"
+
+#include <ctype.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#define LIVE_PERIOD_MS      100     // UI refresh, independent of the notification rate
+#define RATE_WINDOW_MS      1000
+#define TPUT_DURATION_MS    10000
+
+static lv_obj_t *page_ref = NULL;
+
+typedef struct {
+    ui_info_panel *char_info;
+
+    lv_obj_t *hex_label;
+    lv_obj_t *text_label;
+    lv_obj_t *rate_label;
+    lv_obj_t *count_label;
+    lv_obj_t *status_label;
+
+    lv_obj_t *read_btn;
+    lv_obj_t *subscribe_btn;
+    lv_obj_t *write_section;
+    lv_obj_t *write_input;
+    lv_obj_t *write_btn;
+    lv_obj_t *write_nr_btn;
+    lv_obj_t *keyboard;
+
+    lv_obj_t *tput_section;
+    ui_pills *tput_mode;
+    lv_obj_t *tput_btn;
+    lv_obj_t *tput_label;
+} view_ctx;
+
+static view_ctx own_ctx;
+
+/*
+ * What the page is showing. The characteristic is looked up again by handle
+ * on every tick, and only while the GATT db generation is the one it was
+ * opened with: a reconnect rebuilds the table and frees the old nodes.
+ */
+static struct {
+    int conn_id;
+    unsigned int handle;
+    unsigned int generation;
+    bool gone;
+
+    lv_timer_t *timer;
+    uint32_t window_start_ms;
+    uint32_t window_received;
+    uint32_t shown_received;
+    bool shown_subscribed;
+} live;
+
+static lv_obj_t *create_action_btn(lv_obj_t *parent, const char *text, lv_event_cb_t cb)
+{
+    lv_obj_t *btn = lv_btn_create(parent);
+    lv_obj_set_size(btn, LV_SIZE_CONTENT, 34);
+    lv_obj_set_style_bg_color(btn, ZV_COLOR_BG_PANEL, 0);
+    lv_obj_set_style_bg_opa(btn, LV_OPA_COVER, 0);
+    lv_obj_set_style_border_width(btn, 2, 0);
+    lv_obj_set_style_border_color(btn, ZV_COLOR_BORDER, 0);
+    lv_obj_set_style_radius(btn, 10, 0);
+    lv_obj_add_event_cb(btn, cb, LV_EVENT_CLICKED, NULL);
+
+    lv_obj_t *label = lv_label_create(btn);
+    lv_label_set_text(label, text);
+    lv_obj_set_style_text_color(label, ZV_COLOR_TEXT_MAIN, 0);
+    lv_obj_center(label);
+
+    return btn;
+}
+
+static void set_btn_text(lv_obj_t *btn, const char *text)
+{
+    lv_obj_t *label = btn ? lv_obj_get_child(btn, 0) : NULL;
+    if (label)
+        lv_label_set_text(label, text);
+}
+
+static void show_if(lv_obj_t *obj, bool visible)
+{
+    if (!obj)
+        return;
+
+    if (visible) lv_obj_clear_flag(obj, LV_OBJ_FLAG_HIDDEN);
+    else         lv_obj_add_flag(obj, LV_OBJ_FLAG_HIDDEN);
+}
+
+static void set_status(const char *text)
+{
+    if (own_ctx.status_label)
+        lv_label_set_text(own_ctx.status_label, text);
+}
+
+static const bt_characteristic_t *current_char(void)
+{
+    if (live.gone)
+        return NULL;
+
+    // A released slot has no db; a reused one has a new generation.
+    const bt_gatt_db *db = bt_get_gatt_db(live.conn_id);
+    if (!db || db->generation != live.generation || bt_get_conn_status(live.conn_id) != BT_CONN_READY)
+    {
+        live.gone = true;
+        set_status("Disconnected");
+        show_if(own_ctx.read_btn, false);
+        show_if(own_ctx.subscribe_btn, false);
+        show_if(own_ctx.write_section, false);
+        show_if(own_ctx.tput_section, false);
+        return NULL;
+    }
+
+    return bt_gatt_find_characteristic(live.conn_id, live.handle);
+}
+
+static uint32_t now_ms(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000u + (uint64_t)ts.tv_nsec / 1000000u);
+}
+
+static void render_value(const bt_value_t *value)
+{
+    size_t shown = value->len < BT_VALUE_MAX_LEN ? value->len : BT_VALUE_MAX_LEN;
+
+    char hex[BT_VALUE_MAX_LEN * 2 + 16];
+    zv_hex_encode(value->data, shown, hex, sizeof(hex));
+    if (value->len > shown)
+    {
+        size_t used = strlen(hex);
+        snprintf(hex + used, sizeof(hex) - used, " (+%u)", (unsigned)(value->len - shown));
+    }
+    lv_label_set_text(own_ctx.hex_label, value->len ? hex : "(empty)");
+
+    char text[BT_VALUE_MAX_LEN + 1];
+    for (size_t i = 0; i < shown; i++)
+        text[i] = isprint(value->data[i]) ? (char)value->data[i] : '.';
+    text[shown] = '\0';
+    lv_label_set_text(own_ctx.text_label, text);
+}
+
+/*
+ * Runs every LIVE_PERIOD_MS while the page is on screen. However many values
+ * arrived since the last tick, only the newest is formatted, so a sensor
+ * notifying at hundreds of Hz costs the same redraw as one at 1 Hz.
+ */
+static void live_timer_cb(lv_timer_t *t)
+{
+    (void)t;
+
+    const bt_characteristic_t *ch = current_char();
+    if (!ch)
+        return;
+
+    bt_value_ring_t *ring = bt_gatt_value_ring(live.conn_id, live.handle);
+
+    bt_value_t latest;
+    if (ring && bt_value_ring_drain_latest(ring, &latest) > 0)
+        render_value(&latest);
+
+    uint32_t received = bt_value_ring_received(ring);
+    uint32_t now = now_ms();
+    uint32_t elapsed = now - live.window_start_ms;
+    if (elapsed >= RATE_WINDOW_MS)
+    {
+        unsigned int rate_x10 = (unsigned int)((uint64_t)(received - live.window_received) * 10000u / elapsed);
+        lv_label_set_text_fmt(own_ctx.rate_label, "%u.%u /s", rate_x10 / 10, rate_x10 % 10);
+        live.window_start_ms = now;
+        live.window_received = received;
+    }
+
+    if (received != live.shown_received)
+    {
+        lv_label_set_text_fmt(own_ctx.count_label, "%u (%u dropped)",
+                              (unsigned)received, (unsigned)bt_value_ring_dropped(ring));
+        live.shown_received = received;
+    }
+
+    if (ch->subscribed != live.shown_subscribed)
+    {
+        set_btn_text(own_ctx.subscribe_btn, ch->subscribed ? "Unsubscribe" : "Subscribe");
+        live.shown_subscribed = ch->subscribed;
+    }
+}
+
+static void on_gatt_op(int conn_id, bt_gatt_op_t op, unsigned int handle, bool ok, const char *info)
+{
+    if (conn_id != live.conn_id || handle != live.handle || live.gone)
+        return;
+
+    static const char *const names[] = { "Read", "Write", "Subscribe" };
+    char text[64];
+    if (ok)
+        snprintf(text, sizeof(text), "%s OK", names[op]);
+    else
+        snprintf(text, sizeof(text), "%s failed: %s", names[op], info && info[0] ? info : "?");
+    set_status(text);
+}
+
+static void format_tput(const bt_tput_result_t *r, char *out, size_t out_size)
+{
+    unsigned int kbps = bt_tput_kbps(r);
+    unsigned int secs_x10 = r->elapsed_ms / 100;
+    int interval_x10 = r->link.interval_units * 25 / 2;
+
+    snprintf(out, out_size, "%u kbit/s  %u pkts  %u.%u s\nMTU %d  LL %d  %d.%d ms  %u errors",
+             kbps, (unsigned)r->packets, secs_x10 / 10, secs_x10 % 10,
+             r->link.mtu, r->link.tx_octets, interval_x10 / 10, interval_x10 % 10, (unsigned)r->errors);
+}
+
+static void on_tput(const bt_tput_result_t *result, bool done, const char *error)
+{
+    if (!own_ctx.tput_label || result->conn_id != live.conn_id || result->handle != live.handle)
+        return;
+
+    if (done)
+        set_btn_text(own_ctx.tput_btn, "Start");
+
+    if (error) {
+        lv_label_set_text_fmt(own_ctx.tput_label, "Test failed: %s", error[0] ? error : "?");
+        return;
+    }
+
+    char text[128];
+    format_tput(result, text, sizeof(text));
+    lv_label_set_text(own_ctx.tput_label, text);
+}
+
+static void on_tput_click(lv_event_t *e)
+{
+    (void)e;
+
+    if (bt_tput_running()) {
+        bt_tput_stop();
+        return;
+    }
+
+    bt_tput_mode_t mode = pills_get_active(own_ctx.tput_mode) == 1 ? BT_TPUT_NOTIFY : BT_TPUT_READ;
+    if (bt_tput_start(live.conn_id, live.handle, mode, TPUT_DURATION_MS) != UART_OK) {
+        lv_label_set_text(own_ctx.tput_label, "Test not started");
+        return;
+    }
+
+    set_btn_text(own_ctx.tput_btn, "Stop");
+    lv_label_set_text(own_ctx.tput_label, "Running...");
+}
+
+static void on_read_click(lv_event_t *e)
+{
+    (void)e;
+    if (bt_gatt_read(live.conn_id, live.handle) != UART_OK)
+        set_status("Read not sent");
+}
+
+static void on_subscribe_click(lv_event_t *e)
+{
+    (void)e;
+
+    const bt_characteristic_t *ch = current_char();
+    if (!ch)
+        return;
+
+    if (bt_gatt_subscribe(live.conn_id, live.handle, !ch->subscribed) != UART_OK)
+        set_status("Subscribe not sent");
+}
+
+static void write_value(bool with_response)
+{
+    uint8_t value[BT_GATT_WRITE_MAX_LEN];
+    const char *hex = lv_textarea_get_text(own_ctx.write_input);
+    int len = zv_hex_decode(hex, value, sizeof(value));
+    if (len < 0) {
+        set_status("Value must be hex");
+        return;
+    }
+
+    if (bt_gatt_write(live.conn_id, live.handle, value, (size_t)len, with_response) != UART_OK)
+        set_status("Write not sent");
+}
+
+static void on_write_click(lv_event_t *e)
+{
+    (void)e;
+    write_value(true);
+}
+
+static void on_write_nr_click(lv_event_t *e)
+{
+    (void)e;
+    write_value(false);
+}
+
+static void keyboard_hide(void)
+{
+    if (!own_ctx.keyboard)
+        return;
+
+    lv_group_t *group = lv_obj_get_group(own_ctx.keyboard);
+    if (group)
+    {
+        lv_group_set_editing(group, false);
+        lv_group_remove_obj(own_ctx.keyboard);
+        lv_group_focus_obj(own_ctx.write_input);
+    }
+
+    lv_obj_add_flag(own_ctx.keyboard, LV_OBJ_FLAG_HIDDEN);
+    lv_keyboard_set_textarea(own_ctx.keyboard, NULL);
+}
+
+static void keyboard_show(void)
+{
+    if (!own_ctx.keyboard)
+        return;
+
+    lv_keyboard_set_textarea(own_ctx.keyboard, own_ctx.write_input);
+    lv_obj_clear_flag(own_ctx.keyboard, LV_OBJ_FLAG_HIDDEN);
+    lv_obj_move_foreground(own_ctx.keyboard);
+
+    lv_group_t *group = lv_obj_get_group(own_ctx.write_input);
+    if (group)
+    {
+        if (!lv_obj_get_group(own_ctx.keyboard))
+            lv_group_add_obj(group, own_ctx.keyboard);
+        lv_group_focus_obj(own_ctx.keyboard);
+        lv_group_set_editing(group, true);
+    }
+}
+
+static void keyboard_event_cb(lv_event_t *e)
+{
+    lv_event_code_t code = lv_event_get_code(e);
+    if (code == LV_EVENT_READY || code == LV_EVENT_CANCEL)
+        keyboard_hide();
+}
+
+static void write_input_event_cb(lv_event_t *e)
+{
+    if (lv_event_get_code(e) == LV_EVENT_KEY && lv_event_get_key(e) != LV_KEY_ENTER)
+        return;
+
+    keyboard_show();
+}
+
+static void on_page_changed(lv_event_t *e)
+{
+    lv_obj_t *menu = (lv_obj_t *)lv_event_get_target(e);
+    lv_obj_t *cur = lv_menu_get_cur_main_page(menu);
+
+    if (!live.timer)
+        return;
+
+    if (cur == page_ref) {
+        lv_timer_resume(live.timer);
+        return;
+    }
+
+    lv_timer_pause(live.timer);
+    keyboard_hide();
+}
+
+static lv_obj_t *create_section_title(lv_obj_t *parent, const char *text)
+{
+    lv_obj_t *title = lv_label_create(parent);
+    lv_label_set_text(title, text);
+    lv_obj_set_style_text_color(title, ZV_COLOR_TERMINAL, 0);
+    lv_obj_set_style_text_font(title, &lv_font_montserrat_10, 0);
+    lv_obj_set_style_text_letter_space(title, 2, 0);
+    lv_obj_set_width(title, LV_PCT(100));
+    lv_obj_set_style_border_color(title, ZV_COLOR_BORDER, 0);
+    lv_obj_set_style_border_width(title, 1, 0);
+    lv_obj_set_style_border_side(title, LV_BORDER_SIDE_BOTTOM, 0);
+    lv_obj_set_style_pad_bottom(title, 3, 0);
+    return title;
+}
+
+static lv_obj_t *create_row(lv_obj_t *parent)
+{
+    lv_obj_t *row = lv_obj_create(parent);
+    lv_obj_remove_style_all(row);
+    lv_obj_set_size(row, LV_PCT(100), LV_SIZE_CONTENT);
+    lv_obj_set_style_pad_column(row, 8, 0);
+    lv_obj_clear_flag(row, LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_set_layout(row, LV_LAYOUT_FLEX);
+    lv_obj_set_flex_flow(row, LV_FLEX_FLOW_ROW);
+    lv_obj_set_flex_align(row, LV_FLEX_ALIGN_START, LV_FLEX_ALIGN_CENTER, LV_FLEX_ALIGN_CENTER);
+    return row;
+}
+
+static lv_obj_t *create_value_row(ui_info_panel *panel, const char *label)
+{
+    lv_obj_t *right = add_info_panel_custom_row(panel, label);
+    if (!right)
+        return NULL;
+
+    lv_obj_t *value = lv_label_create(right);
+    lv_label_set_text(value, "-");
+    lv_label_set_long_mode(value, LV_LABEL_LONG_WRAP);
+    lv_obj_set_width(value, LV_PCT(100));
+    lv_obj_set_style_text_align(value, LV_TEXT_ALIGN_RIGHT, 0);
+    lv_obj_set_style_text_font(value, &lv_font_montserrat_12, 0);
+    lv_obj_set_style_text_color(value, ZV_COLOR_TEXT_MAIN, 0);
+    return value;
+}
+
+static void create_write_section(lv_obj_t *root)
+{
+    own_ctx.write_section = lv_obj_create(root);
+    lv_obj_remove_style_all(own_ctx.write_section);
+    lv_obj_set_size(own_ctx.write_section, LV_PCT(100), LV_SIZE_CONTENT);
+    lv_obj_set_style_pad_row(own_ctx.write_section, 8, 0);
+    lv_obj_clear_flag(own_ctx.write_section, LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_set_layout(own_ctx.write_section, LV_LAYOUT_FLEX);
+    lv_obj_set_flex_flow(own_ctx.write_section, LV_FLEX_FLOW_COLUMN);
+
+    create_section_title(own_ctx.write_section, "WRITE");
+
+    own_ctx.write_input = lv_textarea_create(own_ctx.write_section);
+    lv_obj_set_width(own_ctx.write_input, LV_PCT(100));
+    lv_obj_set_height(own_ctx.write_input, 34);
+    lv_textarea_set_one_line(own_ctx.write_input, true);
+    lv_textarea_set_accepted_chars(own_ctx.write_input, "0123456789abcdefABCDEF");
+    lv_textarea_set_max_length(own_ctx.write_input, BT_GATT_WRITE_MAX_LEN * 2);
+    lv_textarea_set_placeholder_text(own_ctx.write_input, "Hex value, e.g. 0100");
+    lv_obj_set_style_bg_color(own_ctx.write_input, ZV_COLOR_BG_PANEL, 0);
+    lv_obj_set_style_bg_opa(own_ctx.write_input, LV_OPA_COVER, 0);
+    lv_obj_set_style_border_width(own_ctx.write_input, 2, 0);
+    lv_obj_set_style_border_color(own_ctx.write_input, ZV_COLOR_BORDER, 0);
+    lv_obj_set_style_radius(own_ctx.write_input, 10, 0);
+    lv_obj_set_style_text_color(own_ctx.write_input, ZV_COLOR_TEXT_MAIN, 0);
+    lv_obj_set_style_text_color(own_ctx.write_input, ZV_COLOR_TEXT_MUTED, LV_PART_TEXTAREA_PLACEHOLDER);
+    lv_obj_add_event_cb(own_ctx.write_input, write_input_event_cb, LV_EVENT_CLICKED, NULL);
+    lv_obj_add_event_cb(own_ctx.write_input, write_input_event_cb, LV_EVENT_KEY, NULL);
+
+    lv_obj_t *row = create_row(own_ctx.write_section);
+    own_ctx.write_btn = create_action_btn(row, "Write", on_write_click);
+    own_ctx.write_nr_btn = create_action_btn(row, "Write NR", on_write_nr_click);
+
+    const zv_config *cfg = config_get();
+    if (cfg && cfg->ir.use_on_screen_keyboard)
+    {
+        // Top layer so the menu page does not clip it.
+        own_ctx.keyboard = lv_keyboard_create(lv_layer_top());
+        lv_obj_set_size(own_ctx.keyboard, lv_pct(100), 120);
+        lv_obj_align(own_ctx.keyboard, LV_ALIGN_BOTTOM_MID, 0, 0);
+        lv_keyboard_set_mode(own_ctx.keyboard, LV_KEYBOARD_MODE_TEXT_UPPER);
+        lv_obj_add_flag(own_ctx.keyboard, LV_OBJ_FLAG_HIDDEN);
+        lv_obj_add_event_cb(own_ctx.keyboard, keyboard_event_cb, LV_EVENT_READY, NULL);
+        lv_obj_add_event_cb(own_ctx.keyboard, keyboard_event_cb, LV_EVENT_CANCEL, NULL);
+    }
+}
+
+static void create_tput_section(lv_obj_t *root)
+{
+    own_ctx.tput_section = lv_obj_create(root);
+    lv_obj_remove_style_all(own_ctx.tput_section);
+    lv_obj_set_size(own_ctx.tput_section, LV_PCT(100), LV_SIZE_CONTENT);
+    lv_obj_set_style_pad_row(own_ctx.tput_section, 8, 0);
+    lv_obj_clear_flag(own_ctx.tput_section, LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_set_layout(own_ctx.tput_section, LV_LAYOUT_FLEX);
+    lv_obj_set_flex_flow(own_ctx.tput_section, LV_FLEX_FLOW_COLUMN);
+
+    create_section_title(own_ctx.tput_section, "THROUGHPUT");
+
+    lv_obj_t *row = create_row(own_ctx.tput_section);
+    own_ctx.tput_mode = create_pills(row);
+    pills_add(own_ctx.tput_mode, "Read");
+    pills_add(own_ctx.tput_mode, "Notify");
+    pills_set_active(own_ctx.tput_mode, 0);
+    own_ctx.tput_btn = create_action_btn(row, "Start", on_tput_click);
+
+    own_ctx.tput_label = lv_label_create(own_ctx.tput_section);
+    lv_label_set_text(own_ctx.tput_label, "");
+    lv_obj_set_style_text_color(own_ctx.tput_label, ZV_COLOR_TEXT_MUTED, 0);
+    lv_obj_set_style_text_font(own_ctx.tput_label, &lv_font_montserrat_12, 0);
+}
+
+lv_obj_t *bt_char_view_page_create(lv_obj_t *menu)
+{
+    lv_obj_t *page = lv_menu_page_create(menu, "Characteristic");
+    page_ref = page;
+
+    lv_obj_t *root = lv_obj_create(page);
+    lv_obj_set_size(root, LV_PCT(100), LV_PCT(100));
+    lv_obj_set_style_bg_opa(root, LV_OPA_TRANSP, 0);
+    lv_obj_set_style_border_width(root, 0, 0);
+    lv_obj_set_style_pad_all(root, 12, 0);
+    lv_obj_set_style_pad_row(root, 10, 0);
+    lv_obj_add_flag(root, LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_set_scroll_dir(root, LV_DIR_VER);
+    lv_obj_set_scrollbar_mode(root, LV_SCROLLBAR_MODE_AUTO);
+
+    lv_obj_set_layout(root, LV_LAYOUT_FLEX);
+    lv_obj_set_flex_flow(root, LV_FLEX_FLOW_COLUMN);
+
+    own_ctx.char_info = create_info_panel(root, LV_PCT(100), LV_SIZE_CONTENT);
+
+    create_section_title(root, "VALUE");
+
+    ui_info_panel *value_panel = create_info_panel(root, LV_PCT(100), LV_SIZE_CONTENT);
+    own_ctx.hex_label = create_value_row(value_panel, "Hex");
+    own_ctx.text_label = create_value_row(value_panel, "Text");
+    own_ctx.rate_label = create_value_row(value_panel, "Rate");
+    own_ctx.count_label = create_value_row(value_panel, "Received");
+
+    lv_obj_t *action_row = create_row(root);
+    own_ctx.read_btn = create_action_btn(action_row, "Read", on_read_click);
+    own_ctx.subscribe_btn = create_action_btn(action_row, "Subscribe", on_subscribe_click);
+
+    own_ctx.status_label = lv_label_create(root);
+    lv_label_set_text(own_ctx.status_label, "");
+    lv_obj_set_style_text_color(own_ctx.status_label, ZV_COLOR_TERMINAL, 0);
+
+    create_write_section(root);
+    create_tput_section(root);
+
+    live.timer = lv_timer_create(live_timer_cb, LIVE_PERIOD_MS, NULL);
+    lv_timer_pause(live.timer);
+
+    set_gatt_op_cb(on_gatt_op);
+    set_tput_cb(on_tput);
+    lv_obj_add_event_cb(menu, on_page_changed, LV_EVENT_VALUE_CHANGED, NULL);
+
+    return page;
+}
+
+void bt_char_view_open(int conn_id, unsigned int handle)
+{
+    const bt_gatt_db *db = bt_get_gatt_db(conn_id);
+    live.conn_id = conn_id;
+    live.handle = handle;
+    live.generation = db ? db->generation : 0;
+    live.gone = false;
+
+    const bt_characteristic_t *ch = bt_gatt_find_characteristic(conn_id, handle);
+    bt_value_ring_t *ring = bt_gatt_value_ring(conn_id, handle);
+
+    live.window_start_ms = now_ms();
+    live.window_received = bt_value_ring_received(ring);
+    live.shown_received = live.window_received;
+    live.shown_subscribed = ch && ch->subscribed;
+
+    if (own_ctx.char_info)
+    {
+        clear_info_panel(own_ctx.char_info);
+
+        char uuid_buf[BT_UUID_STR_LEN] = "";
+        const char *name = ch ? lookup_name(ch->uuid, uuid_buf, sizeof(uuid_buf)) : NULL;
+
+        char handle_buf[16];
+        snprintf(handle_buf, sizeof(handle_buf), "0x%04X", handle);
+
+        kv_item_t items[] = {
+            { .label = "UUID",   .value = uuid_buf },
+            { .label = "Name",   .value = name ? name : UNKNOWN_NAME },
+            { .label = "Handle", .value = handle_buf },
+        };
+        for (size_t i = 0; i < sizeof(items) / sizeof(items[0]); i++)
+            add_info_panel_item(own_ctx.char_info, items[i]);
+    }
+
+    unsigned int props = ch ? ch->props : 0;
+    show_if(own_ctx.read_btn, props & BT_CHAR_PROP_READ);
+    show_if(own_ctx.subscribe_btn, props & (BT_CHAR_PROP_NOTIFY | BT_CHAR_PROP_INDICATE));
+    show_if(own_ctx.write_section, props & (BT_CHAR_PROP_WRITE | BT_CHAR_PROP_WRITE_NR));
+    show_if(own_ctx.write_btn, props & BT_CHAR_PROP_WRITE);
+    show_if(own_ctx.write_nr_btn, props & BT_CHAR_PROP_WRITE_NR);
+    set_btn_text(own_ctx.subscribe_btn, live.shown_subscribed ? "Unsubscribe" : "Subscribe");
+
+    bool can_read = props & BT_CHAR_PROP_READ;
+    bool can_notify = props & (BT_CHAR_PROP_NOTIFY | BT_CHAR_PROP_INDICATE);
+    show_if(own_ctx.tput_section, can_read || can_notify);
+    pills_set_active(own_ctx.tput_mode, can_read ? 0 : 1);
+    set_btn_text(own_ctx.tput_btn, bt_tput_running() ? "Stop" : "Start");
+    lv_label_set_text(own_ctx.tput_label, "");
+
+    lv_label_set_text(own_ctx.hex_label, "-");
+    lv_label_set_text(own_ctx.text_label, "");
+    lv_label_set_text(own_ctx.rate_label, "0.0 /s");
+    lv_label_set_text_fmt(own_ctx.count_label, "%u (%u dropped)",
+                          (unsigned)live.shown_received, (unsigned)bt_value_ring_dropped(ring));
+    set_status(ch ? "" : "Characteristic not found");
+
+    // Start from the last value received while the page was closed, if any.
+    bt_value_t latest;
+    if (bt_value_ring_drain_latest(ring, &latest) > 0)
+        render_value(&latest);
+}
@@ -0,0 +1,19 @@
+#ifndef BT_CHAR_VIEW_H
+#define BT_CHAR_VIEW_H
+
+#include "lvgl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+lv_obj_t *bt_char_view_page_create(lv_obj_t *menu);
+
+// Points the page at the characteristic with ATT `handle` on `conn_id`; call before showing it.
+void bt_char_view_open(int conn_id, unsigned int handle);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BT_CHAR_VIEW_H */
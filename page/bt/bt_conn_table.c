@@ -0,0 +1,95 @@
+#include "bt_conn_table.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <strings.h>
+
+static bt_connection_t table[BT_MAX_CONNECTIONS];
+
+static void reset_link(bt_link_params_t *link)
+{
+    link->mtu = 23;
+    link->tx_octets = 27;
+    link->interval_units = 0;
+    link->latency = 0;
+    link->timeout_units = 0;
+}
+
+void bt_conn_table_init(void)
+{
+    for (int i = 0; i < BT_MAX_CONNECTIONS; i++)
+    {
+        memset(&table[i], 0, sizeof(table[i]));
+        table[i].conn_id = i;
+        bt_gatt_db_init(&table[i].gatt_db);
+        reset_link(&table[i].link);
+    }
+}
+
+bt_connection_t *bt_conn_table_get(int conn_id)
+{
+    if (conn_id < 0 || conn_id >= BT_MAX_CONNECTIONS || !table[conn_id].in_use)
+        return NULL;
+
+    return &table[conn_id];
+}
+
+bt_connection_t *bt_conn_table_find_mac(const char *mac)
+{
+    if (!mac || !mac[0])
+        return NULL;
+
+    for (int i = 0; i < BT_MAX_CONNECTIONS; i++)
+    {
+        if (table[i].in_use && strcasecmp(table[i].mac, mac) == 0)
+            return &table[i];
+    }
+
+    return NULL;
+}
+
+bt_connection_t *bt_conn_table_alloc(const char *mac, int addr_type, const char *name)
+{
+    for (int i = 0; i < BT_MAX_CONNECTIONS; i++)
+    {
+        bt_connection_t *conn = &table[i];
+        if (conn->in_use)
+            continue;
+
+        // A released slot still holds an empty db; reset bumps its generation again.
+        bt_gatt_db_reset(&conn->gatt_db);
+        reset_link(&conn->link);
+
+        conn->in_use = true;
+        conn->status = BT_CONN_IDLE;
+        snprintf(conn->mac, sizeof(conn->mac), "%s", mac ? mac : "");
+        conn->addr_type = addr_type;
+        snprintf(conn->name, sizeof(conn->name), "%s", name && name[0] ? name : UNKNOWN_NAME);
+        conn->has_cache = false;
+        conn->db_hash[0] = '\0';
+        return conn;
+    }
+
+    return NULL;
+}
+
+void bt_conn_table_release(bt_connection_t *conn)
+{
+    if (!conn || !conn->in_use)
+        return;
+
+    bt_gatt_db_reset(&conn->gatt_db);
+    conn->in_use = false;
+}
+
+int bt_conn_table_list(int *ids, int max)
+{
+    int count = 0;
+    for (int i = 0; i < BT_MAX_CONNECTIONS && count < max; i++)
+    {
+        if (table[i].in_use)
+            ids[count++] = i;
+    }
+
+    return count;
+}
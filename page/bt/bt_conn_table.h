@@ -0,0 +1,66 @@
+#ifndef BT_CONN_TABLE_H
+#define BT_CONN_TABLE_H
+
+#include <stdbool.h>
+
+#include "bt_gatt_cache.h"
+#include "bt_gatt_db.h"
+#include "types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define BT_MAX_CONNECTIONS 4    // Bluedroid's default ACL link limit on the ESP32
+
+// What the link runs with now. Defaults are the spec minimums until something is negotiated.
+typedef struct {
+    int mtu;                // ATT MTU, 23 until exchanged
+    int tx_octets;          // LL payload per packet, 27 without data length extension
+    int interval_units;     // 0 until the ESP32 reports it
+    int latency;
+    int timeout_units;
+} bt_link_params_t;
+
+/*
+ * One peripheral link. The id is the slot in the table; it goes out with the
+ * CONNECT request and the ESP32 tags every line about that link with it
+ * (`conn=<id>`), so nothing has to be matched by MAC after connecting.
+ */
+typedef struct {
+    bool in_use;
+    int conn_id;
+    bt_conn_status_t status;
+
+    char mac[18];
+    int addr_type;
+    char name[32];
+
+    // GATT cache key state: does a cached table exist, and the hash the peer reported.
+    bool has_cache;
+    char db_hash[BT_GATT_DB_HASH_LEN];
+
+    bt_gatt_db gatt_db;
+    bt_link_params_t link;
+} bt_connection_t;
+
+void bt_conn_table_init(void);
+
+// NULL when `conn_id` is out of range or the slot is free.
+bt_connection_t *bt_conn_table_get(int conn_id);
+bt_connection_t *bt_conn_table_find_mac(const char *mac);
+
+// Takes a free slot for `mac`. NULL when every slot is busy.
+bt_connection_t *bt_conn_table_alloc(const char *mac, int addr_type, const char *name);
+
+// Frees the slot and drops its GATT db.
+void bt_conn_table_release(bt_connection_t *conn);
+
+// Fills `ids` with the slots in use, in slot order. Returns how many.
+int bt_conn_table_list(int *ids, int max);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BT_CONN_TABLE_H */
@@ -1,28 +1,84 @@
 #include "bt_controller.h"
+#include "bt_ad_decoder.h"
+#include "bt_conn_table.h"
+#include "bt_device_index.h"
+#include "bt_gatt_db.h"
+#include "bt_gatt_cache.h"
+#include "bt_scan_log.h"
+#include "bt_uuid_registry.h"
 #include "utils/error_handler.h"
+#include "utils/file.h"
 #include "utils/logger.h"
 #include "utils/string_utils.h"
 #include "service/uart_commands.h"
 #include "app_context.h"
+#include "config.h"
+#include "lvgl.h"
 
 #include <string.h>
 #include <stdlib.h>
 #include <stdio.h>
+#include <sys/resource.h>
+#include <time.h>
 
 #define UART_BT_TAG_ID "BT_TAG_CONTROLLER"
 
+// Longest attribute value ATT allows, whatever the MTU.
+#define BT_ATT_MAX_VALUE_LEN 512
+
 typedef struct {
     device_t devices[BT_ALLOWED_MAX_DEVICES];
     int amount;
 } list_items_ctx;
 
 static list_items_ctx local_ctx;
+
+// Active search on the scanner page; `hits` are slots of the device store.
+static struct {
+    char query[64];
+    bt_device_set_t hits;
+} search;
 static scanner_handler internal_cb = NULL;
 static bt_conn_handler conn_cb = NULL;
+static bt_gatt_op_handler gatt_op_cb = NULL;
+static bt_link_handler link_cb = NULL;
+static bt_tput_handler tput_cb = NULL;
+
+static struct {
+    bool running;
+    char mac[18];           // peer under test, for the log line
+    bt_tput_result_t result;
+} tput;
+
+#define TPUT_MIN_DURATION_MS    1000
+#define TPUT_MAX_DURATION_MS    60000
 
-static bt_service_t services[BT_MAX_SERVICES];
-static int services_count = 0;
-static bt_conn_status_t conn_status = BT_CONN_IDLE;
+#define SCAN_BUDGET_PERIOD_MS   1000
+#define SCAN_BUDGET_CALM_TICKS  3     // ticks under budget before stepping back up
+#define SCAN_MIN_WINDOW_MS      10
+
+/*
+ * Continuous scan state. `window_ms` is what the ESP32 is running now; it is
+ * halved while the UART backlog or our CPU usage is over budget and doubled
+ * back, up to the configured window, once things have been calm for a while.
+ */
+static struct {
+    bool active;
+    int interval_ms;
+    int window_ms;
+    int target_window_ms;
+    int calm_ticks;
+
+    lv_timer_t *budget_timer;
+    uint64_t last_cpu_us;
+    uint64_t last_wall_us;
+} cont_scan;
+
+static void stop_budget_timer(void)
+{
+    if (cont_scan.budget_timer)
+        lv_timer_pause(cont_scan.budget_timer);
+}
 
 void set_scanner_cb(scanner_handler new_callback)
 {
@@ -34,75 +90,88 @@ void set_conn_cb(bt_conn_handler new_callback)
     conn_cb = new_callback;
 }
 
-bt_conn_status_t bt_get_conn_status(void)
+void set_gatt_op_cb(bt_gatt_op_handler new_callback)
 {
-    return conn_status;
+    gatt_op_cb = new_callback;
 }
 
-bt_service_t *bt_get_services(void)
+void set_link_cb(bt_link_handler new_callback)
 {
-    return services;
+    link_cb = new_callback;
 }
 
-int bt_get_services_length(void)
+void set_tput_cb(bt_tput_handler new_callback)
 {
-    return services_count;
+    tput_cb = new_callback;
 }
 
-void bt_clear_discovery(void)
+const bt_link_params_t *bt_get_link_params(int conn_id)
 {
-    services_count = 0;
-    memset(services, 0, sizeof(services));
-    conn_status = BT_CONN_IDLE;
+    bt_connection_t *conn = bt_conn_table_get(conn_id);
+    return conn ? &conn->link : NULL;
 }
 
-static bt_service_t *find_service(int svc_index)
+bool bt_tput_running(void)
 {
-    for (int i = 0; i < services_count; i++) {
-        if (services[i].svc_index == svc_index)
-            return &services[i];
-    }
-    return NULL;
+    return tput.running;
 }
 
-static bt_service_t *add_service(int svc_index, const char *uuid)
+unsigned int bt_tput_kbps(const bt_tput_result_t *result)
 {
-    bt_service_t *existing = find_service(svc_index);
-    if (existing)
-        return existing;
+    if (!result || result->elapsed_ms == 0)
+        return 0;
 
-    if (services_count >= BT_MAX_SERVICES) {
-        log_warning("services full (max %d)\n", BT_MAX_SERVICES);
-        return NULL;
-    }
+    // bits per millisecond is kbit/s.
+    return (unsigned int)((uint64_t)result->bytes * 8u / result->elapsed_ms);
+}
 
-    bt_service_t *svc = &services[services_count++];
-    svc->svc_index = svc_index;
-    snprintf(svc->uuid, sizeof(svc->uuid), "%s", uuid ? uuid : "");
-    svc->chars_count = 0;
-    return svc;
+bt_conn_status_t bt_get_conn_status(int conn_id)
+{
+    bt_connection_t *conn = bt_conn_table_get(conn_id);
+    return conn ? conn->status : BT_CONN_IDLE;
 }
 
-static void add_characteristic(int svc_index, int char_index, const char *uuid,
-                               unsigned int props, unsigned int handle)
+int bt_find_connection(const char *mac)
 {
-    bt_service_t *svc = find_service(svc_index);
-    if (!svc) {
-        svc = add_service(svc_index, "");
-        if (!svc)
-            return;
-    }
+    bt_connection_t *conn = bt_conn_table_find_mac(mac);
+    return conn ? conn->conn_id : -1;
+}
 
-    if (svc->chars_count >= BT_MAX_CHARS_PER_SERVICE) {
-        log_warning("chars full for svc %d\n", svc_index);
-        return;
-    }
+int bt_get_connections(int *conn_ids, int max)
+{
+    return conn_ids ? bt_conn_table_list(conn_ids, max) : 0;
+}
+
+const bt_connection_t *bt_get_connection(int conn_id)
+{
+    return bt_conn_table_get(conn_id);
+}
+
+bt_service_t *bt_get_services(int conn_id)
+{
+    bt_connection_t *conn = bt_conn_table_get(conn_id);
+    return conn ? conn->gatt_db.services : NULL;
+}
 
-    bt_characteristic_t *ch = &svc->chars[svc->chars_count++];
-    ch->char_index = char_index;
-    snprintf(ch->uuid, sizeof(ch->uuid), "%s", uuid ? uuid : "");
-    ch->props = props;
-    ch->handle = handle;
+int bt_get_services_length(int conn_id)
+{
+    bt_connection_t *conn = bt_conn_table_get(conn_id);
+    return conn ? conn->gatt_db.services_count : 0;
+}
+
+const bt_gatt_db *bt_get_gatt_db(int conn_id)
+{
+    bt_connection_t *conn = bt_conn_table_get(conn_id);
+    return conn ? &conn->gatt_db : NULL;
+}
+
+/*
+ * Drops every discovered attribute. All nodes live in the db arena, so this
+ * is a single free of a few blocks no matter how big the peripheral was.
+ */
+static void reset_gatt_db(bt_connection_t *conn)
+{
+    bt_gatt_db_reset(&conn->gatt_db);
 }
 
 /*
@@ -115,7 +184,7 @@ static bool get_field_value(const char *kv_buffer, const char *key, char *out, s
     if (!kv_buffer || !key || !out || out_size == 0)
         return false;
 
-    char copy[512];
+    char copy[UART_LINE_MAX];
     snprintf(copy, sizeof(copy), "%s", kv_buffer);
 
     char *saveptr;
@@ -165,30 +234,165 @@ static device_t parse_device(const char *buffer)
     return device;
 }
 
-static void set_status(bt_conn_status_t new_status, const char *info)
+/*
+ * SCAN:ADV carries the AD structures untouched (hex) instead of fields the
+ * ESP32 already picked apart. Only what the list shows is extracted here; the
+ * rest is decoded on demand by the detail page.
+ */
+static device_t parse_adv_device(const char *buffer)
+{
+    device_t device = {0};
+    char value[16];
+    char hex[BT_ADV_MAX_LEN * 2 + 1];
+
+    get_field_value(buffer, "mac", device.mac, sizeof(device.mac));
+
+    if (get_field_value(buffer, "rssi", value, sizeof(value)))
+        device.rssi = atoi(value);
+    if (get_field_value(buffer, "connectable", value, sizeof(value)))
+        device.connectable = atoi(value);
+    if (get_field_value(buffer, "addr_type", value, sizeof(value)))
+        device.addr_type = atoi(value);
+
+    if (get_field_value(buffer, "adv", hex, sizeof(hex)))
+    {
+        int n = zv_hex_decode(hex, device.adv_data, sizeof(device.adv_data));
+        device.adv_len = n > 0 ? (uint8_t)n : 0;
+    }
+    if (get_field_value(buffer, "rsp", hex, sizeof(hex)))
+    {
+        int n = zv_hex_decode(hex, device.scan_rsp, sizeof(device.scan_rsp));
+        device.scan_rsp_len = n > 0 ? (uint8_t)n : 0;
+    }
+
+    // The name usually travels in the scan response, so look there too.
+    if (!bt_ad_get_name(device.adv_data, device.adv_len, device.name, sizeof(device.name)))
+        bt_ad_get_name(device.scan_rsp, device.scan_rsp_len, device.name, sizeof(device.name));
+
+    uint16_t company_id;
+    if (bt_ad_get_manufacturer(device.adv_data, device.adv_len, &company_id, NULL, NULL) ||
+        bt_ad_get_manufacturer(device.scan_rsp, device.scan_rsp_len, &company_id, NULL, NULL))
+    {
+        const char *company = bt_company_name(company_id);
+        if (company)
+            snprintf(device.manufacturer, sizeof(device.manufacturer), "%s", company);
+        else
+            snprintf(device.manufacturer, sizeof(device.manufacturer), "0x%04X", company_id);
+    }
+
+    return device;
+}
+
+/*
+ * Adds the report to the device store and keeps the search index and the
+ * current hits in step with it. Returns true when the list should show it:
+ * a device seen for the first time that matches the active search.
+ */
+static bool store_device(device_t *device)
+{
+    bool is_new = bt_context_add_device(device);
+
+    device_t *stored = bt_context_find_device(device->mac);
+    if (!stored)
+        return false;
+
+    int slot = (int)(stored - bt_context_get_devices());
+    bt_device_index_update(slot, stored);
+
+    if (bt_device_index_matches(slot, search.query))
+        bt_device_set_add(&search.hits, slot);
+    else
+        bt_device_set_remove(&search.hits, slot);
+
+    return is_new && bt_device_set_has(&search.hits, slot);
+}
+
+// A running test can't outlive its link; report it as failed.
+static void abort_tput(const bt_connection_t *conn, const char *reason)
+{
+    if (!tput.running || (conn && tput.result.conn_id != conn->conn_id))
+        return;
+
+    tput.running = false;
+    if (tput_cb)
+        tput_cb(&tput.result, true, reason);
+}
+
+static void set_status(bt_connection_t *conn, bt_conn_status_t new_status, const char *info)
 {
-    conn_status = new_status;
+    conn->status = new_status;
     if (conn_cb)
-        conn_cb(new_status, info);
+        conn_cb(conn->conn_id, new_status, info);
 }
 
-static void parse_discover_service(char *buffer)
+// Failed, lost or closed: tell the views, then give the slot back.
+static void end_connection(bt_connection_t *conn, bt_conn_status_t status, const char *info)
+{
+    abort_tput(conn, status == BT_CONN_DISCONNECTED ? "disconnected" : "link lost");
+    set_status(conn, status, info);
+    bt_conn_table_release(conn);
+}
+
+static void request_discovery(bt_connection_t *conn)
+{
+    reset_gatt_db(conn);
+
+    uart_status_t rc = uart_send_formatted_line("%s|conn=%d", BT_COMMAND_REQ_DISCOVER, conn->conn_id);
+    if (rc != UART_OK) {
+        log_warning("discover request error: %s\n", last_error());
+        set_status(conn, BT_CONN_FAILED, "uart");
+    }
+}
+
+/*
+ * Called once the link is up. When we have a cached table for this peer and
+ * it is still valid, publish it right away; otherwise run a full discovery.
+ */
+static void resolve_gatt_db(bt_connection_t *conn)
+{
+    if (!conn->has_cache) {
+        request_discovery(conn);
+        return;
+    }
+
+    char cached_hash[BT_GATT_DB_HASH_LEN] = {0};
+    if (bt_gatt_cache_load(conn->mac, conn->addr_type, &conn->gatt_db, cached_hash, sizeof(cached_hash)) &&
+        bt_gatt_cache_is_valid(&conn->gatt_db, cached_hash, conn->db_hash))
+    {
+        log_debug("gatt cache hit for %s\n", conn->mac);
+        set_status(conn, BT_CONN_READY, BT_CONN_INFO_CACHED);
+        return;
+    }
+
+    log_debug("gatt cache stale for %s, rediscovering\n", conn->mac);
+    bt_gatt_cache_invalidate(conn->mac, conn->addr_type);
+    conn->has_cache = false;
+    request_discovery(conn);
+}
+
+static void parse_discover_service(bt_connection_t *conn, char *buffer)
 {
     char val[64];
     int svc_index = 0;
     char uuid[BT_UUID_STR_LEN] = {0};
+    unsigned int start_handle = 0;
+    unsigned int end_handle = 0;
 
     if (get_field_value(buffer, "svc", val, sizeof(val)))
         svc_index = atoi(val);
     get_field_value(buffer, "uuid", uuid, sizeof(uuid));
+    if (get_field_value(buffer, "start", val, sizeof(val)))
+        start_handle = (unsigned int)strtoul(val, NULL, 0);
+    if (get_field_value(buffer, "end", val, sizeof(val)))
+        end_handle = (unsigned int)strtoul(val, NULL, 0);
 
-    add_service(svc_index, uuid);
+    bt_gatt_db_add_service(&conn->gatt_db, svc_index, uuid, start_handle, end_handle);
 
     if (conn_cb)
-        conn_cb(BT_CONN_DISCOVERING, NULL);
+        conn_cb(conn->conn_id, BT_CONN_DISCOVERING, NULL);
 }
 
-static void parse_discover_char(char *buffer)
+static void parse_discover_char(bt_connection_t *conn, char *buffer)
 {
     char val[64];
     int svc_index = 0;
@@ -207,10 +411,168 @@ static void parse_discover_char(char *buffer)
     if (get_field_value(buffer, "handle", val, sizeof(val)))
         handle = (unsigned int)strtoul(val, NULL, 0);
 
-    add_characteristic(svc_index, char_index, uuid, props, handle);
+    bt_gatt_db_add_characteristic(&conn->gatt_db, svc_index, char_index, uuid, props, handle);
 
     if (conn_cb)
-        conn_cb(BT_CONN_DISCOVERING, NULL);
+        conn_cb(conn->conn_id, BT_CONN_DISCOVERING, NULL);
+}
+
+static void parse_discover_desc(bt_connection_t *conn, char *buffer)
+{
+    char val[64];
+    int svc_index = 0;
+    int char_index = 0;
+    char uuid[BT_UUID_STR_LEN] = {0};
+    unsigned int handle = 0;
+
+    if (get_field_value(buffer, "svc", val, sizeof(val)))
+        svc_index = atoi(val);
+    if (get_field_value(buffer, "char", val, sizeof(val)))
+        char_index = atoi(val);
+    get_field_value(buffer, "uuid", uuid, sizeof(uuid));
+    if (get_field_value(buffer, "handle", val, sizeof(val)))
+        handle = (unsigned int)strtoul(val, NULL, 0);
+
+    bt_gatt_db_add_descriptor(&conn->gatt_db, svc_index, char_index, uuid, handle);
+
+    if (conn_cb)
+        conn_cb(conn->conn_id, BT_CONN_DISCOVERING, NULL);
+}
+
+static uint64_t monotonic_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000ull + (uint64_t)ts.tv_nsec / 1000ull;
+}
+
+static bt_characteristic_t *find_characteristic(bt_connection_t *conn, unsigned int handle)
+{
+    if (!conn)
+        return NULL;
+
+    bt_gatt_attr_t attr = bt_gatt_db_find_by_handle(&conn->gatt_db, handle);
+    return attr.kind == BT_ATTR_CHARACTERISTIC ? attr.characteristic : NULL;
+}
+
+static unsigned int parse_handle(const char *buffer)
+{
+    char val[16];
+    if (!get_field_value(buffer, "handle", val, sizeof(val)))
+        return 0;
+
+    return (unsigned int)strtoul(val, NULL, 0);
+}
+
+/*
+ * Queues `value=<hex>` into the characteristic's ring. This is all the work a
+ * notification costs here: no UI is touched, the live view drains the ring
+ * at its own pace.
+ */
+static void push_value(bt_connection_t *conn, const char *buffer, unsigned int handle)
+{
+    bt_characteristic_t *ch = find_characteristic(conn, handle);
+    bt_value_ring_t *ring = bt_gatt_db_value_ring(&conn->gatt_db, ch);
+    if (!ring)
+        return;
+
+    char hex[UART_LINE_MAX];
+    uint8_t value[BT_ATT_MAX_VALUE_LEN];
+    int len = 0;
+    if (get_field_value(buffer, "value", hex, sizeof(hex)))
+        len = zv_hex_decode(hex, value, sizeof(value));
+
+    bt_value_ring_push(ring, value, len > 0 ? (size_t)len : 0, (uint32_t)(monotonic_us() / 1000));
+}
+
+static void report_gatt_op(bt_connection_t *conn, bt_gatt_op_t op, const char *buffer, bool ok)
+{
+    unsigned int handle = parse_handle(buffer);
+
+    char reason[32] = {0};
+    if (!ok)
+        get_field_value(buffer, "reason", reason, sizeof(reason));
+
+    if (gatt_op_cb)
+        gatt_op_cb(conn->conn_id, op, handle, ok, ok ? NULL : reason);
+}
+
+static void parse_subscribe_ok(bt_connection_t *conn, const char *buffer)
+{
+    unsigned int handle = parse_handle(buffer);
+
+    char mode[16] = {0};
+    get_field_value(buffer, "mode", mode, sizeof(mode));
+
+    bt_characteristic_t *ch = find_characteristic(conn, handle);
+    if (ch)
+        ch->subscribed = strcmp(mode, "off") != 0;
+
+    report_gatt_op(conn, BT_GATT_OP_SUBSCRIBE, buffer, true);
+}
+
+static int field_int(const char *buffer, const char *key, int fallback)
+{
+    char val[16];
+    if (!get_field_value(buffer, key, val, sizeof(val)))
+        return fallback;
+
+    return (int)strtol(val, NULL, 0);
+}
+
+static void parse_link_ok(bt_connection_t *conn, const char *buffer)
+{
+    bt_link_params_t *link = &conn->link;
+    if (zv_starts_with(buffer, BT_COMMAND_RES_LINK_MTU_OK)) {
+        link->mtu = field_int(buffer, "mtu", link->mtu);
+    } else if (zv_starts_with(buffer, BT_COMMAND_RES_LINK_DLE_OK)) {
+        link->tx_octets = field_int(buffer, "tx", link->tx_octets);
+    } else {
+        link->interval_units = field_int(buffer, "interval", link->interval_units);
+        link->latency = field_int(buffer, "latency", link->latency);
+        link->timeout_units = field_int(buffer, "timeout", link->timeout_units);
+    }
+
+    log_debug("link %d mtu=%d tx=%d interval=%d latency=%d timeout=%d\n", conn->conn_id, link->mtu,
+              link->tx_octets, link->interval_units, link->latency, link->timeout_units);
+
+    if (link_cb)
+        link_cb(conn->conn_id, link);
+}
+
+static void parse_tput(const char *buffer, bool done)
+{
+    if (!tput.running)
+        return;
+
+    tput.result.bytes = (uint32_t)field_int(buffer, "bytes", (int)tput.result.bytes);
+    tput.result.packets = (uint32_t)field_int(buffer, "packets", (int)tput.result.packets);
+    tput.result.errors = (uint32_t)field_int(buffer, "errors", (int)tput.result.errors);
+    tput.result.elapsed_ms = (uint32_t)field_int(buffer, "ms", (int)tput.result.elapsed_ms);
+
+    if (done)
+    {
+        tput.running = false;
+        log_info("[BT][tput] %s handle=%u on %s: %u bytes in %u ms = %u kbit/s "
+                 "(mtu=%d tx=%d interval=%d errors=%u)\n",
+                 tput.result.mode == BT_TPUT_READ ? "read" : "notify", tput.result.handle, tput.mac,
+                 tput.result.bytes, tput.result.elapsed_ms, bt_tput_kbps(&tput.result),
+                 tput.result.link.mtu, tput.result.link.tx_octets, tput.result.link.interval_units,
+                 tput.result.errors);
+    }
+
+    if (tput_cb)
+        tput_cb(&tput.result, done, NULL);
+}
+
+// The link a line is about, from its `conn=` field.
+static bt_connection_t *conn_from_line(const char *buffer)
+{
+    char val[8];
+    if (!get_field_value(buffer, "conn", val, sizeof(val)))
+        return NULL;
+
+    return bt_conn_table_get(atoi(val));
 }
 
 static void event_handler(const char *tag_id, char *buffer)
@@ -227,72 +589,173 @@ static void event_handler(const char *tag_id, char *buffer)
             return;
         }
         if (strstr(buffer, BT_COMMAND_RES_SCAN_DONE) != NULL) {
+            stop_budget_timer();
+            cont_scan.active = false;
             internal_cb(NULL, UI_DONE);
             return;
         }
         if (strstr(buffer, BT_COMMAND_RES_SCAN_DEVICE) != NULL) {
             device_t device = parse_device(buffer);
-            internal_cb(&device, UI_LOADING);
-            bt_context_add_device(&device);
+            if (store_device(&device))
+                internal_cb(&device, UI_LOADING);
+            bt_scan_log_append(&device);
+            return;
+        }
+        if (zv_starts_with(buffer, BT_COMMAND_RES_SCAN_ADV)) {
+            device_t device = parse_adv_device(buffer);
+            if (store_device(&device))
+                internal_cb(&device, UI_LOADING);
+            bt_scan_log_append(&device);
             return;
         }
     }
 
+    // Everything else is about one link and says which.
+    // Lines for a slot we already released (late GATT answers after a loss) are dropped.
+    bt_connection_t *conn = conn_from_line(buffer);
+    if (!conn)
+        return;
+
+    // -- GATT --
+    // Notifications first: on a busy peer they are most of the traffic.
+    if (zv_starts_with(buffer, BT_COMMAND_RES_GATT_NOTIFY)) {
+        push_value(conn, buffer, parse_handle(buffer));
+        return;
+    }
+
     // -- CONNECT --
     if (zv_starts_with(buffer, BT_COMMAND_RES_CONNECT_START)) {
-        set_status(BT_CONN_CONNECTING, NULL);
+        set_status(conn, BT_CONN_CONNECTING, NULL);
         return;
     }
     if (zv_starts_with(buffer, BT_COMMAND_RES_CONNECT_OK)) {
-        set_status(BT_CONN_CONNECTED, NULL);
+        conn->db_hash[0] = '\0';
+        get_field_value(buffer, "db_hash", conn->db_hash, sizeof(conn->db_hash));
+        set_status(conn, BT_CONN_CONNECTED, NULL);
+
+        const zv_config *config = config_get();
+        if (config && config->bt.link_tune_on_connect)
+            bt_tune_link(conn->conn_id);
+
+        resolve_gatt_db(conn);
         return;
     }
     if (zv_starts_with(buffer, BT_COMMAND_RES_CONNECT_FAIL)) {
         char reason[32] = {0};
         get_field_value(buffer, "reason", reason, sizeof(reason));
-        set_status(BT_CONN_FAILED, reason);
+        end_connection(conn, BT_CONN_FAILED, reason);
         return;
     }
     if (zv_starts_with(buffer, BT_COMMAND_RES_CONNECT_LOST)) {
         char reason[32] = {0};
         get_field_value(buffer, "reason", reason, sizeof(reason));
-        set_status(BT_CONN_LOST, reason);
+        end_connection(conn, BT_CONN_LOST, reason);
         return;
     }
     if (zv_starts_with(buffer, BT_COMMAND_RES_CONNECT_ERROR)) {
-        set_status(BT_CONN_FAILED, "command error");
+        end_connection(conn, BT_CONN_FAILED, "command error");
         return;
     }
 
     // -- DISCONNECT --
     if (zv_starts_with(buffer, BT_COMMAND_RES_DISCONNECT_OK)) {
-        set_status(BT_CONN_DISCONNECTED, NULL);
+        end_connection(conn, BT_CONN_DISCONNECTED, NULL);
         return;
     }
 
     // -- DISCOVER --
     if (zv_starts_with(buffer, BT_COMMAND_RES_DISCOVER_START)) {
-        services_count = 0;
-        memset(services, 0, sizeof(services));
-        set_status(BT_CONN_DISCOVERING, NULL);
+        reset_gatt_db(conn);
+        set_status(conn, BT_CONN_DISCOVERING, NULL);
         return;
     }
     if (zv_starts_with(buffer, BT_COMMAND_RES_DISCOVER_SERVICE)) {
-        parse_discover_service(buffer);
+        parse_discover_service(conn, buffer);
         return;
     }
     if (zv_starts_with(buffer, BT_COMMAND_RES_DISCOVER_CHAR)) {
-        parse_discover_char(buffer);
+        parse_discover_char(conn, buffer);
+        return;
+    }
+    if (zv_starts_with(buffer, BT_COMMAND_RES_DISCOVER_DESC)) {
+        parse_discover_desc(conn, buffer);
         return;
     }
     if (zv_starts_with(buffer, BT_COMMAND_RES_DISCOVER_DONE)) {
-        set_status(BT_CONN_READY, NULL);
+        conn->has_cache = bt_gatt_cache_save(conn->mac, conn->addr_type, conn->db_hash, &conn->gatt_db) == 0;
+        set_status(conn, BT_CONN_READY, NULL);
         return;
     }
     if (zv_starts_with(buffer, BT_COMMAND_RES_DISCOVER_FAIL)) {
         char reason[32] = {0};
         get_field_value(buffer, "reason", reason, sizeof(reason));
-        set_status(BT_CONN_FAILED, reason);
+        set_status(conn, BT_CONN_FAILED, reason);
+        return;
+    }
+
+    // -- GATT --
+    if (zv_starts_with(buffer, BT_COMMAND_RES_GATT_READ_OK)) {
+        push_value(conn, buffer, parse_handle(buffer));
+        report_gatt_op(conn, BT_GATT_OP_READ, buffer, true);
+        return;
+    }
+    if (zv_starts_with(buffer, BT_COMMAND_RES_GATT_READ_FAIL)) {
+        report_gatt_op(conn, BT_GATT_OP_READ, buffer, false);
+        return;
+    }
+    if (zv_starts_with(buffer, BT_COMMAND_RES_GATT_WRITE_OK)) {
+        report_gatt_op(conn, BT_GATT_OP_WRITE, buffer, true);
+        return;
+    }
+    if (zv_starts_with(buffer, BT_COMMAND_RES_GATT_WRITE_FAIL)) {
+        report_gatt_op(conn, BT_GATT_OP_WRITE, buffer, false);
+        return;
+    }
+    if (zv_starts_with(buffer, BT_COMMAND_RES_GATT_SUBSCRIBE_OK)) {
+        parse_subscribe_ok(conn, buffer);
+        return;
+    }
+    if (zv_starts_with(buffer, BT_COMMAND_RES_GATT_SUBSCRIBE_FAIL)) {
+        report_gatt_op(conn, BT_GATT_OP_SUBSCRIBE, buffer, false);
+        return;
+    }
+    if (zv_starts_with(buffer, BT_COMMAND_RES_GATT_SERVICE_CHANGED)) {
+        log_debug("service changed on %s, dropping cache\n", conn->mac);
+        bt_gatt_cache_invalidate(conn->mac, conn->addr_type);
+        conn->has_cache = false;
+        if (conn->status == BT_CONN_READY)
+            request_discovery(conn);
+        return;
+    }
+
+    // -- LINK --
+    if (zv_starts_with(buffer, BT_COMMAND_RES_LINK_MTU_OK) ||
+        zv_starts_with(buffer, BT_COMMAND_RES_LINK_DLE_OK) ||
+        zv_starts_with(buffer, BT_COMMAND_RES_LINK_PARAMS_OK)) {
+        parse_link_ok(conn, buffer);
+        return;
+    }
+    if (zv_starts_with(buffer, BT_COMMAND_RES_LINK_MTU_FAIL) ||
+        zv_starts_with(buffer, BT_COMMAND_RES_LINK_DLE_FAIL) ||
+        zv_starts_with(buffer, BT_COMMAND_RES_LINK_PARAMS_FAIL)) {
+        // The link keeps what it had; the line says which request and why.
+        log_warning("link request refused: %s\n", buffer);
+        return;
+    }
+
+    // -- THROUGHPUT TEST --
+    if (zv_starts_with(buffer, BT_COMMAND_RES_TPUT_PROGRESS)) {
+        parse_tput(buffer, false);
+        return;
+    }
+    if (zv_starts_with(buffer, BT_COMMAND_RES_TPUT_DONE)) {
+        parse_tput(buffer, true);
+        return;
+    }
+    if (zv_starts_with(buffer, BT_COMMAND_RES_TPUT_FAIL)) {
+        char reason[32] = {0};
+        get_field_value(buffer, "reason", reason, sizeof(reason));
+        abort_tput(conn, reason);
         return;
     }
 }
@@ -310,14 +773,148 @@ uart_status_t bt_controller_init(const uart_config_t *config)
         return uart_rc;
     }
 
+    bt_conn_table_init();
     add_event_callback(event_handler, UART_BT_TAG_ID);
 
     return UART_OK;
 }
 
+static uint64_t process_cpu_us(void)
+{
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+        return 0;
+
+    return (uint64_t)(usage.ru_utime.tv_sec + usage.ru_stime.tv_sec) * 1000000ull +
+           (uint64_t)(usage.ru_utime.tv_usec + usage.ru_stime.tv_usec);
+}
+
+static uart_status_t send_scan_params(int window_ms)
+{
+    const zv_config *config = config_get();
+    bool raw = config && config->bt.raw_advertising;
+
+    uart_status_t rc = uart_send_formatted_line("%s|interval=%d|window=%d|adv=%d",
+        BT_COMMAND_REQ_SCAN_CONT, cont_scan.interval_ms, window_ms, raw ? 1 : 0);
+    if (rc != UART_OK) {
+        log_warning("continuous scan request error: %s\n", last_error());
+        return rc;
+    }
+
+    cont_scan.window_ms = window_ms;
+    return UART_OK;
+}
+
+static void budget_timer_cb(lv_timer_t *t)
+{
+    (void)t;
+
+    const zv_config *config = config_get();
+    if (!cont_scan.active || !config)
+        return;
+
+    uint64_t cpu_us = process_cpu_us();
+    uint64_t wall_us = monotonic_us();
+    uint64_t wall_delta = wall_us - cont_scan.last_wall_us;
+    int cpu_pct = wall_delta ? (int)((cpu_us - cont_scan.last_cpu_us) * 100 / wall_delta) : 0;
+    cont_scan.last_cpu_us = cpu_us;
+    cont_scan.last_wall_us = wall_us;
+
+    size_t backlog = uart_rx_pending();
+    size_t max_backlog = (size_t)config->bt.scan_budget_backlog;
+    int max_cpu = config->bt.scan_budget_cpu_pct;
+
+    if (backlog > max_backlog || cpu_pct > max_cpu)
+    {
+        cont_scan.calm_ticks = 0;
+        if (cont_scan.window_ms > SCAN_MIN_WINDOW_MS)
+        {
+            int window = cont_scan.window_ms / 2;
+            if (window < SCAN_MIN_WINDOW_MS)
+                window = SCAN_MIN_WINDOW_MS;
+
+            log_debug("scan over budget (backlog=%zu cpu=%d%%), window %d -> %d ms\n",
+                      backlog, cpu_pct, cont_scan.window_ms, window);
+            send_scan_params(window);
+        }
+        return;
+    }
+
+    // Hysteresis: only step up when well under both limits.
+    if (backlog > max_backlog / 4 || cpu_pct > max_cpu / 2 || cont_scan.window_ms >= cont_scan.target_window_ms)
+    {
+        cont_scan.calm_ticks = 0;
+        return;
+    }
+
+    if (++cont_scan.calm_ticks < SCAN_BUDGET_CALM_TICKS)
+        return;
+
+    cont_scan.calm_ticks = 0;
+    int window = cont_scan.window_ms * 2;
+    if (window > cont_scan.target_window_ms)
+        window = cont_scan.target_window_ms;
+
+    log_debug("scan back under budget, window %d -> %d ms\n", cont_scan.window_ms, window);
+    send_scan_params(window);
+}
+
+/*
+ * Starts a scan that never sends SCAN:DONE on its own. Reports keep feeding
+ * the device store (and the scan log) from whatever page is on screen until
+ * bt_stop_scan().
+ */
+uart_status_t bt_start_continuous_scan(void)
+{
+    const zv_config *config = config_get();
+    if (!config)
+        return UART_ERR_CONFIG;
+
+    cont_scan.interval_ms = config->bt.scan_interval_ms > 0 ? config->bt.scan_interval_ms : 100;
+    cont_scan.target_window_ms = config->bt.scan_window_ms;
+    if (cont_scan.target_window_ms <= 0 || cont_scan.target_window_ms > cont_scan.interval_ms)
+        cont_scan.target_window_ms = cont_scan.interval_ms;
+    cont_scan.calm_ticks = 0;
+
+    uart_status_t rc = send_scan_params(cont_scan.target_window_ms);
+    if (rc != UART_OK)
+        return rc;
+
+    cont_scan.active = true;
+    cont_scan.last_cpu_us = process_cpu_us();
+    cont_scan.last_wall_us = monotonic_us();
+
+    if (!cont_scan.budget_timer)
+        cont_scan.budget_timer = lv_timer_create(budget_timer_cb, SCAN_BUDGET_PERIOD_MS, NULL);
+    else
+        lv_timer_resume(cont_scan.budget_timer);
+
+    return UART_OK;
+}
+
+uart_status_t bt_stop_scan(void)
+{
+    stop_budget_timer();
+    cont_scan.active = false;
+
+    uart_status_t rc = uart_send_line(BT_COMMAND_REQ_SCAN_STOP);
+    if (rc != UART_OK)
+        log_warning("stop scan error: %s\n", last_error());
+
+    return rc;
+}
+
+bool bt_is_continuous_scanning(void)
+{
+    return cont_scan.active;
+}
+
 uart_status_t start_scan()
 {
-    uart_status_t uart_rc = uart_send_line("SCAN");
+    const zv_config *config = config_get();
+    bool raw = config && config->bt.raw_advertising;
+
+    uart_status_t uart_rc = uart_send_line(raw ? BT_COMMAND_REQ_SCAN_ADV : BT_COMMAND_REQ_SCAN);
     if (uart_rc != UART_OK) {
         log_warning("start_scan error: %s\n", last_error());
         return uart_rc;
@@ -326,31 +923,51 @@ uart_status_t start_scan()
     return UART_OK;
 }
 
-uart_status_t bt_connect(const device_t *device)
+uart_status_t bt_connect(const device_t *device, int *out_conn_id)
 {
     if (device == NULL || device->mac[0] == '\0') {
         log_warning("bt_connect: invalid device\n");
         return UART_ERR_INVALID;
     }
 
-    bt_clear_discovery();
-    set_status(BT_CONN_CONNECTING, NULL);
+    bt_connection_t *conn = bt_conn_table_find_mac(device->mac);
+    if (conn) {
+        if (out_conn_id)
+            *out_conn_id = conn->conn_id;
+        return UART_OK;
+    }
+
+    conn = bt_conn_table_alloc(device->mac, device->addr_type, device->name);
+    if (!conn) {
+        log_warning("bt_connect: all %d connections in use\n", BT_MAX_CONNECTIONS);
+        return UART_ERR_INVALID;
+    }
 
-    uart_status_t rc = uart_send_formatted_line("%s|%s|%d",
-             BT_COMMAND_REQ_CONNECT, device->mac, device->addr_type);
+    if (out_conn_id)
+        *out_conn_id = conn->conn_id;
+
+    conn->has_cache = bt_gatt_cache_exists(conn->mac, conn->addr_type);
+    set_status(conn, BT_CONN_CONNECTING, NULL);
+
+    // Always discover=0: resolve_gatt_db() decides between the cache and one DISCOVER once connected.
+    uart_status_t rc = uart_send_formatted_line("%s|%s|%d|%d|%d", BT_COMMAND_REQ_CONNECT,
+        device->mac, device->addr_type, 0, conn->conn_id);
 
     if (rc != UART_OK)
     {
         log_warning("bt_connect error: %s\n", last_error());
-        set_status(BT_CONN_FAILED, "uart");
+        end_connection(conn, BT_CONN_FAILED, "uart");
     }
 
     return rc;
 }
 
-uart_status_t bt_disconnect(void)
+uart_status_t bt_disconnect(int conn_id)
 {
-    uart_status_t rc = uart_send_line(BT_COMMAND_REQ_DISCONNECT);
+    if (!bt_conn_table_get(conn_id))
+        return UART_OK;
+
+    uart_status_t rc = uart_send_formatted_line("%s|conn=%d", BT_COMMAND_REQ_DISCONNECT, conn_id);
     if (rc != UART_OK) {
         log_warning("bt_disconnect error: %s\n", last_error());
     }
@@ -358,6 +975,268 @@ uart_status_t bt_disconnect(void)
     return rc;
 }
 
+const bt_characteristic_t *bt_gatt_find_characteristic(int conn_id, unsigned int handle)
+{
+    return find_characteristic(bt_conn_table_get(conn_id), handle);
+}
+
+bt_value_ring_t *bt_gatt_value_ring(int conn_id, unsigned int handle)
+{
+    bt_connection_t *conn = bt_conn_table_get(conn_id);
+    if (!conn)
+        return NULL;
+
+    return bt_gatt_db_value_ring(&conn->gatt_db, find_characteristic(conn, handle));
+}
+
+// The characteristic at `handle` if the link is ready and it has any of `props`.
+static bt_characteristic_t *char_for_op(int conn_id, unsigned int handle, unsigned int props, const char *op)
+{
+    bt_connection_t *conn = bt_conn_table_get(conn_id);
+    if (!conn || conn->status != BT_CONN_READY) {
+        log_warning("%s: connection %d not ready\n", op, conn_id);
+        return NULL;
+    }
+
+    bt_characteristic_t *ch = find_characteristic(conn, handle);
+    if (!ch) {
+        log_warning("%s: no characteristic at handle %u\n", op, handle);
+        return NULL;
+    }
+    if (!(ch->props & props)) {
+        log_warning("%s: handle %u does not support it (props=0x%02x)\n", op, handle, ch->props);
+        return NULL;
+    }
+
+    return ch;
+}
+
+uart_status_t bt_gatt_read(int conn_id, unsigned int handle)
+{
+    if (!char_for_op(conn_id, handle, BT_CHAR_PROP_READ, "bt_gatt_read"))
+        return UART_ERR_INVALID;
+
+    uart_status_t rc = uart_send_formatted_line("%s|conn=%d|handle=%u",
+        BT_COMMAND_REQ_GATT_READ, conn_id, handle);
+    if (rc != UART_OK)
+        log_warning("bt_gatt_read error: %s\n", last_error());
+
+    return rc;
+}
+
+uart_status_t bt_gatt_write(int conn_id, unsigned int handle, const uint8_t *data, size_t len, bool with_response)
+{
+    unsigned int prop = with_response ? BT_CHAR_PROP_WRITE : BT_CHAR_PROP_WRITE_NR;
+    if (!char_for_op(conn_id, handle, prop, "bt_gatt_write"))
+        return UART_ERR_INVALID;
+
+    if ((!data && len > 0) || len > BT_GATT_WRITE_MAX_LEN) {
+        log_warning("bt_gatt_write: invalid value (%zu bytes)\n", len);
+        return UART_ERR_INVALID;
+    }
+
+    char hex[BT_GATT_WRITE_MAX_LEN * 2 + 1];
+    zv_hex_encode(data, len, hex, sizeof(hex));
+
+    uart_status_t rc = uart_send_formatted_line("%s|conn=%d|handle=%u|rsp=%d|value=%s",
+        BT_COMMAND_REQ_GATT_WRITE, conn_id, handle, with_response ? 1 : 0, hex);
+    if (rc != UART_OK)
+        log_warning("bt_gatt_write error: %s\n", last_error());
+
+    return rc;
+}
+
+uart_status_t bt_gatt_subscribe(int conn_id, unsigned int handle, bool enable)
+{
+    bt_characteristic_t *ch = char_for_op(conn_id, handle, BT_CHAR_PROP_NOTIFY | BT_CHAR_PROP_INDICATE,
+                                          "bt_gatt_subscribe");
+    if (!ch)
+        return UART_ERR_INVALID;
+
+    // Notify is preferred: indications cost a confirmation round trip each.
+    const char *mode = "off";
+    if (enable)
+        mode = (ch->props & BT_CHAR_PROP_NOTIFY) ? "notify" : "indicate";
+
+    uart_status_t rc = uart_send_formatted_line("%s|conn=%d|handle=%u|mode=%s",
+        BT_COMMAND_REQ_GATT_SUBSCRIBE, conn_id, handle, mode);
+    if (rc != UART_OK)
+        log_warning("bt_gatt_subscribe error: %s\n", last_error());
+
+    return rc;
+}
+
+static bool link_is_up(int conn_id, const char *op)
+{
+    bt_connection_t *conn = bt_conn_table_get(conn_id);
+    if (conn && (conn->status == BT_CONN_CONNECTED || conn->status == BT_CONN_DISCOVERING ||
+                 conn->status == BT_CONN_READY))
+        return true;
+
+    log_warning("%s: connection %d is not up\n", op, conn_id);
+    return false;
+}
+
+uart_status_t bt_request_mtu(int conn_id, int mtu)
+{
+    if (!link_is_up(conn_id, "bt_request_mtu"))
+        return UART_ERR_INVALID;
+    if (mtu < 23 || mtu > 517) {
+        log_warning("bt_request_mtu: %d out of range\n", mtu);
+        return UART_ERR_INVALID;
+    }
+
+    uart_status_t rc = uart_send_formatted_line("%s|conn=%d|mtu=%d", BT_COMMAND_REQ_LINK_MTU, conn_id, mtu);
+    if (rc != UART_OK)
+        log_warning("bt_request_mtu error: %s\n", last_error());
+
+    return rc;
+}
+
+uart_status_t bt_request_data_length(int conn_id, int tx_octets)
+{
+    if (!link_is_up(conn_id, "bt_request_data_length"))
+        return UART_ERR_INVALID;
+    if (tx_octets < 27 || tx_octets > 251) {
+        log_warning("bt_request_data_length: %d out of range\n", tx_octets);
+        return UART_ERR_INVALID;
+    }
+
+    uart_status_t rc = uart_send_formatted_line("%s|conn=%d|tx=%d", BT_COMMAND_REQ_LINK_DLE, conn_id, tx_octets);
+    if (rc != UART_OK)
+        log_warning("bt_request_data_length error: %s\n", last_error());
+
+    return rc;
+}
+
+uart_status_t bt_request_conn_params(int conn_id, int min_interval_units, int max_interval_units,
+                                     int latency, int timeout_units)
+{
+    if (!link_is_up(conn_id, "bt_request_conn_params"))
+        return UART_ERR_INVALID;
+
+    // Core spec ranges: interval 7.5 ms..4 s, latency < 500, timeout 100 ms..32 s.
+    if (min_interval_units < 6 || max_interval_units > 3200 || min_interval_units > max_interval_units ||
+        latency < 0 || latency > 499 || timeout_units < 10 || timeout_units > 3200) {
+        log_warning("bt_request_conn_params: invalid %d..%d/%d/%d\n",
+                    min_interval_units, max_interval_units, latency, timeout_units);
+        return UART_ERR_INVALID;
+    }
+
+    uart_status_t rc = uart_send_formatted_line("%s|conn=%d|min=%d|max=%d|latency=%d|timeout=%d",
+        BT_COMMAND_REQ_LINK_PARAMS, conn_id, min_interval_units, max_interval_units, latency, timeout_units);
+    if (rc != UART_OK)
+        log_warning("bt_request_conn_params error: %s\n", last_error());
+
+    return rc;
+}
+
+/*
+ * Asks for the link parameters in the config: bigger MTU, data length
+ * extension and a short connection interval. The ESP32 queues the three
+ * procedures; each answer updates bt_get_link_params() on its own.
+ */
+uart_status_t bt_tune_link(int conn_id)
+{
+    const zv_config *config = config_get();
+    if (!config)
+        return UART_ERR_CONFIG;
+
+    uart_status_t rc = bt_request_mtu(conn_id, config->bt.link_mtu);
+    if (rc != UART_OK)
+        return rc;
+
+    rc = bt_request_data_length(conn_id, config->bt.link_data_length);
+    if (rc != UART_OK)
+        return rc;
+
+    int interval = BT_CONN_INTERVAL_UNITS(config->bt.link_interval_ms);
+    return bt_request_conn_params(conn_id, interval, interval, 0,
+                                  BT_CONN_TIMEOUT_UNITS(config->bt.link_timeout_ms));
+}
+
+uart_status_t bt_tput_start(int conn_id, unsigned int handle, bt_tput_mode_t mode, int duration_ms)
+{
+    if (tput.running) {
+        log_warning("bt_tput_start: a test is already running\n");
+        return UART_ERR_INVALID;
+    }
+
+    unsigned int props = mode == BT_TPUT_READ ? BT_CHAR_PROP_READ : BT_CHAR_PROP_NOTIFY | BT_CHAR_PROP_INDICATE;
+    if (!char_for_op(conn_id, handle, props, "bt_tput_start"))
+        return UART_ERR_INVALID;
+
+    if (duration_ms < TPUT_MIN_DURATION_MS) duration_ms = TPUT_MIN_DURATION_MS;
+    if (duration_ms > TPUT_MAX_DURATION_MS) duration_ms = TPUT_MAX_DURATION_MS;
+
+    uart_status_t rc = uart_send_formatted_line("%s|conn=%d|handle=%u|mode=%s|duration=%d",
+        BT_COMMAND_REQ_TPUT_START, conn_id, handle, mode == BT_TPUT_READ ? "read" : "notify", duration_ms);
+    if (rc != UART_OK) {
+        log_warning("bt_tput_start error: %s\n", last_error());
+        return rc;
+    }
+
+    const bt_connection_t *conn = bt_conn_table_get(conn_id);
+    memset(&tput.result, 0, sizeof(tput.result));
+    tput.result.mode = mode;
+    tput.result.conn_id = conn_id;
+    tput.result.handle = handle;
+    tput.result.link = conn->link;
+    snprintf(tput.mac, sizeof(tput.mac), "%s", conn->mac);
+    tput.running = true;
+
+    return UART_OK;
+}
+
+// The ESP32 answers with TPUT:DONE for whatever it measured so far.
+uart_status_t bt_tput_stop(void)
+{
+    if (!tput.running)
+        return UART_OK;
+
+    uart_status_t rc = uart_send_formatted_line("%s|conn=%d", BT_COMMAND_REQ_TPUT_STOP, tput.result.conn_id);
+    if (rc != UART_OK)
+        log_warning("bt_tput_stop error: %s\n", last_error());
+
+    return rc;
+}
+
+int bt_controller_export_scan_log(char *out_path, size_t out_size)
+{
+    const zv_config *config = config_get();
+    if (!config || !config->bt.scan_log_path[0] || !out_path || out_size == 0)
+        return -1;
+
+    char dir[512];
+    snprintf(dir, sizeof(dir), "%s", config->bt.scan_log_path);
+    normalize_dir_path(dir);
+
+    time_t now = time(NULL);
+    struct tm tm_now;
+    localtime_r(&now, &tm_now);
+
+    char name[32];
+    strftime(name, sizeof(name), "scan-%Y%m%d-%H%M%S.pcap", &tm_now);
+    snprintf(out_path, out_size, "%s/%s", dir, name);
+
+    int rc = bt_scan_log_export_start(out_path, 0, UINT64_MAX);
+    if (rc != 0)
+        log_warning("scan log export failed to start (%d)\n", rc);
+
+    return rc;
+}
+
+bool bt_controller_export_scan_log_poll(int *rc)
+{
+    if (!bt_scan_log_export_poll(rc))
+        return false;
+
+    if (rc && *rc != 0)
+        log_warning("scan log export failed (%d)\n", *rc);
+
+    return true;
+}
+
 // ---- bluetooth app context functions ---- ///
 void bt_controller_select_device(const device_t *device)
 {
@@ -372,8 +1251,17 @@ const device_t *bt_controller_get_selected(void)
 void bt_controller_reset_devices(void)
 {
     bt_context_clear_devices();
+    bt_device_index_clear();
+    memset(&search.hits, 0, sizeof(search.hits));
+}
+
+void bt_set_device_search(const char *query)
+{
+    snprintf(search.query, sizeof(search.query), "%s", query ? query : "");
+    bt_device_index_search(search.query, &search.hits);
 }
 
+// Every filter starts from here, so the search composes with all of them.
 void bt_reset_visible_devices(void)
 {
     local_ctx.amount = 0;
@@ -381,7 +1269,8 @@ void bt_reset_visible_devices(void)
     device_t *devices = bt_context_get_devices();
     int current_devices = bt_context_devices_length();
     for (int i = 0; i < current_devices; i++) {
-        local_ctx.devices[local_ctx.amount++] = devices[i];
+        if (bt_device_set_has(&search.hits, i))
+            local_ctx.devices[local_ctx.amount++] = devices[i];
     }
 }
 
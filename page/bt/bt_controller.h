@@ -3,23 +3,81 @@
 
 #include "service/uart_service.h"
 #include "types.h"
+#include "bt_conn_table.h"
+#include "bt_gatt_db.h"
 #include "config.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+// `info` passed with BT_CONN_READY when the services came from the GATT cache.
+#define BT_CONN_INFO_CACHED "cache"
+
+// Longest value bt_gatt_write() accepts; the hex has to fit in one UART frame.
+#define BT_GATT_WRITE_MAX_LEN 100
+
+// props bitmask = ESP_GATT_CHAR_PROP_BIT_*.
+#define BT_CHAR_PROP_READ     0x02
+#define BT_CHAR_PROP_WRITE_NR 0x04
+#define BT_CHAR_PROP_WRITE    0x08
+#define BT_CHAR_PROP_NOTIFY   0x10
+#define BT_CHAR_PROP_INDICATE 0x20
+
+typedef enum {
+    BT_GATT_OP_READ = 0,
+    BT_GATT_OP_WRITE,
+    BT_GATT_OP_SUBSCRIBE
+} bt_gatt_op_t;
+
+// Connection intervals travel in 1.25 ms units, supervision timeouts in 10 ms units.
+#define BT_CONN_INTERVAL_UNITS(ms) (((ms) * 4 + 4) / 5)
+#define BT_CONN_TIMEOUT_UNITS(ms)  ((ms) / 10)
+
+typedef enum {
+    BT_TPUT_READ = 0,       // back-to-back reads of one characteristic
+    BT_TPUT_NOTIFY          // counts notifications of one characteristic
+} bt_tput_mode_t;
+
+/*
+ * Throughput test result. The ESP32 runs the test on its side and only sends
+ * counters, so the UART speed doesn't cap what gets measured.
+ */
+typedef struct {
+    bt_tput_mode_t mode;
+    int conn_id;
+    unsigned int handle;
+    uint32_t bytes;
+    uint32_t packets;
+    uint32_t errors;
+    uint32_t elapsed_ms;
+    bt_link_params_t link;  // parameters the test ran with
+} bt_tput_result_t;
+
 typedef struct bt_context_t bt_context_t;
 typedef void (*scanner_handler)(device_t *device, ui_status_t status);
-typedef void (*bt_conn_handler)(bt_conn_status_t status, const char *info);
+/*
+ * Connection handlers see every link and get its id first; views filter on
+ * the connection they are showing.
+ */
+typedef void (*bt_conn_handler)(int conn_id, bt_conn_status_t status, const char *info);
+// `info` is the failure reason when `ok` is false.
+typedef void (*bt_gatt_op_handler)(int conn_id, bt_gatt_op_t op, unsigned int handle, bool ok, const char *info);
+typedef void (*bt_link_handler)(int conn_id, const bt_link_params_t *link);
+// Called with `done` false for progress; `error` is set when the test could not run.
+typedef void (*bt_tput_handler)(const bt_tput_result_t *result, bool done, const char *error);
 
 uart_status_t bt_controller_init(const uart_config_t *config);
 uart_status_t start_scan();
+uart_status_t bt_start_continuous_scan(void);
+uart_status_t bt_stop_scan(void);
+bool bt_is_continuous_scanning(void);
 void set_scanner_cb(scanner_handler new_callback);
 
 void bt_controller_select_device(const device_t *device);
 const device_t *bt_controller_get_selected(void);
 void bt_controller_reset_devices(void);
+void bt_set_device_search(const char *query);
 
 void bt_reset_visible_devices(void);
 void bt_apply_connectable_filter(void);
@@ -28,14 +86,57 @@ void bt_sort_visible_devices_by_nearest(void);
 device_t *bt_get_visible_devices(void);
 int bt_get_visible_devices_length(void);
 
-uart_status_t bt_connect(const device_t *device);
-uart_status_t bt_disconnect(void);
+/*
+ * Several peripherals can be connected at once (up to BT_MAX_CONNECTIONS).
+ * bt_connect() hands back the id of the new link, or of the existing one if
+ * the device is already connected; every other call takes that id.
+ */
+uart_status_t bt_connect(const device_t *device, int *out_conn_id);
+uart_status_t bt_disconnect(int conn_id);
 void set_conn_cb(bt_conn_handler new_callback);
-bt_conn_status_t bt_get_conn_status(void);
+bt_conn_status_t bt_get_conn_status(int conn_id);
+int bt_find_connection(const char *mac);    // -1 when not connected
+int bt_get_connections(int *conn_ids, int max);
+const bt_connection_t *bt_get_connection(int conn_id);
+
+bt_service_t *bt_get_services(int conn_id);
+int bt_get_services_length(int conn_id);
+const bt_gatt_db *bt_get_gatt_db(int conn_id);
+
+/*
+ * Characteristic operations on a connected peer, by ATT handle. Results
+ * come back through the bt_gatt_op_handler; read values and notifications
+ * are queued in the characteristic's value ring (bt_gatt_value_ring).
+ */
+uart_status_t bt_gatt_read(int conn_id, unsigned int handle);
+uart_status_t bt_gatt_write(int conn_id, unsigned int handle, const uint8_t *data, size_t len, bool with_response);
+uart_status_t bt_gatt_subscribe(int conn_id, unsigned int handle, bool enable);
+void set_gatt_op_cb(bt_gatt_op_handler new_callback);
+
+const bt_characteristic_t *bt_gatt_find_characteristic(int conn_id, unsigned int handle);
+bt_value_ring_t *bt_gatt_value_ring(int conn_id, unsigned int handle);
+
+// Link negotiation. The peer may settle on less than asked; see bt_get_link_params().
+uart_status_t bt_request_mtu(int conn_id, int mtu);
+uart_status_t bt_request_data_length(int conn_id, int tx_octets);
+uart_status_t bt_request_conn_params(int conn_id, int min_interval_units, int max_interval_units,
+                                     int latency, int timeout_units);
+uart_status_t bt_tune_link(int conn_id);
+const bt_link_params_t *bt_get_link_params(int conn_id);
+void set_link_cb(bt_link_handler new_callback);
+
+// One throughput test at a time across all links: they share the radio.
+uart_status_t bt_tput_start(int conn_id, unsigned int handle, bt_tput_mode_t mode, int duration_ms);
+uart_status_t bt_tput_stop(void);
+bool bt_tput_running(void);
+unsigned int bt_tput_kbps(const bt_tput_result_t *result);
+void set_tput_cb(bt_tput_handler new_callback);
+
+// Starts dumping the whole scan log as pcap next to it. Returns 0 and the file path once queued.
+int bt_controller_export_scan_log(char *out_path, size_t out_size);
 
-bt_service_t *bt_get_services(void);
-int bt_get_services_length(void);
-void bt_clear_discovery(void);
+// True once the export is over; `rc` is 0 if the file was written.
+bool bt_controller_export_scan_log_poll(int *rc);
 
 #ifdef __cplusplus
 }
@@ -1,32 +1,65 @@
 #include "bt_device_detail.h"
+#include "bt_ad_decoder.h"
+#include "bt_char_view.h"
 #include "bt_controller.h"
 #include "components/ui_info_panel.h"
 #include "components/ui_loading_btn.h"
 #include "components/ui_pills.h"
 #include "components/ui_theme.h"
+#include "components/nav.h"
 #include "bt_uuid_registry.h"
+#include "utils/string_utils.h"
 
 #include <ctype.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
 #define BT_BASE_UUID_TAIL "-0000-1000-8000-00805f9b34fb"
 
 static lv_obj_t *page_ref = NULL;
+static lv_obj_t *menu_ref = NULL;
+static lv_obj_t *char_page = NULL;
 static bool is_active = false;
 
+// Connection of the device on screen, -1 while it is not connected.
+static int shown_conn = -1;
+
 typedef struct {
     ui_info_panel *device_info;
 
+    lv_obj_t *adv_section;
+    ui_info_panel *adv_info;
+
     lv_obj_t *services_container;
     lv_obj_t *services_placeholder;
 
     lv_obj_t *status_label;
     ui_loading_button *connect_btn;
+
+    lv_obj_t *link_row;
+    lv_obj_t *link_label;
 } view_ctx;
 
 static view_ctx own_ctx;
 
+typedef struct {
+    ui_info_panel *panel;
+    lv_obj_t *header;
+    char uuid[BT_UUID_STR_LEN];     // what the header shows; empty for a placeholder
+    const bt_characteristic_t *last_char;
+} rendered_service;
+
+// What is already on screen, in the same order as the GATT db service list.
+static struct {
+    rendered_service *items;
+    int count;
+    int capacity;
+    unsigned int generation;
+    bt_conn_status_t shown_status;
+    lv_timer_t *timer;
+} render;
+
 static const char *status_text(bt_conn_status_t s)
 {
     switch (s) {
@@ -53,67 +86,363 @@ static void add_property_pills(ui_pills *pills, unsigned int props)
     if (props & 0x04) pills_add(pills, "WRITE NR");
 }
 
-static void render_service(lv_obj_t *parent, const bt_service_t *svc)
+static void on_char_click(lv_event_t *e)
+{
+    unsigned int handle = (unsigned int)(uintptr_t)lv_event_get_user_data(e);
+    if (!menu_ref || !char_page || bt_get_conn_status(shown_conn) != BT_CONN_READY)
+        return;
+
+    bt_char_view_open(shown_conn, handle);
+    lv_menu_set_page(menu_ref, char_page);
+    zv_nav_update_group(menu_ref, char_page);
+}
+
+static void render_characteristic(ui_info_panel *panel, const bt_characteristic_t *ch)
 {
-    ui_info_panel *panel = create_info_panel(parent, LV_PCT(100), LV_SIZE_CONTENT);
+    char ch_buf[BT_UUID_STR_LEN];
+    const char *ch_name = lookup_name(ch->uuid, ch_buf, sizeof(ch_buf));
+
+    char ch_label[80];
+    if (ch_name)
+        snprintf(ch_label, sizeof(ch_label), "%s  %s", ch_buf, ch_name);
+    else
+        snprintf(ch_label, sizeof(ch_label), "%s", ch_buf);
+
+    lv_obj_t *right = add_info_panel_custom_row(panel, ch_label);
+    if (right)
+    {
+        ui_pills *prop_pills = create_pills_sized(right, LV_SIZE_CONTENT, 30);
+        add_property_pills(prop_pills, ch->props);
+
+        // Rows with something to read, write or subscribe to open the live view.
+        unsigned int ops = BT_CHAR_PROP_READ | BT_CHAR_PROP_WRITE | BT_CHAR_PROP_WRITE_NR |
+                           BT_CHAR_PROP_NOTIFY | BT_CHAR_PROP_INDICATE;
+        if (ch->props & ops)
+        {
+            lv_obj_t *row = lv_obj_get_parent(right);
+            lv_obj_add_flag(row, LV_OBJ_FLAG_CLICKABLE);
+            lv_obj_add_event_cb(row, on_char_click, LV_EVENT_CLICKED, (void *)(uintptr_t)ch->handle);
+        }
+    }
+}
 
+static void format_service_header(const bt_service_t *svc, char *out, size_t out_sz)
+{
     char buf[BT_UUID_STR_LEN];
     const char *name = lookup_name(svc->uuid, buf, sizeof(buf));
 
-    char header_text[80];
     if (name)
-        snprintf(header_text, sizeof(header_text), "%s - %s", buf, name);
+        snprintf(out, out_sz, "%s - %s", buf, name);
     else
-        snprintf(header_text, sizeof(header_text), "%s", buf);
+        snprintf(out, out_sz, "%s", buf);
+}
+
+static void render_service_header(lv_obj_t *parent, const bt_service_t *svc, rendered_service *item)
+{
+    char header_text[80];
+    format_service_header(svc, header_text, sizeof(header_text));
+
+    item->panel = create_info_panel(parent, LV_PCT(100), LV_SIZE_CONTENT);
+    item->header = add_info_panel_header(item->panel, header_text, ZV_COLOR_ACCENT);
+    snprintf(item->uuid, sizeof(item->uuid), "%s", svc->uuid);
+}
 
-    add_info_panel_header(panel, header_text, ZV_COLOR_ACCENT);
+// A header first drawn from a placeholder (early DISCOVER:CHAR) gets its UUID and name once known.
+static void patch_service_header(const bt_service_t *svc, rendered_service *item)
+{
+    if (!item->header || strcmp(item->uuid, svc->uuid) == 0)
+        return;
 
-    for (int j = 0; j < svc->chars_count; j++)
+    char header_text[80];
+    format_service_header(svc, header_text, sizeof(header_text));
+    lv_label_set_text(item->header, header_text);
+    snprintf(item->uuid, sizeof(item->uuid), "%s", svc->uuid);
+}
+
+static void reset_services_view(void)
+{
+    const bt_gatt_db *db = bt_get_gatt_db(shown_conn);
+    render.count = 0;
+    render.generation = db ? db->generation : 0;
+    render.shown_status = BT_CONN_IDLE;
+
+    if (own_ctx.services_container)
+        lv_obj_clean(own_ctx.services_container);
+
+    if (own_ctx.services_placeholder)
+        lv_obj_clear_flag(own_ctx.services_placeholder, LV_OBJ_FLAG_HIDDEN);
+}
+
+static rendered_service *push_rendered_service(void)
+{
+    if (render.count == render.capacity)
     {
-        const bt_characteristic_t *ch = &svc->chars[j];
+        int new_capacity = render.capacity ? render.capacity * 2 : 8;
+        rendered_service *grown = (rendered_service *)realloc(render.items,
+            (size_t)new_capacity * sizeof(rendered_service));
+        if (!grown)
+            return NULL;
+
+        render.items = grown;
+        render.capacity = new_capacity;
+    }
 
-        char ch_buf[BT_UUID_STR_LEN];
-    const char *ch_name = lookup_name(ch->uuid, ch_buf, sizeof(ch_buf));
+    rendered_service *item = &render.items[render.count++];
+    memset(item, 0, sizeof(*item));
+    return item;
+}
+
+/*
+ * Brings the services tree in line with the GATT db by appending only what
+ * is new since the last flush, and relabelling headers whose service was
+ * completed. Services and characteristics are linked in discovery order, so
+ * "new" is just whatever follows the last rendered node.
+ */
+static void sync_services_list(void)
+{
+    if (!own_ctx.services_container)
+        return;
 
-        char ch_label[80];
-        if (ch_name)
-            snprintf(ch_label, sizeof(ch_label), "%s  %s", ch_buf, ch_name);
+    const bt_gatt_db *db = bt_get_gatt_db(shown_conn);
+    if (!db)
+        return;
+    if (db->generation != render.generation)
+        reset_services_view();
+
+    const bt_service_t *svcs = db->services;
+    if (!svcs)
+        return;
+
+    if (own_ctx.services_placeholder)
+        lv_obj_add_flag(own_ctx.services_placeholder, LV_OBJ_FLAG_HIDDEN);
+
+    int i = 0;
+    for (const bt_service_t *svc = svcs; svc; svc = svc->next, i++)
+    {
+        rendered_service *item;
+        if (i < render.count)
+        {
+            item = &render.items[i];
+            patch_service_header(svc, item);
+            if (item->last_char == svc->chars_tail)
+                continue;
+        }
         else
-            snprintf(ch_label, sizeof(ch_label), "%s", ch_buf);
+        {
+            item = push_rendered_service();
+            if (!item)
+                return;
 
-        lv_obj_t *right = add_info_panel_custom_row(panel, ch_label);
-        if (right)
+            render_service_header(own_ctx.services_container, svc, item);
+        }
+
+        const bt_characteristic_t *ch = item->last_char ? item->last_char->next : svc->chars;
+        for (; ch; ch = ch->next)
         {
-            ui_pills *prop_pills = create_pills_sized(right, LV_SIZE_CONTENT, 30);
-            add_property_pills(prop_pills, ch->props);
+            render_characteristic(item->panel, ch);
+            item->last_char = ch;
         }
     }
 }
 
-static void rebuild_services_list(void)
+static void render_timer_cb(lv_timer_t *t)
 {
-    if (!own_ctx.services_container)
-        return;
+    lv_timer_pause(t);
+    sync_services_list();
+}
 
-    lv_obj_clean(own_ctx.services_container);
+// Discovery events arrive one per UART line; render at most once per frame.
+static void schedule_render(void)
+{
+    if (render.timer)
+        lv_timer_resume(render.timer);
+}
 
-    bt_service_t *svcs = bt_get_services();
-    int len = bt_get_services_length();
+static void add_adv_row(const char *label, const char *value)
+{
+    kv_item_t item = { .label = label, .value = value };
+    add_info_panel_item(own_ctx.adv_info, item);
+}
+
+static void render_adv_field(const bt_ad_field_t *field)
+{
+    char label[48];
+    char value[BT_ADV_MAX_LEN * 2 + 8];
 
-    if (len == 0)
+    switch (field->type)
     {
-        if (own_ctx.services_placeholder)
-            lv_obj_clear_flag(own_ctx.services_placeholder, LV_OBJ_FLAG_HIDDEN);
+        case BT_AD_FLAGS:
+        case BT_AD_TX_POWER:
+        case BT_AD_APPEARANCE:
+        case BT_AD_NAME_SHORT:
+        case BT_AD_NAME_COMPLETE:
+            // Single-valued fields are read back through the typed getters below.
+            return;
+
+        case BT_AD_UUID16_SOME:
+        case BT_AD_UUID16_ALL:
+        case BT_AD_UUID32_SOME:
+        case BT_AD_UUID32_ALL:
+        case BT_AD_UUID128_SOME:
+        case BT_AD_UUID128_ALL:
+        {
+            size_t count = bt_ad_uuid_count(field);
+            for (size_t i = 0; i < count; i++)
+            {
+                bt_uuid_t uuid;
+                if (!bt_ad_uuid_at(field, i, &uuid))
+                    continue;
+
+                bt_uuid_format(&uuid, label, sizeof(label));
+                const char *name = bt_uuid_name(&uuid);
+                add_adv_row(label, name ? name : bt_ad_type_name(field->type));
+            }
+            return;
+        }
 
+        case BT_AD_SVC_DATA16:
+        case BT_AD_SVC_DATA32:
+        case BT_AD_SVC_DATA128:
+        {
+            bt_uuid_t uuid;
+            if (!bt_ad_uuid_at(field, 0, &uuid))
+                return;
+
+            size_t width = field->type == BT_AD_SVC_DATA16 ? 2 : field->type == BT_AD_SVC_DATA32 ? 4 : 16;
+            char uuid_buf[BT_UUID_STR_LEN];
+            bt_uuid_format(&uuid, uuid_buf, sizeof(uuid_buf));
+            snprintf(label, sizeof(label), "Data %s", uuid_buf);
+            zv_hex_encode(field->data + width, field->len - width, value, sizeof(value));
+            add_adv_row(label, value);
+            return;
+        }
+
+        case BT_AD_MANUFACTURER:
+        {
+            if (field->len < 2)
+                return;
+
+            uint16_t company_id = (uint16_t)(field->data[0] | (field->data[1] << 8));
+            const char *company = bt_company_name(company_id);
+            if (company)
+                snprintf(label, sizeof(label), "%s", company);
+            else
+                snprintf(label, sizeof(label), "Company 0x%04X", company_id);
+
+            zv_hex_encode(field->data + 2, field->len - 2, value, sizeof(value));
+            add_adv_row(label, value);
+            return;
+        }
+
+        default:
+            snprintf(label, sizeof(label), "AD 0x%02X", field->type);
+            zv_hex_encode(field->data, field->len, value, sizeof(value));
+            add_adv_row(label, value);
+            return;
+    }
+}
+
+static void render_adv_buffer(const uint8_t *buf, size_t len)
+{
+    bt_ad_iter_t it;
+    bt_ad_field_t field;
+
+    bt_ad_iter_init(&it, buf, len);
+    while (bt_ad_iter_next(&it, &field))
+        render_adv_field(&field);
+}
+
+/*
+ * Decodes the raw advertising of `device` into the ADVERTISING panel. This is
+ * the only place the AD structures get fully parsed, and it runs once per
+ * detail page open rather than once per received report.
+ */
+static void render_advertising(const device_t *device)
+{
+    if (!own_ctx.adv_info)
         return;
+
+    clear_info_panel(own_ctx.adv_info);
+
+    bool has_raw = device->adv_len > 0 || device->scan_rsp_len > 0;
+    if (own_ctx.adv_section)
+    {
+        if (has_raw) lv_obj_clear_flag(own_ctx.adv_section, LV_OBJ_FLAG_HIDDEN);
+        else         lv_obj_add_flag(own_ctx.adv_section, LV_OBJ_FLAG_HIDDEN);
     }
+    if (!has_raw)
+        return;
 
-    if (own_ctx.services_placeholder)
-        lv_obj_add_flag(own_ctx.services_placeholder, LV_OBJ_FLAG_HIDDEN);
+    char value[48];
+    const uint8_t *adv = device->adv_data;
+    const uint8_t *rsp = device->scan_rsp;
+
+    uint8_t flags;
+    if (bt_ad_get_flags(adv, device->adv_len, &flags))
+    {
+        snprintf(value, sizeof(value), "0x%02X%s%s", flags,
+                 (flags & 0x02) ? " General" : (flags & 0x01) ? " Limited" : "",
+                 (flags & 0x04) ? " LE only" : "");
+        add_adv_row("Flags", value);
+    }
 
-    for (int i = 0; i < len; i++) {
-        render_service(own_ctx.services_container, &svcs[i]);
+    if (bt_ad_get_name(adv, device->adv_len, value, sizeof(value)) ||
+        bt_ad_get_name(rsp, device->scan_rsp_len, value, sizeof(value)))
+        add_adv_row("Name", value);
+
+    int8_t tx_power;
+    if (bt_ad_get_tx_power(adv, device->adv_len, &tx_power) ||
+        bt_ad_get_tx_power(rsp, device->scan_rsp_len, &tx_power))
+    {
+        snprintf(value, sizeof(value), "%d dBm", tx_power);
+        add_adv_row("TX Power", value);
+    }
+
+    uint16_t appearance;
+    if (bt_ad_get_appearance(adv, device->adv_len, &appearance) ||
+        bt_ad_get_appearance(rsp, device->scan_rsp_len, &appearance))
+    {
+        const char *name = bt_appearance_name(appearance);
+        if (name)
+            snprintf(value, sizeof(value), "%s", name);
+        else
+            snprintf(value, sizeof(value), "0x%04X", appearance);
+        add_adv_row("Appearance", value);
     }
+
+    render_adv_buffer(adv, device->adv_len);
+    render_adv_buffer(rsp, device->scan_rsp_len);
+}
+
+static void render_link(const bt_link_params_t *link)
+{
+    if (!own_ctx.link_label)
+        return;
+
+    if (link->interval_units > 0)
+    {
+        // 1.25 ms units, shown with one decimal.
+        int interval_x10 = link->interval_units * 25 / 2;
+        lv_label_set_text_fmt(own_ctx.link_label, "MTU %d  LL %d  %d.%d ms",
+                              link->mtu, link->tx_octets, interval_x10 / 10, interval_x10 % 10);
+    }
+    else
+    {
+        lv_label_set_text_fmt(own_ctx.link_label, "MTU %d  LL %d", link->mtu, link->tx_octets);
+    }
+}
+
+static void on_link_update(int conn_id, const bt_link_params_t *link)
+{
+    if (is_active && conn_id == shown_conn)
+        render_link(link);
+}
+
+static void on_tune_click(lv_event_t *e)
+{
+    (void)e;
+    if (bt_tune_link(shown_conn) != UART_OK && own_ctx.link_label)
+        lv_label_set_text(own_ctx.link_label, "Tune request failed");
 }
 
 static void update_btn_state(bt_conn_status_t s)
@@ -124,35 +453,70 @@ static void update_btn_state(bt_conn_status_t s)
     bool loading = (s == BT_CONN_CONNECTING || s == BT_CONN_DISCOVERING);
     loading_button_set_loading(own_ctx.connect_btn, loading);
 
+    bool connected = (s == BT_CONN_CONNECTED || s == BT_CONN_DISCOVERING || s == BT_CONN_READY);
     if (s == BT_CONN_CONNECTED || s == BT_CONN_READY) {
         loading_button_set_text(own_ctx.connect_btn, "Disconnect");
     } else {
         loading_button_set_text(own_ctx.connect_btn, "Connect");
     }
+
+    if (own_ctx.link_row)
+    {
+        if (connected) lv_obj_clear_flag(own_ctx.link_row, LV_OBJ_FLAG_HIDDEN);
+        else           lv_obj_add_flag(own_ctx.link_row, LV_OBJ_FLAG_HIDDEN);
+    }
+    const bt_link_params_t *link = bt_get_link_params(shown_conn);
+    if (connected && link)
+        render_link(link);
 }
 
-static void on_conn_event(bt_conn_status_t status, const char *info)
+static bool is_terminal(bt_conn_status_t s)
 {
+    return s == BT_CONN_FAILED || s == BT_CONN_LOST || s == BT_CONN_DISCONNECTED;
+}
+
+static void on_conn_event(int conn_id, bt_conn_status_t status, const char *info)
+{
+    if (conn_id != shown_conn)
+        return;
+
+    // The controller frees the slot right after this; drop our reference with it.
+    if (is_terminal(status))
+        shown_conn = -1;
+
     if (!is_active)
         return;
 
+    // Every discovered attribute re-sends DISCOVERING; only the tree needs updating then.
+    if (status == BT_CONN_DISCOVERING && render.shown_status == BT_CONN_DISCOVERING) {
+        schedule_render();
+        return;
+    }
+    render.shown_status = status;
+
     if (own_ctx.status_label)
-        lv_label_set_text(own_ctx.status_label, status_text(status));
+    {
+        if (status == BT_CONN_READY && info && strcmp(info, BT_CONN_INFO_CACHED) == 0)
+            lv_label_set_text(own_ctx.status_label, "Ready (cached)");
+        else
+            lv_label_set_text(own_ctx.status_label, status_text(status));
+    }
 
     update_btn_state(status);
 
-    // Rebuild solo cuando termina el discovery, asi no parpadea por cada char.
-    if (status == BT_CONN_READY)
-        rebuild_services_list();
+    if (status == BT_CONN_DISCOVERING || status == BT_CONN_READY)
+        schedule_render();
+    else if (is_terminal(status))
+        reset_services_view();
 }
 
 static void on_connect_click(lv_event_t *e)
 {
     (void)e;
 
-    bt_conn_status_t s = bt_get_conn_status();
+    bt_conn_status_t s = bt_get_conn_status(shown_conn);
     if (s == BT_CONN_CONNECTED || s == BT_CONN_READY) {
-        bt_disconnect();
+        bt_disconnect(shown_conn);
         return;
     }
 
@@ -162,7 +526,10 @@ static void on_connect_click(lv_event_t *e)
         return;
     }
 
-    bt_connect(dev);
+    // shown_conn is set before the first status callback fires.
+    uart_status_t rc = bt_connect(dev, &shown_conn);
+    if (rc == UART_ERR_INVALID && own_ctx.status_label)
+        lv_label_set_text(own_ctx.status_label, "No free connection");
 }
 
 static void on_page_changed(lv_event_t *e)
@@ -175,22 +542,9 @@ static void on_page_changed(lv_event_t *e)
         return;
     }
 
-    if (cur != page_ref && is_active) {
+    // Connections outlive the page; they are closed with the Disconnect button.
+    if (cur != page_ref && cur != char_page && is_active)
         is_active = false;
-
-        bt_conn_status_t s = bt_get_conn_status();
-        if (s == BT_CONN_CONNECTED || s == BT_CONN_READY ||
-            s == BT_CONN_CONNECTING || s == BT_CONN_DISCOVERING) {
-            bt_disconnect();
-        }
-
-        bt_clear_discovery();
-        if (own_ctx.services_container) lv_obj_clean(own_ctx.services_container);
-        if (own_ctx.services_placeholder)
-            lv_obj_clear_flag(own_ctx.services_placeholder, LV_OBJ_FLAG_HIDDEN);
-        if (own_ctx.status_label) lv_label_set_text(own_ctx.status_label, status_text(BT_CONN_IDLE));
-        update_btn_state(BT_CONN_IDLE);
-    }
 }
 
 static lv_obj_t *create_section_title(lv_obj_t *parent, const char *text)
@@ -212,6 +566,7 @@ lv_obj_t *bt_device_detail_page_create(lv_obj_t *menu)
 {
     lv_obj_t *page = lv_menu_page_create(menu, "BLE Device");
     page_ref = page;
+    menu_ref = menu;
 
     lv_obj_t *root = lv_obj_create(page);
     lv_obj_set_size(root, LV_PCT(100), LV_PCT(100));
@@ -228,6 +583,20 @@ lv_obj_t *bt_device_detail_page_create(lv_obj_t *menu)
 
     own_ctx.device_info = create_info_panel(root, LV_PCT(100), LV_SIZE_CONTENT);
 
+    // Hidden until a device with raw advertising data (SCAN:ADV) is selected.
+    own_ctx.adv_section = lv_obj_create(root);
+    lv_obj_remove_style_all(own_ctx.adv_section);
+    lv_obj_set_width(own_ctx.adv_section, LV_PCT(100));
+    lv_obj_set_height(own_ctx.adv_section, LV_SIZE_CONTENT);
+    lv_obj_set_style_pad_row(own_ctx.adv_section, 10, 0);
+    lv_obj_clear_flag(own_ctx.adv_section, LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_set_layout(own_ctx.adv_section, LV_LAYOUT_FLEX);
+    lv_obj_set_flex_flow(own_ctx.adv_section, LV_FLEX_FLOW_COLUMN);
+    lv_obj_add_flag(own_ctx.adv_section, LV_OBJ_FLAG_HIDDEN);
+
+    create_section_title(own_ctx.adv_section, "ADVERTISING");
+    own_ctx.adv_info = create_info_panel(own_ctx.adv_section, LV_PCT(100), LV_SIZE_CONTENT);
+
     lv_obj_t *action_row = lv_obj_create(root);
     lv_obj_set_size(action_row, LV_PCT(100), 50);
     lv_obj_set_style_bg_opa(action_row, LV_OPA_TRANSP, 0);
@@ -247,6 +616,40 @@ lv_obj_t *bt_device_detail_page_create(lv_obj_t *menu)
     own_ctx.connect_btn = create_loading_btn(action_row, 100, 40, "Connect");
     loading_set_event_cb(own_ctx.connect_btn, on_connect_click, own_ctx.connect_btn);
 
+    // Link parameters, only while connected.
+    own_ctx.link_row = lv_obj_create(root);
+    lv_obj_set_size(own_ctx.link_row, LV_PCT(100), 44);
+    lv_obj_set_style_bg_opa(own_ctx.link_row, LV_OPA_TRANSP, 0);
+    lv_obj_set_style_border_width(own_ctx.link_row, 0, 0);
+    lv_obj_set_style_pad_all(own_ctx.link_row, 0, 0);
+    lv_obj_clear_flag(own_ctx.link_row, LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_set_layout(own_ctx.link_row, LV_LAYOUT_FLEX);
+    lv_obj_set_flex_flow(own_ctx.link_row, LV_FLEX_FLOW_ROW);
+    lv_obj_set_flex_align(own_ctx.link_row,
+        LV_FLEX_ALIGN_SPACE_BETWEEN,
+        LV_FLEX_ALIGN_CENTER,
+        LV_FLEX_ALIGN_CENTER);
+    lv_obj_add_flag(own_ctx.link_row, LV_OBJ_FLAG_HIDDEN);
+
+    own_ctx.link_label = lv_label_create(own_ctx.link_row);
+    lv_label_set_text(own_ctx.link_label, "");
+    lv_obj_set_style_text_color(own_ctx.link_label, ZV_COLOR_TEXT_MUTED, 0);
+    lv_obj_set_style_text_font(own_ctx.link_label, &lv_font_montserrat_12, 0);
+
+    lv_obj_t *tune_btn = lv_btn_create(own_ctx.link_row);
+    lv_obj_set_size(tune_btn, 100, 34);
+    lv_obj_set_style_bg_color(tune_btn, ZV_COLOR_BG_PANEL, 0);
+    lv_obj_set_style_bg_opa(tune_btn, LV_OPA_COVER, 0);
+    lv_obj_set_style_border_width(tune_btn, 2, 0);
+    lv_obj_set_style_border_color(tune_btn, ZV_COLOR_BORDER, 0);
+    lv_obj_set_style_radius(tune_btn, 10, 0);
+    lv_obj_add_event_cb(tune_btn, on_tune_click, LV_EVENT_CLICKED, NULL);
+
+    lv_obj_t *tune_label = lv_label_create(tune_btn);
+    lv_label_set_text(tune_label, "Tune");
+    lv_obj_set_style_text_color(tune_label, ZV_COLOR_TEXT_MAIN, 0);
+    lv_obj_center(tune_label);
+
     create_section_title(root, "SERVICES");
 
     own_ctx.services_placeholder = lv_label_create(root);
@@ -266,7 +669,13 @@ lv_obj_t *bt_device_detail_page_create(lv_obj_t *menu)
     lv_obj_set_layout(own_ctx.services_container, LV_LAYOUT_FLEX);
     lv_obj_set_flex_flow(own_ctx.services_container, LV_FLEX_FLOW_COLUMN);
 
+    render.timer = lv_timer_create(render_timer_cb, LV_DEF_REFR_PERIOD, NULL);
+    lv_timer_pause(render.timer);
+
+    char_page = bt_char_view_page_create(menu);
+
     set_conn_cb(on_conn_event);
+    set_link_cb(on_link_update);
     lv_obj_add_event_cb(menu, on_page_changed, LV_EVENT_VALUE_CHANGED, NULL);
 
     return page;
@@ -300,16 +709,18 @@ void bt_device_detail_refresh(void)
     for (size_t i = 0; i < sizeof(items) / sizeof(items[0]); i++)
         add_info_panel_item(own_ctx.device_info, items[i]);
 
-    if (own_ctx.services_container) 
-        lv_obj_clean(own_ctx.services_container);
+    render_advertising(device);
 
-    bt_clear_discovery();
+    // Reopening a device that is still connected picks up its link as it is.
+    shown_conn = bt_find_connection(device->mac);
+    bt_conn_status_t status = bt_get_conn_status(shown_conn);
 
-    if (own_ctx.services_placeholder)
-        lv_obj_clear_flag(own_ctx.services_placeholder, LV_OBJ_FLAG_HIDDEN);
+    reset_services_view();
+    render.shown_status = status;
 
     if (own_ctx.status_label) 
-        lv_label_set_text(own_ctx.status_label, status_text(BT_CONN_IDLE));
+        lv_label_set_text(own_ctx.status_label, status_text(status));
 
-    update_btn_state(BT_CONN_IDLE);
+    update_btn_state(status);
+    sync_services_list();
 }
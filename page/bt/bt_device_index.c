@@ -0,0 +1,243 @@
+#include "bt_device_index.h"
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define INDEX_TEXT_LEN   (sizeof(((device_t *)0)->name) + sizeof(((device_t *)0)->manufacturer) + \
+                          sizeof(((device_t *)0)->mac))
+#define INDEX_QUERY_LEN  64
+#define INDEX_MAX_GRAM   3
+
+typedef struct {
+    uint32_t gram;      // length in the top byte, then up to 3 lower-case chars
+    uint16_t slot;
+} gram_entry;
+
+static struct {
+    gram_entry *entries;
+    size_t count;
+    size_t capacity;
+
+    // Lower-case "name\nmanufacturer\nmac" as last indexed, per slot.
+    char text[BT_ALLOWED_MAX_DEVICES][INDEX_TEXT_LEN];
+    bt_device_set_t indexed;
+
+    // Previous search, patched on every update so it never goes stale.
+    char last_query[INDEX_QUERY_LEN];
+    bt_device_set_t last_hits;
+    bool has_last;
+} idx;
+
+static uint32_t pack_gram(const char *s, size_t n)
+{
+    uint32_t gram = (uint32_t)n << 24;
+    for (size_t i = 0; i < n; i++)
+        gram |= (uint32_t)(unsigned char)s[i] << (16 - 8 * i);
+    return gram;
+}
+
+static int entry_cmp(uint32_t gram, uint16_t slot, const gram_entry *e)
+{
+    if (gram != e->gram)
+        return gram < e->gram ? -1 : 1;
+    if (slot != e->slot)
+        return slot < e->slot ? -1 : 1;
+    return 0;
+}
+
+static size_t lower_bound(uint32_t gram, uint16_t slot)
+{
+    size_t lo = 0;
+    size_t hi = idx.count;
+    while (lo < hi)
+    {
+        size_t mid = lo + (hi - lo) / 2;
+        if (entry_cmp(gram, slot, &idx.entries[mid]) > 0)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo;
+}
+
+static void insert_entry(uint32_t gram, uint16_t slot)
+{
+    size_t pos = lower_bound(gram, slot);
+    if (pos < idx.count && entry_cmp(gram, slot, &idx.entries[pos]) == 0)
+        return;
+
+    if (idx.count == idx.capacity)
+    {
+        size_t new_capacity = idx.capacity ? idx.capacity * 2 : 256;
+        gram_entry *grown = (gram_entry *)realloc(idx.entries, new_capacity * sizeof(gram_entry));
+        if (!grown)
+            return;
+
+        idx.entries = grown;
+        idx.capacity = new_capacity;
+    }
+
+    memmove(&idx.entries[pos + 1], &idx.entries[pos], (idx.count - pos) * sizeof(gram_entry));
+    idx.entries[pos].gram = gram;
+    idx.entries[pos].slot = slot;
+    idx.count++;
+}
+
+static void remove_entry(uint32_t gram, uint16_t slot)
+{
+    size_t pos = lower_bound(gram, slot);
+    if (pos >= idx.count || entry_cmp(gram, slot, &idx.entries[pos]) != 0)
+        return;
+
+    memmove(&idx.entries[pos], &idx.entries[pos + 1], (idx.count - pos - 1) * sizeof(gram_entry));
+    idx.count--;
+}
+
+// Every 1..3-gram inside each '\n'-separated field; grams never span fields.
+static void for_each_gram(const char *text, uint16_t slot, void (*fn)(uint32_t, uint16_t))
+{
+    const char *field = text;
+    while (*field)
+    {
+        size_t len = strcspn(field, "\n");
+        for (size_t i = 0; i < len; i++)
+        {
+            for (size_t n = 1; n <= INDEX_MAX_GRAM && i + n <= len; n++)
+                fn(pack_gram(field + i, n), slot);
+        }
+
+        field += len;
+        if (*field == '\n')
+            field++;
+    }
+}
+
+static void lower_copy(const char *src, char *out, size_t out_size)
+{
+    size_t i = 0;
+    for (; src[i] && i + 1 < out_size; i++)
+        out[i] = (char)tolower((unsigned char)src[i]);
+    out[i] = '\0';
+}
+
+static void append_field(char *text, size_t text_size, const char *value)
+{
+    if (!value[0] || strcmp(value, UNKNOWN_NAME) == 0)
+        return;
+
+    size_t used = strlen(text);
+    if (used > 0 && used + 1 < text_size)
+        text[used++] = '\n';
+
+    lower_copy(value, text + used, text_size - used);
+}
+
+void bt_device_index_clear(void)
+{
+    idx.count = 0;
+    memset(idx.text, 0, sizeof(idx.text));
+    memset(&idx.indexed, 0, sizeof(idx.indexed));
+    idx.has_last = false;
+}
+
+bool bt_device_index_matches(int slot, const char *query)
+{
+    if (slot < 0 || slot >= BT_ALLOWED_MAX_DEVICES || !bt_device_set_has(&idx.indexed, slot))
+        return false;
+
+    char lowered[INDEX_QUERY_LEN];
+    lower_copy(query ? query : "", lowered, sizeof(lowered));
+
+    return strstr(idx.text[slot], lowered) != NULL;
+}
+
+void bt_device_index_update(int slot, const device_t *device)
+{
+    if (!device || slot < 0 || slot >= BT_ALLOWED_MAX_DEVICES)
+        return;
+
+    char text[INDEX_TEXT_LEN] = {0};
+    append_field(text, sizeof(text), device->name);
+    append_field(text, sizeof(text), device->manufacturer);
+    append_field(text, sizeof(text), device->mac);
+
+    // Most reports only move the RSSI; the text stays the same.
+    if (bt_device_set_has(&idx.indexed, slot) && strcmp(text, idx.text[slot]) == 0)
+        return;
+
+    if (bt_device_set_has(&idx.indexed, slot))
+        for_each_gram(idx.text[slot], (uint16_t)slot, remove_entry);
+
+    memcpy(idx.text[slot], text, sizeof(text));
+    for_each_gram(text, (uint16_t)slot, insert_entry);
+    bt_device_set_add(&idx.indexed, slot);
+
+    if (idx.has_last)
+    {
+        if (strstr(text, idx.last_query))
+            bt_device_set_add(&idx.last_hits, slot);
+        else
+            bt_device_set_remove(&idx.last_hits, slot);
+    }
+}
+
+static void posting(uint32_t gram, bt_device_set_t *out)
+{
+    memset(out, 0, sizeof(*out));
+    for (size_t i = lower_bound(gram, 0); i < idx.count && idx.entries[i].gram == gram; i++)
+        bt_device_set_add(out, idx.entries[i].slot);
+}
+
+static void keep_matching(bt_device_set_t *set, const char *lowered)
+{
+    for (int slot = 0; slot < BT_ALLOWED_MAX_DEVICES; slot++)
+    {
+        if (bt_device_set_has(set, slot) && !strstr(idx.text[slot], lowered))
+            bt_device_set_remove(set, slot);
+    }
+}
+
+void bt_device_index_search(const char *query, bt_device_set_t *out)
+{
+    if (!out)
+        return;
+
+    char lowered[INDEX_QUERY_LEN];
+    lower_copy(query ? query : "", lowered, sizeof(lowered));
+    size_t len = strlen(lowered);
+
+    if (len == 0)
+    {
+        *out = idx.indexed;
+    }
+    else if (idx.has_last && idx.last_query[0] && strstr(lowered, idx.last_query))
+    {
+        // Typing one more char: whatever matches now matched before.
+        *out = idx.last_hits;
+        keep_matching(out, lowered);
+    }
+    else if (len <= INDEX_MAX_GRAM)
+    {
+        posting(pack_gram(lowered, len), out);
+    }
+    else
+    {
+        posting(pack_gram(lowered, INDEX_MAX_GRAM), out);
+        for (size_t i = 1; i + INDEX_MAX_GRAM <= len; i++)
+        {
+            bt_device_set_t next;
+            posting(pack_gram(lowered + i, INDEX_MAX_GRAM), &next);
+            for (int w = 0; w < BT_DEVICE_SET_WORDS; w++)
+                out->words[w] &= next.words[w];
+        }
+
+        // Trigrams can all be present without being contiguous.
+        keep_matching(out, lowered);
+    }
+
+    snprintf(idx.last_query, sizeof(idx.last_query), "%s", lowered);
+    idx.last_hits = *out;
+    idx.has_last = true;
+}
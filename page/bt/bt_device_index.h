@@ -0,0 +1,59 @@
+#ifndef BT_DEVICE_INDEX_H
+#define BT_DEVICE_INDEX_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define BT_DEVICE_SET_WORDS ((BT_ALLOWED_MAX_DEVICES + 63) / 64)
+
+// Bitset of device store slots (index into bt_context_get_devices()).
+typedef struct {
+    uint64_t words[BT_DEVICE_SET_WORDS];
+} bt_device_set_t;
+
+static inline void bt_device_set_add(bt_device_set_t *set, int slot)
+{
+    set->words[slot / 64] |= 1ull << (slot % 64);
+}
+
+static inline void bt_device_set_remove(bt_device_set_t *set, int slot)
+{
+    set->words[slot / 64] &= ~(1ull << (slot % 64));
+}
+
+static inline bool bt_device_set_has(const bt_device_set_t *set, int slot)
+{
+    return (set->words[slot / 64] >> (slot % 64)) & 1u;
+}
+
+/*
+ * Case-insensitive substring search over name, manufacturer and MAC of every
+ * device in the store. The index is a sorted array of (n-gram, slot) pairs
+ * with every 1-, 2- and 3-gram of each field, kept up to date one device at
+ * a time as reports come in.
+ */
+void bt_device_index_clear(void);
+
+// Re-indexes `slot` only if its searchable text changed since the last call.
+void bt_device_index_update(int slot, const device_t *device);
+
+bool bt_device_index_matches(int slot, const char *query);
+
+/*
+ * Fills `out` with the slots matching `query` (all indexed slots when empty).
+ * When `query` extends the previous query and the index has not changed
+ * since, only the previous hits are checked.
+ */
+void bt_device_index_search(const char *query, bt_device_set_t *out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BT_DEVICE_INDEX_H */
@@ -0,0 +1,235 @@
+#include "bt_gatt_cache.h"
+#include "utils/file.h"
+#include "utils/logger.h"
+
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+#define GATT_CACHE_VERSION 1
+
+static char cache_dir[PATH_MAX];
+
+void bt_gatt_cache_init(const char *dir)
+{
+    snprintf(cache_dir, sizeof(cache_dir), "%s", dir ? dir : "");
+    normalize_dir_path(cache_dir);
+
+    if (cache_dir[0] && file_ensure_dir_recursive(cache_dir) != 0)
+        log_warning("[BT][gatt_cache] can't create cache dir %s", cache_dir);
+}
+
+/*
+ * "AA:BB:CC:DD:EE:FF" + type 1 -> "<cache_dir>/AABBCCDDEEFF_1.json".
+ * Random and public addresses may collide, so the type is part of the key.
+ */
+static bool cache_file_path(const char *mac, int addr_type, char *out, size_t out_size)
+{
+    if (!cache_dir[0] || !mac || !mac[0])
+        return false;
+
+    char key[18];
+    size_t j = 0;
+    for (size_t i = 0; mac[i] && j + 1 < sizeof(key); i++)
+    {
+        if (mac[i] != ':')
+            key[j++] = mac[i];
+    }
+    key[j] = '\0';
+
+    int written = snprintf(out, out_size, "%s/%s_%d.json", cache_dir, key, addr_type);
+    return written > 0 && (size_t)written < out_size;
+}
+
+bool bt_gatt_cache_exists(const char *mac, int addr_type)
+{
+    char path[PATH_MAX];
+    if (!cache_file_path(mac, addr_type, path, sizeof(path)))
+        return false;
+
+    return file_exists(path);
+}
+
+static unsigned int json_uint(cJSON *obj, const char *key)
+{
+    cJSON *v = cJSON_GetObjectItemCaseSensitive(obj, key);
+    return cJSON_IsNumber(v) ? (unsigned int)v->valuedouble : 0;
+}
+
+static const char *json_str(cJSON *obj, const char *key)
+{
+    cJSON *v = cJSON_GetObjectItemCaseSensitive(obj, key);
+    return (cJSON_IsString(v) && v->valuestring) ? v->valuestring : "";
+}
+
+bool bt_gatt_cache_load(const char *mac, int addr_type, bt_gatt_db *db,
+                        char *out_db_hash, size_t out_db_hash_size)
+{
+    char path[PATH_MAX];
+    if (!db || !cache_file_path(mac, addr_type, path, sizeof(path)))
+        return false;
+
+    if (!file_exists(path))
+        return false;
+
+    cJSON *root = read_json_file(path);
+    if (!root)
+    {
+        log_warning("[BT][gatt_cache] unreadable cache %s", path);
+        return false;
+    }
+
+    if ((int)json_uint(root, "version") != GATT_CACHE_VERSION)
+    {
+        log_debug("[BT][gatt_cache] cache %s has an old version, ignoring", path);
+        cJSON_Delete(root);
+        return false;
+    }
+
+    if (out_db_hash && out_db_hash_size > 0)
+        snprintf(out_db_hash, out_db_hash_size, "%s", json_str(root, "db_hash"));
+
+    bt_gatt_db_reset(db);
+
+    cJSON *services = cJSON_GetObjectItemCaseSensitive(root, "services");
+    cJSON *svc_json;
+    cJSON_ArrayForEach(svc_json, services)
+    {
+        int svc_index = (int)json_uint(svc_json, "svc");
+        bt_gatt_db_add_service(db, svc_index, json_str(svc_json, "uuid"),
+                               json_uint(svc_json, "start"), json_uint(svc_json, "end"));
+
+        cJSON *chars = cJSON_GetObjectItemCaseSensitive(svc_json, "chars");
+        cJSON *char_json;
+        cJSON_ArrayForEach(char_json, chars)
+        {
+            int char_index = (int)json_uint(char_json, "char");
+            bt_gatt_db_add_characteristic(db, svc_index, char_index, json_str(char_json, "uuid"),
+                                          json_uint(char_json, "props"), json_uint(char_json, "handle"));
+
+            cJSON *descs = cJSON_GetObjectItemCaseSensitive(char_json, "descs");
+            cJSON *desc_json;
+            cJSON_ArrayForEach(desc_json, descs)
+            {
+                bt_gatt_db_add_descriptor(db, svc_index, char_index, json_str(desc_json, "uuid"),
+                                          json_uint(desc_json, "handle"));
+            }
+        }
+    }
+
+    cJSON_Delete(root);
+
+    log_debug("[BT][gatt_cache] loaded %s (%d services, %d chars)",
+              path, db->services_count, db->chars_count);
+
+    return db->services_count > 0;
+}
+
+static cJSON *db_to_json(const char *mac, int addr_type, const char *db_hash, const bt_gatt_db *db)
+{
+    cJSON *root = cJSON_CreateObject();
+    cJSON_AddNumberToObject(root, "version", GATT_CACHE_VERSION);
+    cJSON_AddStringToObject(root, "mac", mac);
+    cJSON_AddNumberToObject(root, "addr_type", addr_type);
+    cJSON_AddStringToObject(root, "db_hash", db_hash ? db_hash : "");
+
+    cJSON *services = cJSON_AddArrayToObject(root, "services");
+    for (const bt_service_t *svc = db->services; svc; svc = svc->next)
+    {
+        cJSON *svc_json = cJSON_CreateObject();
+        cJSON_AddNumberToObject(svc_json, "svc", svc->svc_index);
+        cJSON_AddStringToObject(svc_json, "uuid", svc->uuid);
+        cJSON_AddNumberToObject(svc_json, "start", svc->start_handle);
+        cJSON_AddNumberToObject(svc_json, "end", svc->end_handle);
+
+        cJSON *chars = cJSON_AddArrayToObject(svc_json, "chars");
+        for (const bt_characteristic_t *ch = svc->chars; ch; ch = ch->next)
+        {
+            cJSON *char_json = cJSON_CreateObject();
+            cJSON_AddNumberToObject(char_json, "char", ch->char_index);
+            cJSON_AddStringToObject(char_json, "uuid", ch->uuid);
+            cJSON_AddNumberToObject(char_json, "props", ch->props);
+            cJSON_AddNumberToObject(char_json, "handle", ch->handle);
+
+            if (ch->descs)
+            {
+                cJSON *descs = cJSON_AddArrayToObject(char_json, "descs");
+                for (const bt_descriptor_t *desc = ch->descs; desc; desc = desc->next)
+                {
+                    cJSON *desc_json = cJSON_CreateObject();
+                    cJSON_AddStringToObject(desc_json, "uuid", desc->uuid);
+                    cJSON_AddNumberToObject(desc_json, "handle", desc->handle);
+                    cJSON_AddItemToArray(descs, desc_json);
+                }
+            }
+
+            cJSON_AddItemToArray(chars, char_json);
+        }
+
+        cJSON_AddItemToArray(services, svc_json);
+    }
+
+    return root;
+}
+
+int bt_gatt_cache_save(const char *mac, int addr_type, const char *db_hash, const bt_gatt_db *db)
+{
+    char path[PATH_MAX];
+    if (!db || !cache_file_path(mac, addr_type, path, sizeof(path)))
+        return -1;
+
+    if (db->services_count == 0)
+        return -1;
+
+    cJSON *root = db_to_json(mac, addr_type, db_hash, db);
+    if (!root)
+        return -2;
+
+    // Compact output: these files are never edited by hand and big dbs add up.
+    char *printed = cJSON_PrintUnformatted(root);
+    cJSON_Delete(root);
+    if (!printed)
+        return -3;
+
+    int rc = write_entire_file(path, printed, strlen(printed));
+    cJSON_free(printed);
+
+    if (rc != 0)
+        log_warning("[BT][gatt_cache] failed to write %s", path);
+    else
+        log_debug("[BT][gatt_cache] saved %s", path);
+
+    return rc;
+}
+
+void bt_gatt_cache_invalidate(const char *mac, int addr_type)
+{
+    char path[PATH_MAX];
+    if (!cache_file_path(mac, addr_type, path, sizeof(path)))
+        return;
+
+    if (file_exists(path) && remove(path) != 0)
+        log_warning("[BT][gatt_cache] failed to remove %s", path);
+}
+
+static bool has_service_changed(const bt_gatt_db *db)
+{
+    return bt_gatt_db_find_by_uuid(db, BT_ATTR_CHARACTERISTIC, "2A05").kind != BT_ATTR_NONE;
+}
+
+bool bt_gatt_cache_is_valid(const bt_gatt_db *db, const char *cached_hash, const char *device_hash)
+{
+    bool cached_has_hash = cached_hash && cached_hash[0];
+    bool device_has_hash = device_hash && device_hash[0];
+
+    if (cached_has_hash && device_has_hash)
+        return strcasecmp(cached_hash, device_hash) == 0;
+
+    // A hash appeared or disappeared: the db changed in some way.
+    if (cached_has_hash != device_has_hash)
+        return false;
+
+    return has_service_changed(db);
+}
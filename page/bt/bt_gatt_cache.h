@@ -0,0 +1,38 @@
+#ifndef BT_GATT_CACHE_H
+#define BT_GATT_CACHE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "bt_gatt_db.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define BT_GATT_DB_HASH_LEN 33   // 16-byte Database Hash as hex + '\0'
+
+/*
+ * On-disk copy of the attribute table of every peripheral we have fully
+ * discovered, one JSON file per (MAC, address type) under `cache_dir`.
+ *
+ * A cache entry stores the Database Hash (0x2B2A) the peripheral reported on
+ * connect, if any. It is considered valid when the hashes match, or, when the
+ * peripheral has no hash, when its db exposes Service Changed (0x2A05): in
+ * that case the peripheral itself tells us when the table changes.
+ */
+void bt_gatt_cache_init(const char *cache_dir);
+
+bool bt_gatt_cache_exists(const char *mac, int addr_type);
+bool bt_gatt_cache_load(const char *mac, int addr_type, bt_gatt_db *db,
+                        char *out_db_hash, size_t out_db_hash_size);
+int bt_gatt_cache_save(const char *mac, int addr_type, const char *db_hash, const bt_gatt_db *db);
+void bt_gatt_cache_invalidate(const char *mac, int addr_type);
+
+bool bt_gatt_cache_is_valid(const bt_gatt_db *db, const char *cached_hash, const char *device_hash);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BT_GATT_CACHE_H */
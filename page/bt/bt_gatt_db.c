@@ -0,0 +1,422 @@
+#include "bt_gatt_db.h"
+#include "bt_uuid_registry.h"
+#include "utils/logger.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define GATT_ARENA_BLOCK_SIZE 4096
+#define GATT_TABLE_MIN_CAPACITY 64
+#define GATT_INDEX_MIN_CAPACITY 16
+
+struct bt_gatt_slot_t {
+    uint32_t hash;          // 0 means empty slot
+    bt_gatt_attr_t attr;
+};
+
+static uint32_t hash_handle(unsigned int handle)
+{
+    // Knuth multiplicative hash, forced non-zero so 0 can mark empty slots.
+    uint32_t h = (uint32_t)handle * 2654435761u;
+    return h ? h : 1;
+}
+
+static uint32_t hash_uuid(bt_attr_kind_t kind, const bt_uuid_t *uuid)
+{
+    // FNV-1a over the binary UUID, seeded with the attribute kind.
+    uint32_t h = 2166136261u ^ (uint32_t)kind;
+    for (size_t i = 0; i < sizeof(uuid->bytes); i++)
+    {
+        h ^= uuid->bytes[i];
+        h *= 16777619u;
+    }
+    return h ? h : 1;
+}
+
+static const bt_uuid_t *attr_uuid(const bt_gatt_attr_t *attr)
+{
+    switch (attr->kind)
+    {
+        case BT_ATTR_SERVICE:        return &attr->service->uuid_key;
+        case BT_ATTR_CHARACTERISTIC: return &attr->characteristic->uuid_key;
+        case BT_ATTR_DESCRIPTOR:     return &attr->descriptor->uuid_key;
+        default:                     return NULL;
+    }
+}
+
+// Fills the binary key from the text UUID; all zeroes when it can't be parsed.
+static bool set_uuid(char *text, size_t text_size, bt_uuid_t *key, const char *uuid)
+{
+    snprintf(text, text_size, "%s", uuid ? uuid : "");
+    if (bt_uuid_parse(text, key))
+        return true;
+
+    memset(key, 0, sizeof(*key));
+    return false;
+}
+
+static unsigned int attr_handle(const bt_gatt_attr_t *attr)
+{
+    switch (attr->kind)
+    {
+        case BT_ATTR_SERVICE:        return attr->service->start_handle;
+        case BT_ATTR_CHARACTERISTIC: return attr->characteristic->handle;
+        case BT_ATTR_DESCRIPTOR:     return attr->descriptor->handle;
+        default:                     return 0;
+    }
+}
+
+static void slot_insert(bt_gatt_slot_t *slots, size_t capacity, uint32_t hash, bt_gatt_attr_t attr)
+{
+    size_t mask = capacity - 1;
+    size_t i = hash & mask;
+    while (slots[i].hash != 0)
+        i = (i + 1) & mask;
+
+    slots[i].hash = hash;
+    slots[i].attr = attr;
+}
+
+/*
+ * Grows an open-addressing table to keep the load factor under 3/4.
+ * Capacities are powers of two so probing can use a mask.
+ */
+static bool table_reserve(bt_gatt_slot_t **slots, size_t *capacity, size_t used)
+{
+    if (*slots && (used + 1) * 4 < *capacity * 3)
+        return true;
+
+    size_t new_capacity = *capacity ? *capacity * 2 : GATT_TABLE_MIN_CAPACITY;
+    bt_gatt_slot_t *grown = (bt_gatt_slot_t *)calloc(new_capacity, sizeof(bt_gatt_slot_t));
+    if (!grown)
+        return false;
+
+    for (size_t i = 0; i < *capacity; i++)
+    {
+        if ((*slots)[i].hash != 0)
+            slot_insert(grown, new_capacity, (*slots)[i].hash, (*slots)[i].attr);
+    }
+
+    free(*slots);
+    *slots = grown;
+    *capacity = new_capacity;
+    return true;
+}
+
+static void index_handle(bt_gatt_db *db, bt_gatt_attr_t attr)
+{
+    unsigned int handle = attr_handle(&attr);
+    if (handle == 0)
+        return;
+
+    if (!table_reserve(&db->handles, &db->handles_capacity, db->handles_used))
+    {
+        log_warning("[BT][gatt_db] handle index out of memory");
+        return;
+    }
+
+    slot_insert(db->handles, db->handles_capacity, hash_handle(handle), attr);
+    db->handles_used++;
+}
+
+static void index_uuid(bt_gatt_db *db, bt_gatt_attr_t attr)
+{
+    const bt_uuid_t *uuid = attr_uuid(&attr);
+
+    // Keep the first attribute per (kind, uuid); later duplicates stay reachable by handle.
+    if (bt_gatt_db_find_by_uuid_key(db, attr.kind, uuid).kind != BT_ATTR_NONE)
+        return;
+
+    if (!table_reserve(&db->uuids, &db->uuids_capacity, db->uuids_used))
+    {
+        log_warning("[BT][gatt_db] uuid index out of memory");
+        return;
+    }
+
+    slot_insert(db->uuids, db->uuids_capacity, hash_uuid(attr.kind, uuid), attr);
+    db->uuids_used++;
+}
+
+static bool reserve_index(bt_gatt_db *db, int svc_index)
+{
+    if (svc_index < db->by_index_capacity)
+        return true;
+
+    int new_capacity = db->by_index_capacity ? db->by_index_capacity : GATT_INDEX_MIN_CAPACITY;
+    while (new_capacity <= svc_index)
+        new_capacity *= 2;
+
+    bt_service_t **grown = (bt_service_t **)realloc(db->by_index, (size_t)new_capacity * sizeof(bt_service_t *));
+    if (!grown)
+        return false;
+
+    memset(grown + db->by_index_capacity, 0,
+           (size_t)(new_capacity - db->by_index_capacity) * sizeof(bt_service_t *));
+
+    db->by_index = grown;
+    db->by_index_capacity = new_capacity;
+    return true;
+}
+
+void bt_gatt_db_init(bt_gatt_db *db)
+{
+    if (!db)
+        return;
+
+    memset(db, 0, sizeof(*db));
+    zv_arena_init(&db->arena, GATT_ARENA_BLOCK_SIZE);
+}
+
+void bt_gatt_db_reset(bt_gatt_db *db)
+{
+    if (!db)
+        return;
+
+    unsigned int generation = db->generation;
+
+    zv_arena_reset(&db->arena);
+    free(db->by_index);
+    free(db->handles);
+    free(db->uuids);
+
+    bt_gatt_db_init(db);
+    db->generation = generation + 1;
+}
+
+bt_service_t *bt_gatt_db_service_at(const bt_gatt_db *db, int svc_index)
+{
+    if (!db || svc_index < 0 || svc_index >= db->by_index_capacity)
+        return NULL;
+
+    return db->by_index[svc_index];
+}
+
+bt_service_t *bt_gatt_db_add_service(bt_gatt_db *db, int svc_index, const char *uuid,
+                                     unsigned int start_handle, unsigned int end_handle)
+{
+    if (!db || svc_index < 0)
+        return NULL;
+
+    bt_service_t *svc = bt_gatt_db_service_at(db, svc_index);
+    if (svc)
+    {
+        // A placeholder created by an early DISCOVER:CHAR gets its real UUID and handles now.
+        bt_gatt_attr_t attr = { BT_ATTR_SERVICE, { svc } };
+        if (!svc->uuid[0] && uuid && uuid[0])
+        {
+            if (set_uuid(svc->uuid, sizeof(svc->uuid), &svc->uuid_key, uuid))
+                index_uuid(db, attr);
+        }
+        if (svc->start_handle == 0 && start_handle != 0)
+        {
+            svc->start_handle = start_handle;
+            svc->end_handle = end_handle;
+            index_handle(db, attr);
+        }
+        return svc;
+    }
+
+    if (!reserve_index(db, svc_index))
+    {
+        log_warning("[BT][gatt_db] service index out of memory (svc=%d)", svc_index);
+        return NULL;
+    }
+
+    svc = (bt_service_t *)zv_arena_alloc(&db->arena, sizeof(bt_service_t));
+    if (!svc)
+    {
+        log_warning("[BT][gatt_db] arena out of memory adding svc=%d", svc_index);
+        return NULL;
+    }
+
+    svc->svc_index = svc_index;
+    bool has_key = set_uuid(svc->uuid, sizeof(svc->uuid), &svc->uuid_key, uuid);
+    svc->start_handle = start_handle;
+    svc->end_handle = end_handle;
+
+    if (db->services_tail)
+        db->services_tail->next = svc;
+    else
+        db->services = svc;
+    db->services_tail = svc;
+    db->services_count++;
+    db->by_index[svc_index] = svc;
+
+    bt_gatt_attr_t attr = { BT_ATTR_SERVICE, { svc } };
+    index_handle(db, attr);
+    if (has_key)
+        index_uuid(db, attr);
+
+    return svc;
+}
+
+bt_characteristic_t *bt_gatt_db_add_characteristic(bt_gatt_db *db, int svc_index, int char_index,
+                                                   const char *uuid, unsigned int props, unsigned int handle)
+{
+    if (!db)
+        return NULL;
+
+    bt_service_t *svc = bt_gatt_db_service_at(db, svc_index);
+    if (!svc)
+    {
+        svc = bt_gatt_db_add_service(db, svc_index, "", 0, 0);
+        if (!svc)
+            return NULL;
+    }
+
+    bt_characteristic_t *ch = (bt_characteristic_t *)zv_arena_alloc(&db->arena, sizeof(bt_characteristic_t));
+    if (!ch)
+    {
+        log_warning("[BT][gatt_db] arena out of memory adding char svc=%d char=%d", svc_index, char_index);
+        return NULL;
+    }
+
+    ch->char_index = char_index;
+    bool has_key = set_uuid(ch->uuid, sizeof(ch->uuid), &ch->uuid_key, uuid);
+    ch->props = props;
+    ch->handle = handle;
+    ch->service = svc;
+
+    if (svc->chars_tail)
+        svc->chars_tail->next = ch;
+    else
+        svc->chars = ch;
+    svc->chars_tail = ch;
+    svc->chars_count++;
+    db->chars_count++;
+    db->last_char = ch;
+
+    bt_gatt_attr_t attr;
+    attr.kind = BT_ATTR_CHARACTERISTIC;
+    attr.characteristic = ch;
+    index_handle(db, attr);
+    if (has_key)
+        index_uuid(db, attr);
+
+    return ch;
+}
+
+static bt_characteristic_t *find_characteristic(bt_gatt_db *db, int svc_index, int char_index)
+{
+    // Descriptors arrive right after their characteristic, so the last one is almost always it.
+    bt_characteristic_t *last = db->last_char;
+    if (last && last->char_index == char_index && last->service->svc_index == svc_index)
+        return last;
+
+    bt_service_t *svc = bt_gatt_db_service_at(db, svc_index);
+    if (!svc)
+        return NULL;
+
+    for (bt_characteristic_t *ch = svc->chars; ch; ch = ch->next)
+    {
+        if (ch->char_index == char_index)
+            return ch;
+    }
+
+    return NULL;
+}
+
+bt_descriptor_t *bt_gatt_db_add_descriptor(bt_gatt_db *db, int svc_index, int char_index,
+                                           const char *uuid, unsigned int handle)
+{
+    if (!db)
+        return NULL;
+
+    bt_characteristic_t *ch = find_characteristic(db, svc_index, char_index);
+    if (!ch)
+    {
+        log_warning("[BT][gatt_db] descriptor for unknown char svc=%d char=%d", svc_index, char_index);
+        return NULL;
+    }
+
+    bt_descriptor_t *desc = (bt_descriptor_t *)zv_arena_alloc(&db->arena, sizeof(bt_descriptor_t));
+    if (!desc)
+    {
+        log_warning("[BT][gatt_db] arena out of memory adding desc svc=%d char=%d", svc_index, char_index);
+        return NULL;
+    }
+
+    bool has_key = set_uuid(desc->uuid, sizeof(desc->uuid), &desc->uuid_key, uuid);
+    desc->handle = handle;
+    desc->characteristic = ch;
+
+    if (ch->descs_tail)
+        ch->descs_tail->next = desc;
+    else
+        ch->descs = desc;
+    ch->descs_tail = desc;
+    ch->descs_count++;
+    db->descs_count++;
+
+    bt_gatt_attr_t attr;
+    attr.kind = BT_ATTR_DESCRIPTOR;
+    attr.descriptor = desc;
+    index_handle(db, attr);
+    if (has_key)
+        index_uuid(db, attr);
+
+    return desc;
+}
+
+bt_gatt_attr_t bt_gatt_db_find_by_handle(const bt_gatt_db *db, unsigned int handle)
+{
+    bt_gatt_attr_t none = { BT_ATTR_NONE, { NULL } };
+    if (!db || !db->handles || handle == 0)
+        return none;
+
+    uint32_t hash = hash_handle(handle);
+    size_t mask = db->handles_capacity - 1;
+    for (size_t i = hash & mask; db->handles[i].hash != 0; i = (i + 1) & mask)
+    {
+        const bt_gatt_slot_t *slot = &db->handles[i];
+        if (slot->hash == hash && attr_handle(&slot->attr) == handle)
+            return slot->attr;
+    }
+
+    return none;
+}
+
+bt_gatt_attr_t bt_gatt_db_find_by_uuid_key(const bt_gatt_db *db, bt_attr_kind_t kind, const bt_uuid_t *uuid)
+{
+    bt_gatt_attr_t none = { BT_ATTR_NONE, { NULL } };
+    if (!db || !db->uuids || !uuid)
+        return none;
+
+    uint32_t hash = hash_uuid(kind, uuid);
+    size_t mask = db->uuids_capacity - 1;
+    for (size_t i = hash & mask; db->uuids[i].hash != 0; i = (i + 1) & mask)
+    {
+        const bt_gatt_slot_t *slot = &db->uuids[i];
+        if (slot->hash == hash && slot->attr.kind == kind && bt_uuid_equal(attr_uuid(&slot->attr), uuid))
+            return slot->attr;
+    }
+
+    return none;
+}
+
+bt_gatt_attr_t bt_gatt_db_find_by_uuid(const bt_gatt_db *db, bt_attr_kind_t kind, const char *uuid)
+{
+    bt_uuid_t key;
+    if (!bt_uuid_parse(uuid, &key)) {
+        bt_gatt_attr_t none = { BT_ATTR_NONE, { NULL } };
+        return none;
+    }
+
+    return bt_gatt_db_find_by_uuid_key(db, kind, &key);
+}
+
+bt_value_ring_t *bt_gatt_db_value_ring(bt_gatt_db *db, bt_characteristic_t *ch)
+{
+    if (!db || !ch)
+        return NULL;
+
+    if (!ch->values)
+    {
+        // zv_arena_alloc hands back zeroed memory, which is an empty ring.
+        ch->values = (bt_value_ring_t *)zv_arena_alloc(&db->arena, sizeof(bt_value_ring_t));
+    }
+
+    return ch->values;
+}
@@ -0,0 +1,87 @@
+#ifndef BT_GATT_DB_H
+#define BT_GATT_DB_H
+
+#include "bt_value_ring.h"
+#include "types.h"
+#include "utils/arena.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+    BT_ATTR_NONE = 0,
+    BT_ATTR_SERVICE,
+    BT_ATTR_CHARACTERISTIC,
+    BT_ATTR_DESCRIPTOR
+} bt_attr_kind_t;
+
+typedef struct {
+    bt_attr_kind_t kind;
+    union {
+        bt_service_t *service;
+        bt_characteristic_t *characteristic;
+        bt_descriptor_t *descriptor;
+        void *ptr;
+    };
+} bt_gatt_attr_t;
+
+typedef struct bt_gatt_slot_t bt_gatt_slot_t;
+
+/*
+ * Discovered attribute table of the connected peripheral.
+ *
+ * Services, characteristics and descriptors are allocated from one arena and
+ * linked in discovery order. Two open-addressing tables give O(1) lookups by
+ * ATT handle and by binary UUID (any textual form matches), and services are also indexed by the `svc=` number
+ * the ESP32 sends. Nothing has a fixed upper bound: tables grow on demand.
+ */
+typedef struct {
+    zv_arena arena;
+
+    bt_service_t *services;
+    bt_service_t *services_tail;
+    int services_count;
+    int chars_count;
+    int descs_count;
+
+    bt_service_t **by_index;
+    int by_index_capacity;
+
+    bt_gatt_slot_t *handles;
+    size_t handles_capacity;
+    size_t handles_used;
+
+    bt_gatt_slot_t *uuids;
+    size_t uuids_capacity;
+    size_t uuids_used;
+
+    bt_characteristic_t *last_char;
+
+    // Bumped on every reset so viewers can tell a fresh table from the old one.
+    unsigned int generation;
+} bt_gatt_db;
+
+void bt_gatt_db_init(bt_gatt_db *db);
+void bt_gatt_db_reset(bt_gatt_db *db);
+
+bt_service_t *bt_gatt_db_add_service(bt_gatt_db *db, int svc_index, const char *uuid,
+                                     unsigned int start_handle, unsigned int end_handle);
+bt_characteristic_t *bt_gatt_db_add_characteristic(bt_gatt_db *db, int svc_index, int char_index,
+                                                   const char *uuid, unsigned int props, unsigned int handle);
+bt_descriptor_t *bt_gatt_db_add_descriptor(bt_gatt_db *db, int svc_index, int char_index,
+                                           const char *uuid, unsigned int handle);
+
+bt_service_t *bt_gatt_db_service_at(const bt_gatt_db *db, int svc_index);
+bt_gatt_attr_t bt_gatt_db_find_by_handle(const bt_gatt_db *db, unsigned int handle);
+bt_gatt_attr_t bt_gatt_db_find_by_uuid(const bt_gatt_db *db, bt_attr_kind_t kind, const char *uuid);
+bt_gatt_attr_t bt_gatt_db_find_by_uuid_key(const bt_gatt_db *db, bt_attr_kind_t kind, const bt_uuid_t *uuid);
+
+// Value ring of `ch`, allocated from the db arena on first use so it goes away with the table.
+bt_value_ring_t *bt_gatt_db_value_ring(bt_gatt_db *db, bt_characteristic_t *ch);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BT_GATT_DB_H */
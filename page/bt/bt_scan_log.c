@@ -0,0 +1,849 @@
+#include "bt_scan_log.h"
+#include "utils/file.h"
+#include "utils/logger.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <pthread.h>
+#include <semaphore.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#define SCAN_LOG_MAGIC   "ZVSCNLOG"
+#define SCAN_LOG_VERSION 1
+#define SCAN_LOG_FILE    "scan.log"
+#define SCAN_INDEX_FILE  "scan.idx"
+#define SCAN_LOG_OLD     "scan.log.1"
+#define SCAN_INDEX_OLD   "scan.idx.1"
+
+// Must be a power of two. A full scan rarely goes over a few reports per frame.
+#define SCAN_LOG_RING_SIZE 256
+#define SCAN_LOG_BATCH     32
+
+// Records the writer exports between two looks at the ring; whole blocks, so the index still applies.
+#define SCAN_LOG_EXPORT_CHUNK (16 * BT_SCAN_LOG_BLOCK_RECORDS)
+
+typedef struct {
+    char magic[8];
+    uint32_t version;
+    uint32_t record_size;
+    uint32_t block_records;
+    uint32_t reserved0;
+    uint64_t created_us;
+    uint8_t reserved[32];
+} scan_log_header_t;
+
+typedef char scan_record_size_check[(sizeof(bt_scan_record_t) == 96) ? 1 : -1];
+typedef char scan_header_size_check[(sizeof(scan_log_header_t) == 64) ? 1 : -1];
+
+typedef struct {
+    FILE *out;
+    size_t packets;
+} pcap_ctx;
+
+typedef enum {
+    EXPORT_IDLE = 0,
+    EXPORT_PENDING,     // set by the UI thread, picked up by the writer
+    EXPORT_RUNNING,
+    EXPORT_DONE,        // `rc` is valid
+} export_state_t;
+
+// Segments in export order: the rotated-out file first, then the live one.
+#define SCAN_LOG_SEGMENTS 2
+
+typedef struct {
+    char path[PATH_MAX];
+    uint64_t from_us;
+    uint64_t to_us;
+    int rc;
+
+    // Writer thread only.
+    pcap_ctx ctx;
+    bt_scan_log_reader reader;
+    int segment;
+    size_t next;
+} export_job_t;
+
+static struct {
+    char log_path[PATH_MAX];
+    char index_path[PATH_MAX];
+    char old_log_path[PATH_MAX];
+    char old_index_path[PATH_MAX];
+    uint64_t max_records;       // per segment, 0 = no cap
+
+    // Owned by the writer thread once it is running.
+    int log_fd;
+    int index_fd;
+    uint64_t records;
+    bt_scan_log_block_t block;
+
+    pthread_t thread;
+    sem_t wake;
+    bool running;
+
+    // Single producer (UI thread) / single consumer (writer thread).
+    bt_scan_record_t ring[SCAN_LOG_RING_SIZE];
+    unsigned int head;
+    unsigned int tail;
+    unsigned int dropped;
+
+    export_state_t export_state;
+    export_job_t export_job;
+} slog = { .log_fd = -1, .index_fd = -1 };
+
+static uint64_t now_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_REALTIME, &ts);
+    return (uint64_t)ts.tv_sec * 1000000ull + (uint64_t)ts.tv_nsec / 1000ull;
+}
+
+static void block_reset(bt_scan_log_block_t *block)
+{
+    block->min_ts_us = UINT64_MAX;
+    block->max_ts_us = 0;
+}
+
+static void block_extend(bt_scan_log_block_t *block, uint64_t ts_us)
+{
+    if (ts_us < block->min_ts_us) block->min_ts_us = ts_us;
+    if (ts_us > block->max_ts_us) block->max_ts_us = ts_us;
+}
+
+static int write_all(int fd, const void *data, size_t len)
+{
+    const uint8_t *p = (const uint8_t *)data;
+    while (len > 0)
+    {
+        ssize_t n = write(fd, p, len);
+        if (n < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            return -1;
+        }
+        p += n;
+        len -= (size_t)n;
+    }
+
+    return 0;
+}
+
+static off_t record_offset(uint64_t index)
+{
+    return (off_t)(sizeof(scan_log_header_t) + index * sizeof(bt_scan_record_t));
+}
+
+static bool read_block_span(uint64_t first, uint64_t count, bt_scan_log_block_t *out)
+{
+    block_reset(out);
+
+    bt_scan_record_t rec;
+    for (uint64_t i = 0; i < count; i++)
+    {
+        if (pread(slog.log_fd, &rec, sizeof(rec), record_offset(first + i)) != (ssize_t)sizeof(rec))
+            return false;
+        block_extend(out, rec.ts_us);
+    }
+
+    return true;
+}
+
+/*
+ * Opens scan.log for appending. A header from another version starts the log
+ * over; a record cut in half by a crash is trimmed away.
+ */
+static bool open_log_file(void)
+{
+    slog.log_fd = open(slog.log_path, O_RDWR | O_CREAT, 0644);
+    if (slog.log_fd < 0)
+        return false;
+
+    struct stat st;
+    if (fstat(slog.log_fd, &st) != 0)
+        return false;
+
+    scan_log_header_t header;
+    bool valid = st.st_size >= (off_t)sizeof(header) &&
+                 pread(slog.log_fd, &header, sizeof(header), 0) == (ssize_t)sizeof(header) &&
+                 memcmp(header.magic, SCAN_LOG_MAGIC, sizeof(header.magic)) == 0 &&
+                 header.version == SCAN_LOG_VERSION &&
+                 header.record_size == sizeof(bt_scan_record_t) &&
+                 header.block_records == BT_SCAN_LOG_BLOCK_RECORDS;
+
+    if (!valid)
+    {
+        if (st.st_size > 0)
+            log_warning("[BT][scan_log] %s has an unknown format, starting over", slog.log_path);
+
+        memset(&header, 0, sizeof(header));
+        memcpy(header.magic, SCAN_LOG_MAGIC, sizeof(header.magic));
+        header.version = SCAN_LOG_VERSION;
+        header.record_size = sizeof(bt_scan_record_t);
+        header.block_records = BT_SCAN_LOG_BLOCK_RECORDS;
+        header.created_us = now_us();
+
+        if (ftruncate(slog.log_fd, 0) != 0 || pwrite(slog.log_fd, &header, sizeof(header), 0) != (ssize_t)sizeof(header))
+            return false;
+
+        st.st_size = sizeof(header);
+    }
+
+    slog.records = (uint64_t)(st.st_size - (off_t)sizeof(header)) / sizeof(bt_scan_record_t);
+    if (record_offset(slog.records) != st.st_size && ftruncate(slog.log_fd, record_offset(slog.records)) != 0)
+        return false;
+
+    return lseek(slog.log_fd, 0, SEEK_END) >= 0;
+}
+
+/*
+ * The index is written after the records it describes, so after a crash it
+ * can only be behind the log. Anything that does not line up is rebuilt.
+ */
+static bool open_index_file(void)
+{
+    slog.index_fd = open(slog.index_path, O_RDWR | O_CREAT, 0644);
+    if (slog.index_fd < 0)
+        return false;
+
+    struct stat st;
+    if (fstat(slog.index_fd, &st) != 0)
+        return false;
+
+    uint64_t sealed = slog.records / BT_SCAN_LOG_BLOCK_RECORDS;
+    if ((uint64_t)st.st_size != sealed * sizeof(bt_scan_log_block_t))
+    {
+        log_debug("[BT][scan_log] rebuilding index for %llu blocks", (unsigned long long)sealed);
+
+        if (ftruncate(slog.index_fd, 0) != 0)
+            return false;
+
+        for (uint64_t b = 0; b < sealed; b++)
+        {
+            bt_scan_log_block_t block;
+            if (!read_block_span(b * BT_SCAN_LOG_BLOCK_RECORDS, BT_SCAN_LOG_BLOCK_RECORDS, &block) ||
+                pwrite(slog.index_fd, &block, sizeof(block), (off_t)(b * sizeof(block))) != (ssize_t)sizeof(block))
+                return false;
+        }
+    }
+
+    if (lseek(slog.index_fd, 0, SEEK_END) < 0)
+        return false;
+
+    uint64_t open_first = sealed * BT_SCAN_LOG_BLOCK_RECORDS;
+    return read_block_span(open_first, slog.records - open_first, &slog.block);
+}
+
+static void close_files(void)
+{
+    if (slog.log_fd >= 0) close(slog.log_fd);
+    if (slog.index_fd >= 0) close(slog.index_fd);
+    slog.log_fd = -1;
+    slog.index_fd = -1;
+}
+
+/*
+ * Moves the full log aside as scan.log.1 / scan.idx.1, replacing the previous
+ * ones, and starts over. At most two segments ever sit on disk.
+ */
+static void rotate_files(void)
+{
+    log_debug("[BT][scan_log] rotating after %llu records", (unsigned long long)slog.records);
+
+    close_files();
+
+    if (rename(slog.log_path, slog.old_log_path) != 0)
+    {
+        log_warning("[BT][scan_log] can't rotate %s: %s", slog.log_path, strerror(errno));
+        unlink(slog.log_path);          // staying under the cap matters more than the history
+    }
+
+    // A stale index would hide records of the old segment; the reader does fine without one.
+    if (rename(slog.index_path, slog.old_index_path) != 0)
+        unlink(slog.old_index_path);
+
+    if (!open_log_file() || !open_index_file())
+    {
+        log_warning("[BT][scan_log] can't reopen %s: %s", slog.log_path, strerror(errno));
+        close_files();
+    }
+}
+
+static void write_batch(const bt_scan_record_t *batch, size_t count)
+{
+    if (slog.log_fd < 0)
+        return;
+
+    if (write_all(slog.log_fd, batch, count * sizeof(*batch)) != 0)
+    {
+        log_warning("[BT][scan_log] write failed: %s", strerror(errno));
+        return;
+    }
+
+    for (size_t i = 0; i < count; i++)
+    {
+        block_extend(&slog.block, batch[i].ts_us);
+        slog.records++;
+
+        if (slog.records % BT_SCAN_LOG_BLOCK_RECORDS == 0)
+        {
+            if (write_all(slog.index_fd, &slog.block, sizeof(slog.block)) != 0)
+                log_warning("[BT][scan_log] index write failed: %s", strerror(errno));
+            block_reset(&slog.block);
+        }
+    }
+}
+
+static void export_begin(void);
+static bool export_step(void);
+static void export_finish(int rc);
+
+static void *writer_main(void *arg)
+{
+    (void)arg;
+    bt_scan_record_t batch[SCAN_LOG_BATCH];
+
+    for (;;)
+    {
+        // An export in progress keeps the thread busy, so only wait when there is none.
+        bool exporting = slog.export_state == EXPORT_RUNNING;
+        if (exporting)
+        {
+            while (sem_trywait(&slog.wake) == 0)
+                ;
+        }
+        else
+        {
+            while (sem_wait(&slog.wake) != 0 && errno == EINTR)
+                ;
+        }
+
+        for (;;)
+        {
+            unsigned int tail = slog.tail;
+            unsigned int head = __atomic_load_n(&slog.head, __ATOMIC_ACQUIRE);
+
+            size_t count = 0;
+            while (tail != head && count < SCAN_LOG_BATCH)
+                batch[count++] = slog.ring[tail++ & (SCAN_LOG_RING_SIZE - 1)];
+
+            __atomic_store_n(&slog.tail, tail, __ATOMIC_RELEASE);
+
+            if (count == 0)
+                break;
+
+            write_batch(batch, count);
+
+            // Rotation waits for the export, which may still be reading the old segment.
+            if (slog.max_records > 0 && slog.records >= slog.max_records && !exporting)
+                rotate_files();
+        }
+
+        if (!__atomic_load_n(&slog.running, __ATOMIC_ACQUIRE))
+        {
+            if (slog.export_state == EXPORT_RUNNING)
+                export_finish(-5);
+            else if (slog.export_state == EXPORT_PENDING)
+            {
+                slog.export_job.rc = -5;
+                __atomic_store_n(&slog.export_state, EXPORT_DONE, __ATOMIC_RELEASE);
+            }
+            break;
+        }
+
+        if (__atomic_load_n(&slog.export_state, __ATOMIC_ACQUIRE) == EXPORT_PENDING)
+            export_begin();
+
+        if (slog.export_state == EXPORT_RUNNING && !export_step())
+            export_finish(ferror(slog.export_job.ctx.out) ? -4 : 0);
+    }
+
+    return NULL;
+}
+
+void bt_scan_log_init(const char *log_dir, size_t max_bytes)
+{
+    if (slog.running || !log_dir || !log_dir[0])
+        return;
+
+    char dir[PATH_MAX];
+    snprintf(dir, sizeof(dir), "%s", log_dir);
+    normalize_dir_path(dir);
+
+    if (file_ensure_dir_recursive(dir) != 0)
+    {
+        log_warning("[BT][scan_log] can't create log dir %s", dir);
+        return;
+    }
+
+    snprintf(slog.log_path, sizeof(slog.log_path), "%s/%s", dir, SCAN_LOG_FILE);
+    snprintf(slog.index_path, sizeof(slog.index_path), "%s/%s", dir, SCAN_INDEX_FILE);
+    snprintf(slog.old_log_path, sizeof(slog.old_log_path), "%s/%s", dir, SCAN_LOG_OLD);
+    snprintf(slog.old_index_path, sizeof(slog.old_index_path), "%s/%s", dir, SCAN_INDEX_OLD);
+
+    // Half the budget per segment, in whole blocks so a rotated file is fully indexed.
+    uint64_t segment_records = max_bytes / 2 / sizeof(bt_scan_record_t);
+    segment_records -= segment_records % BT_SCAN_LOG_BLOCK_RECORDS;
+    slog.max_records = max_bytes == 0 ? 0
+                     : segment_records > 0 ? segment_records : BT_SCAN_LOG_BLOCK_RECORDS;
+
+    if (!open_log_file() || !open_index_file())
+    {
+        log_warning("[BT][scan_log] can't open %s: %s", slog.log_path, strerror(errno));
+        close_files();
+        return;
+    }
+
+    slog.head = slog.tail = slog.dropped = 0;
+    slog.export_state = EXPORT_IDLE;
+    if (sem_init(&slog.wake, 0, 0) != 0)
+    {
+        close_files();
+        return;
+    }
+
+    slog.running = true;
+    if (pthread_create(&slog.thread, NULL, writer_main, NULL) != 0)
+    {
+        log_warning("[BT][scan_log] can't start writer thread");
+        slog.running = false;
+        sem_destroy(&slog.wake);
+        close_files();
+        return;
+    }
+
+    log_debug("[BT][scan_log] %s open with %llu records", slog.log_path, (unsigned long long)slog.records);
+}
+
+void bt_scan_log_close(void)
+{
+    if (!slog.running)
+        return;
+
+    __atomic_store_n(&slog.running, false, __ATOMIC_RELEASE);
+    sem_post(&slog.wake);
+    pthread_join(slog.thread, NULL);
+
+    sem_destroy(&slog.wake);
+    close_files();
+}
+
+static void parse_mac(const char *text, uint8_t out[6])
+{
+    unsigned int b[6] = {0};
+    if (sscanf(text, "%x:%x:%x:%x:%x:%x", &b[0], &b[1], &b[2], &b[3], &b[4], &b[5]) != 6)
+        memset(b, 0, sizeof(b));
+
+    for (int i = 0; i < 6; i++)
+        out[i] = (uint8_t)b[i];
+}
+
+void bt_scan_log_append(const device_t *device)
+{
+    if (!device || !slog.running)
+        return;
+
+    unsigned int head = slog.head;
+    unsigned int tail = __atomic_load_n(&slog.tail, __ATOMIC_ACQUIRE);
+    if (head - tail == SCAN_LOG_RING_SIZE)
+    {
+        slog.dropped++;
+        return;
+    }
+
+    bt_scan_record_t *rec = &slog.ring[head & (SCAN_LOG_RING_SIZE - 1)];
+    memset(rec, 0, sizeof(*rec));
+
+    rec->ts_us = now_us();
+    parse_mac(device->mac, rec->mac);
+    rec->addr_type = (uint8_t)device->addr_type;
+    rec->rssi = (int8_t)device->rssi;
+    rec->flags = device->connectable ? BT_SCAN_LOG_F_CONNECTABLE : 0;
+    rec->adv_len = device->adv_len;
+    rec->rsp_len = device->scan_rsp_len;
+    memcpy(rec->blob, device->adv_data, device->adv_len);
+    memcpy(rec->blob + device->adv_len, device->scan_rsp, device->scan_rsp_len);
+
+    __atomic_store_n(&slog.head, head + 1, __ATOMIC_RELEASE);
+    sem_post(&slog.wake);
+}
+
+unsigned int bt_scan_log_dropped(void)
+{
+    return slog.dropped;
+}
+
+// ---- reader ---- //
+
+static void *map_file(const char *path, size_t *out_size)
+{
+    *out_size = 0;
+
+    int fd = open(path, O_RDONLY);
+    if (fd < 0)
+        return NULL;
+
+    struct stat st;
+    void *map = NULL;
+    if (fstat(fd, &st) == 0 && st.st_size > 0)
+    {
+        map = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+        if (map == MAP_FAILED)
+            map = NULL;
+        else
+            *out_size = (size_t)st.st_size;
+    }
+
+    // The mapping keeps the file referenced.
+    close(fd);
+    return map;
+}
+
+static int reader_open_files(bt_scan_log_reader *reader, const char *log_path, const char *index_path)
+{
+    memset(reader, 0, sizeof(*reader));
+
+    reader->map = map_file(log_path, &reader->map_size);
+    if (!reader->map || reader->map_size < sizeof(scan_log_header_t))
+    {
+        bt_scan_log_reader_close(reader);
+        return -1;
+    }
+
+    const scan_log_header_t *header = (const scan_log_header_t *)reader->map;
+    if (memcmp(header->magic, SCAN_LOG_MAGIC, sizeof(header->magic)) != 0 ||
+        header->record_size != sizeof(bt_scan_record_t))
+    {
+        bt_scan_log_reader_close(reader);
+        return -2;
+    }
+
+    reader->records = (const bt_scan_record_t *)((const uint8_t *)reader->map + sizeof(*header));
+    reader->count = (reader->map_size - sizeof(*header)) / sizeof(bt_scan_record_t);
+
+    // Without an index every block is just scanned; it is an optimisation only.
+    reader->index_map = map_file(index_path, &reader->index_size);
+    if (reader->index_map)
+    {
+        reader->blocks = (const bt_scan_log_block_t *)reader->index_map;
+        reader->block_count = reader->index_size / sizeof(bt_scan_log_block_t);
+
+        size_t sealed = reader->count / BT_SCAN_LOG_BLOCK_RECORDS;
+        if (reader->block_count > sealed)
+            reader->block_count = sealed;
+    }
+
+    return 0;
+}
+
+int bt_scan_log_reader_open(bt_scan_log_reader *reader)
+{
+    if (!reader || !slog.log_path[0])
+        return -1;
+
+    return reader_open_files(reader, slog.log_path, slog.index_path);
+}
+
+void bt_scan_log_reader_close(bt_scan_log_reader *reader)
+{
+    if (!reader)
+        return;
+
+    if (reader->map)
+        munmap(reader->map, reader->map_size);
+    if (reader->index_map)
+        munmap(reader->index_map, reader->index_size);
+
+    memset(reader, 0, sizeof(*reader));
+}
+
+/*
+ * Visits the matches among records [*next, end). Blocks whose [min, max] span
+ * misses the range are skipped without touching their pages; records after
+ * the last indexed block are scanned one by one. `*next` is left where the
+ * walk stopped.
+ */
+static size_t query_span(const bt_scan_log_reader *reader, size_t *next, size_t end, uint64_t from_us, uint64_t to_us,
+                         bt_scan_log_visit_fn visit, void *user_data)
+{
+    size_t matched = 0;
+    size_t i = *next;
+
+    while (i < end)
+    {
+        size_t b = i / BT_SCAN_LOG_BLOCK_RECORDS;
+        if (i % BT_SCAN_LOG_BLOCK_RECORDS == 0 && b < reader->block_count &&
+            (reader->blocks[b].max_ts_us < from_us || reader->blocks[b].min_ts_us > to_us))
+        {
+            i += BT_SCAN_LOG_BLOCK_RECORDS;
+            continue;
+        }
+
+        const bt_scan_record_t *rec = &reader->records[i++];
+        if (rec->ts_us < from_us || rec->ts_us > to_us)
+            continue;
+
+        matched++;
+        if (!visit(rec, user_data))
+            break;
+    }
+
+    *next = i;
+    return matched;
+}
+
+size_t bt_scan_log_query(const bt_scan_log_reader *reader, uint64_t from_us, uint64_t to_us,
+                         bt_scan_log_visit_fn visit, void *user_data)
+{
+    if (!reader || !reader->records || !visit)
+        return 0;
+
+    size_t next = 0;
+    return query_span(reader, &next, reader->count, from_us, to_us, visit, user_data);
+}
+
+// ---- pcap export ---- //
+
+#define PCAP_LINKTYPE_BLE_LL_WITH_PHDR 256
+#define BLE_ADV_ACCESS_ADDRESS         0x8E89BED6u
+#define BLE_ADV_CRC_INIT               0x555555u
+
+// PDU types of the advertising physical channel.
+#define BLE_PDU_ADV_IND         0x0
+#define BLE_PDU_ADV_NONCONN_IND 0x2
+#define BLE_PDU_SCAN_RSP        0x4
+
+// LE_LL_WITH_PHDR flags: dewhitened, signal power valid, ref AA valid, CRC checked + valid.
+#define BLE_PHDR_FLAGS 0x0C13
+
+static void put_le16(uint8_t *p, uint16_t v) { p[0] = (uint8_t)v; p[1] = (uint8_t)(v >> 8); }
+
+static void put_le32(uint8_t *p, uint32_t v)
+{
+    put_le16(p, (uint16_t)v);
+    put_le16(p + 2, (uint16_t)(v >> 16));
+}
+
+static uint8_t reverse_bits(uint8_t b)
+{
+    b = (uint8_t)((b & 0xF0) >> 4 | (b & 0x0F) << 4);
+    b = (uint8_t)((b & 0xCC) >> 2 | (b & 0x33) << 2);
+    b = (uint8_t)((b & 0xAA) >> 1 | (b & 0x55) << 1);
+    return b;
+}
+
+// Link Layer CRC (Core Vol 6, Part B, 3.1.1): data goes in LSB first, CRC goes out MSB first.
+static void ble_crc24(const uint8_t *pdu, size_t len, uint8_t out[3])
+{
+    uint32_t state = BLE_ADV_CRC_INIT;
+    for (size_t i = 0; i < len; i++)
+    {
+        for (int bit = 0; bit < 8; bit++)
+        {
+            uint32_t in = ((state >> 23) ^ (pdu[i] >> bit)) & 1u;
+            state = (state << 1) & 0xFFFFFFu;
+            if (in)
+                state ^= 0x00065Bu;
+        }
+    }
+
+    out[0] = reverse_bits((uint8_t)(state >> 16));
+    out[1] = reverse_bits((uint8_t)(state >> 8));
+    out[2] = reverse_bits((uint8_t)state);
+}
+
+static void write_pcap_packet(pcap_ctx *ctx, const bt_scan_record_t *rec, uint8_t pdu_type,
+                              const uint8_t *data, size_t data_len)
+{
+    uint8_t pkt[10 + 4 + 2 + 6 + BT_ADV_MAX_LEN + 3];
+    size_t n = 0;
+
+    // Pseudo-header. Reports come from the ESP32 host stack, so the channel is unknown.
+    pkt[n++] = 0;                       // RF channel 0 = advertising channel 37
+    pkt[n++] = (uint8_t)rec->rssi;      // signal power, dBm
+    pkt[n++] = 0x80;                    // noise power (invalid)
+    pkt[n++] = 0;                       // access address offenses
+    put_le32(&pkt[n], BLE_ADV_ACCESS_ADDRESS); n += 4;
+    put_le16(&pkt[n], BLE_PHDR_FLAGS); n += 2;
+
+    put_le32(&pkt[n], BLE_ADV_ACCESS_ADDRESS); n += 4;
+
+    size_t pdu_start = n;
+    pkt[n++] = (uint8_t)(pdu_type | (rec->addr_type ? 0x40 : 0x00));    // TxAdd
+    pkt[n++] = (uint8_t)(6 + data_len);
+
+    for (int i = 0; i < 6; i++)
+        pkt[n++] = rec->mac[5 - i];     // AdvA goes over the air little-endian
+    memcpy(&pkt[n], data, data_len);
+    n += data_len;
+
+    ble_crc24(&pkt[pdu_start], n - pdu_start, &pkt[n]);
+    n += 3;
+
+    uint8_t hdr[16];
+    put_le32(&hdr[0], (uint32_t)(rec->ts_us / 1000000ull));
+    put_le32(&hdr[4], (uint32_t)(rec->ts_us % 1000000ull));
+    put_le32(&hdr[8], (uint32_t)n);
+    put_le32(&hdr[12], (uint32_t)n);
+
+    fwrite(hdr, 1, sizeof(hdr), ctx->out);
+    fwrite(pkt, 1, n, ctx->out);
+    ctx->packets++;
+}
+
+static bool export_record(const bt_scan_record_t *rec, void *user_data)
+{
+    pcap_ctx *ctx = (pcap_ctx *)user_data;
+
+    size_t adv_len = rec->adv_len <= BT_ADV_MAX_LEN ? rec->adv_len : BT_ADV_MAX_LEN;
+    size_t rsp_len = rec->rsp_len <= BT_ADV_MAX_LEN ? rec->rsp_len : BT_ADV_MAX_LEN;
+
+    if (adv_len > 0 || rsp_len == 0)
+    {
+        uint8_t type = (rec->flags & BT_SCAN_LOG_F_CONNECTABLE) ? BLE_PDU_ADV_IND : BLE_PDU_ADV_NONCONN_IND;
+        write_pcap_packet(ctx, rec, type, rec->blob, adv_len);
+    }
+
+    if (rsp_len > 0)
+        write_pcap_packet(ctx, rec, BLE_PDU_SCAN_RSP, rec->blob + rec->adv_len, rsp_len);
+
+    return !ferror(ctx->out);
+}
+
+static const char *segment_log_path(int segment)
+{
+    return segment == 0 ? slog.old_log_path : slog.log_path;
+}
+
+static const char *segment_index_path(int segment)
+{
+    return segment == 0 ? slog.old_index_path : slog.index_path;
+}
+
+static void export_begin(void)
+{
+    export_job_t *job = &slog.export_job;
+
+    job->segment = 0;
+    job->next = 0;
+    memset(&job->reader, 0, sizeof(job->reader));
+    job->ctx.packets = 0;
+    job->ctx.out = fopen(job->path, "wb");
+
+    __atomic_store_n(&slog.export_state, EXPORT_RUNNING, __ATOMIC_RELEASE);
+
+    if (!job->ctx.out)
+    {
+        export_finish(-3);
+        return;
+    }
+
+    uint8_t global[24];
+    put_le32(&global[0], 0xA1B2C3D4u);  // microsecond timestamps
+    put_le16(&global[4], 2);
+    put_le16(&global[6], 4);
+    put_le32(&global[8], 0);            // thiszone
+    put_le32(&global[12], 0);           // sigfigs
+    put_le32(&global[16], 256);         // snaplen
+    put_le32(&global[20], PCAP_LINKTYPE_BLE_LL_WITH_PHDR);
+    fwrite(global, 1, sizeof(global), job->ctx.out);
+}
+
+/*
+ * Exports up to SCAN_LOG_EXPORT_CHUNK more records, so the writer gets back
+ * to the ring between chunks. Returns false once there is nothing left or
+ * the output failed.
+ */
+static bool export_step(void)
+{
+    export_job_t *job = &slog.export_job;
+    size_t budget = SCAN_LOG_EXPORT_CHUNK;
+
+    while (budget > 0 && job->segment < SCAN_LOG_SEGMENTS && !ferror(job->ctx.out))
+    {
+        if (!job->reader.map)
+        {
+            // A log that never rotated has no old segment.
+            if (reader_open_files(&job->reader, segment_log_path(job->segment), segment_index_path(job->segment)) != 0)
+            {
+                job->segment++;
+                continue;
+            }
+            job->next = 0;
+        }
+
+        size_t first = job->next;
+        size_t end = job->reader.count - first > budget ? first + budget : job->reader.count;
+        query_span(&job->reader, &job->next, end, job->from_us, job->to_us, export_record, &job->ctx);
+        budget -= job->next - first;
+
+        if (job->next >= job->reader.count)
+        {
+            bt_scan_log_reader_close(&job->reader);
+            job->segment++;
+        }
+    }
+
+    return job->segment < SCAN_LOG_SEGMENTS && !ferror(job->ctx.out);
+}
+
+static void export_finish(int rc)
+{
+    export_job_t *job = &slog.export_job;
+
+    bt_scan_log_reader_close(&job->reader);
+
+    if (job->ctx.out && fclose(job->ctx.out) != 0 && rc == 0)
+        rc = -4;
+    job->ctx.out = NULL;
+
+    if (rc == 0)
+    {
+        log_debug("[BT][scan_log] exported %zu packets to %s", job->ctx.packets, job->path);
+    }
+    else
+    {
+        log_warning("[BT][scan_log] failed to write %s (%d)", job->path, rc);
+        unlink(job->path);
+    }
+
+    job->rc = rc;
+    __atomic_store_n(&slog.export_state, EXPORT_DONE, __ATOMIC_RELEASE);
+}
+
+int bt_scan_log_export_start(const char *pcap_path, uint64_t from_us, uint64_t to_us)
+{
+    if (!pcap_path || !pcap_path[0] || !slog.running)
+        return -1;
+
+    export_state_t state = __atomic_load_n(&slog.export_state, __ATOMIC_ACQUIRE);
+    if (state == EXPORT_PENDING || state == EXPORT_RUNNING)
+        return -2;
+
+    export_job_t *job = &slog.export_job;
+    snprintf(job->path, sizeof(job->path), "%s", pcap_path);
+    job->from_us = from_us;
+    job->to_us = to_us;
+    job->rc = 0;
+
+    __atomic_store_n(&slog.export_state, EXPORT_PENDING, __ATOMIC_RELEASE);
+    sem_post(&slog.wake);
+    return 0;
+}
+
+bool bt_scan_log_export_poll(int *rc)
+{
+    if (__atomic_load_n(&slog.export_state, __ATOMIC_ACQUIRE) != EXPORT_DONE)
+        return false;
+
+    if (rc)
+        *rc = slog.export_job.rc;
+    __atomic_store_n(&slog.export_state, EXPORT_IDLE, __ATOMIC_RELEASE);
+    return true;
+}
@@ -0,0 +1,93 @@
+#ifndef BT_SCAN_LOG_H
+#define BT_SCAN_LOG_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define BT_SCAN_LOG_BLOB_LEN      64    // advertising + scan response, back to back
+#define BT_SCAN_LOG_BLOCK_RECORDS 256   // records per indexed block
+
+#define BT_SCAN_LOG_F_CONNECTABLE 0x01
+
+/*
+ * One advertising report, fixed size so the log can be addressed by index.
+ * `mac` is stored in display order (AA:BB:... -> {0xAA, 0xBB, ...}).
+ */
+typedef struct {
+    uint64_t ts_us;             // CLOCK_REALTIME, microseconds
+    uint8_t mac[6];
+    uint8_t addr_type;
+    int8_t rssi;
+    uint8_t flags;
+    uint8_t adv_len;
+    uint8_t rsp_len;
+    uint8_t reserved[13];
+    uint8_t blob[BT_SCAN_LOG_BLOB_LEN];
+} bt_scan_record_t;
+
+// Time span of one sealed block; entry i covers records [i * BLOCK, (i + 1) * BLOCK).
+typedef struct {
+    uint64_t min_ts_us;
+    uint64_t max_ts_us;
+} bt_scan_log_block_t;
+
+/*
+ * Append-only log of every advertising report, `scan.log` plus a small
+ * `scan.idx` under `log_dir`. Appending only copies the report into a ring;
+ * a writer thread owns the files, so the UI thread never waits on disk.
+ * Once scan.log reaches half of `max_bytes` it becomes scan.log.1 (dropping
+ * the previous one) and a new log starts; 0 never rotates.
+ */
+void bt_scan_log_init(const char *log_dir, size_t max_bytes);
+void bt_scan_log_close(void);
+
+// Non-blocking. Reports are dropped (and counted) if the writer falls behind.
+void bt_scan_log_append(const device_t *device);
+unsigned int bt_scan_log_dropped(void);
+
+/*
+ * Read-only view over the live scan.log, mapped in memory. It covers what was
+ * on disk when it was opened; records appended later need a new reader.
+ */
+typedef struct {
+    void *map;
+    size_t map_size;
+    const bt_scan_record_t *records;
+    size_t count;
+
+    void *index_map;
+    size_t index_size;
+    const bt_scan_log_block_t *blocks;
+    size_t block_count;
+} bt_scan_log_reader;
+
+// Return false to stop the query.
+typedef bool (*bt_scan_log_visit_fn)(const bt_scan_record_t *record, void *user_data);
+
+int bt_scan_log_reader_open(bt_scan_log_reader *reader);
+void bt_scan_log_reader_close(bt_scan_log_reader *reader);
+size_t bt_scan_log_query(const bt_scan_log_reader *reader, uint64_t from_us, uint64_t to_us,
+                         bt_scan_log_visit_fn visit, void *user_data);
+
+/*
+ * Queues an export of [from_us, to_us], rotated segment included, as a
+ * LINKTYPE_BLUETOOTH_LE_LL_WITH_PHDR pcap. The writer thread does it in
+ * chunks between batches. Returns -2 while another export is running.
+ */
+int bt_scan_log_export_start(const char *pcap_path, uint64_t from_us, uint64_t to_us);
+
+// True once the export has finished; `rc` gets 0 or a negative error.
+bool bt_scan_log_export_poll(int *rc);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BT_SCAN_LOG_H */
@@ -5,7 +5,9 @@
 #include "components/ui_pills.h"
 #include "bt_device_detail.h"
 #include "bt_controller.h"
+#include "bt_ad_decoder.h"
 #include "components/nav.h"
+#include "config.h"
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -16,6 +18,8 @@ static ui_loading_button *scan_btn = NULL;
 static lv_obj_t *lb_devices_amount = NULL;
 static lv_obj_t *device_detail_page = NULL;
 static ui_pills *filter_pills = NULL;
+static lv_obj_t *search_input = NULL;
+static lv_obj_t *search_keyboard = NULL;
 
 static void on_filter_change(ui_pills *pills, int index, const char *label, void *user_data);
 
@@ -41,19 +45,42 @@ static void handler(ui_list *list, const list_item_t *item, void *user_data)
     zv_nav_update_group(ctx->menu, ctx->page);
 }
 
+// SIG company identifiers with a dedicated icon.
+#define COMPANY_ID_MICROSOFT 0x0006
+#define COMPANY_ID_APPLE     0x004C
+#define COMPANY_ID_SAMSUNG   0x0075
+
+static const char *device_icon_path(const device_t *device)
+{
+    uint16_t company_id;
+    if (bt_ad_get_manufacturer(device->adv_data, device->adv_len, &company_id, NULL, NULL) ||
+        bt_ad_get_manufacturer(device->scan_rsp, device->scan_rsp_len, &company_id, NULL, NULL))
+    {
+        switch (company_id)
+        {
+            case COMPANY_ID_MICROSOFT: return "icons/microsoft.png";
+            case COMPANY_ID_APPLE:     return "icons/apple.png";
+            case COMPANY_ID_SAMSUNG:   return "icons/samsung.png";
+            default:                   return "icons/unknown.png";
+        }
+    }
+
+    // Legacy SCAN:DEVICE lines only carry the manufacturer name.
+    if (strcmp(device->manufacturer, "Microsoft") == 0)
+        return "icons/microsoft.png";
+    if (strcmp(device->manufacturer, "Apple") == 0)
+        return "icons/apple.png";
+    if (strcmp(device->manufacturer, "Samsung") == 0)
+        return "icons/samsung.png";
+
+    return "icons/unknown.png";
+}
+
 static list_item_t create_list_item(device_t *device, char *rssi_buffer, size_t rssi_buffer_size)
 {
     snprintf(rssi_buffer, rssi_buffer_size, "%d", device->rssi);
 
-    const char *icon_path;
-    if (strcmp(device->manufacturer, "Microsoft") == 0)
-        icon_path = "icons/microsoft.png";
-    else if (strcmp(device->manufacturer, "Apple") == 0)
-        icon_path = "icons/apple.png";
-    else if (strcmp(device->manufacturer, "Samsung") == 0)
-        icon_path = "icons/samsung.png";
-    else
-        icon_path = "icons/unknown.png";
+    const char *icon_path = device_icon_path(device);
 
     list_item_t item = {
         .text = device->name,
@@ -83,12 +110,14 @@ static void handler_devices(device_t *device, ui_status_t status)
     if (scanner_list == NULL)
         return;
 
-    if (status == UI_LOADING) {
+    // A continuous scan is stopped with the same button, so it never spins.
+    if (status == UI_LOADING && !bt_is_continuous_scanning()) {
         loading_button_set_loading(scan_btn, true);
     }
 
     if (status == UI_DONE) {
         loading_button_set_loading(scan_btn, false);
+        loading_button_set_text(scan_btn, "Scan");
         // Reapply current filter so Near re-sorts and any drift gets corrected.
         on_filter_change(NULL, pills_get_active(filter_pills), NULL, NULL);
         return;
@@ -99,7 +128,7 @@ static void handler_devices(device_t *device, ui_status_t status)
 
     // Respect Connectable filter during live scan; Near sorts on UI_DONE.
     int active = pills_get_active(filter_pills);
-    if (active == 2 && !device->connectable)
+    if ((active == 2 && !device->connectable) || active == 3)
         return;
 
     char rssi_buffer[16];
@@ -115,13 +144,27 @@ static void handler_devices(device_t *device, ui_status_t status)
 static void handler_scan_btn(lv_event_t *e)
 {
     (void)e;
-    loading_button_set_loading(scan_btn, true);
+
+    if (bt_is_continuous_scanning()) {
+        bt_stop_scan();
+        loading_button_set_text(scan_btn, "Scan");
+        return;
+    }
+
     clean_list(scanner_list);
     bt_controller_reset_devices();
 
     if (lb_devices_amount)
         lv_label_set_text(lb_devices_amount, "Devices: 0");
 
+    const zv_config *config = config_get();
+    if (config && config->bt.continuous_scan) {
+        if (bt_start_continuous_scan() == UART_OK)
+            loading_button_set_text(scan_btn, "Stop");
+        return;
+    }
+
+    loading_button_set_loading(scan_btn, true);
     start_scan();
 }
 
@@ -148,12 +191,51 @@ static void create_scanner_panel(lv_obj_t *parent)
     loading_set_event_cb(scan_btn, handler_scan_btn, NULL);
 }
 
+/*
+ * Open connections, whether or not they are still advertising. Most
+ * peripherals stop once connected, so a new scan would lose them otherwise.
+ */
+static void list_connected_devices(void)
+{
+    int ids[BT_MAX_CONNECTIONS];
+    int count = bt_get_connections(ids, BT_MAX_CONNECTIONS);
+
+    for (int i = 0; i < count; i++)
+    {
+        const bt_connection_t *conn = bt_get_connection(ids[i]);
+        if (!conn)
+            continue;
+
+        device_t device;
+        memset(&device, 0, sizeof(device));
+        snprintf(device.name, sizeof(device.name), "%s", conn->name[0] ? conn->name : UNKNOWN_NAME);
+        snprintf(device.mac, sizeof(device.mac), "%s", conn->mac);
+        snprintf(device.manufacturer, sizeof(device.manufacturer), "%s", UNKNOWN_NAME);
+        device.addr_type = conn->addr_type;
+        device.connectable = 1;
+
+        char rssi_buffer[16];
+        list_item_t item = create_list_item(&device, rssi_buffer, sizeof(rssi_buffer));
+        item.right_badge.label = LV_SYMBOL_BLUETOOTH;
+        item.right_badge.text_color = ZV_COLOR_SUCCESS;
+        add_item(scanner_list, &item);
+    }
+}
+
 static void on_filter_change(ui_pills *pills, int index, const char *label, void *user_data)
 {
     (void)pills;
     (void)label;
     (void)user_data;
 
+    if (index == 3)
+    {
+        clean_list(scanner_list);
+        list_connected_devices();
+        lv_label_set_text_fmt(lb_devices_amount, "Connected: %d", item_length(scanner_list));
+        return;
+    }
+
     switch(index)
     {
         case 0:
@@ -194,10 +276,103 @@ static void create_filter_panel(lv_obj_t *parent)
     pills_add(filter_pills, "All");
     pills_add(filter_pills, "Near");
     pills_add(filter_pills, "Connectable");
+    pills_add(filter_pills, "Connected");
     pills_set_active(filter_pills, 0);
     pills_set_event_cb(filter_pills, on_filter_change, NULL);
 }
 
+static void search_keyboard_hide(void)
+{
+    if (!search_keyboard)
+        return;
+
+    lv_group_t *group = lv_obj_get_group(search_keyboard);
+    if (group)
+    {
+        lv_group_set_editing(group, false);
+        lv_group_remove_obj(search_keyboard);
+        lv_group_focus_obj(search_input);
+    }
+
+    lv_obj_add_flag(search_keyboard, LV_OBJ_FLAG_HIDDEN);
+    lv_keyboard_set_textarea(search_keyboard, NULL);
+}
+
+static void search_keyboard_show(void)
+{
+    if (!search_keyboard)
+        return;
+
+    lv_keyboard_set_textarea(search_keyboard, search_input);
+    lv_obj_clear_flag(search_keyboard, LV_OBJ_FLAG_HIDDEN);
+    lv_obj_move_foreground(search_keyboard);
+
+    lv_group_t *group = lv_obj_get_group(search_input);
+    if (group)
+    {
+        if (!lv_obj_get_group(search_keyboard))
+            lv_group_add_obj(group, search_keyboard);
+        lv_group_focus_obj(search_keyboard);
+        lv_group_set_editing(group, true);
+    }
+}
+
+static void search_keyboard_event_cb(lv_event_t *e)
+{
+    lv_event_code_t code = lv_event_get_code(e);
+    if (code == LV_EVENT_READY || code == LV_EVENT_CANCEL)
+        search_keyboard_hide();
+}
+
+static void search_input_event_cb(lv_event_t *e)
+{
+    lv_event_code_t code = lv_event_get_code(e);
+
+    if (code == LV_EVENT_VALUE_CHANGED) {
+        // Each keystroke narrows the previous hits through the index.
+        bt_set_device_search(lv_textarea_get_text(search_input));
+        on_filter_change(NULL, pills_get_active(filter_pills), NULL, NULL);
+        return;
+    }
+
+    if (code == LV_EVENT_KEY && lv_event_get_key(e) != LV_KEY_ENTER)
+        return;
+
+    search_keyboard_show();
+}
+
+static void create_search_panel(lv_obj_t *parent)
+{
+    search_input = lv_textarea_create(parent);
+    lv_obj_set_width(search_input, LV_PCT(100));
+    lv_obj_set_height(search_input, 34);
+    lv_textarea_set_one_line(search_input, true);
+    lv_textarea_set_placeholder_text(search_input, LV_SYMBOL_LIST " Name, maker or MAC");
+    lv_obj_set_style_bg_color(search_input, ZV_COLOR_BG_PANEL, 0);
+    lv_obj_set_style_bg_opa(search_input, LV_OPA_COVER, 0);
+    lv_obj_set_style_border_width(search_input, 2, 0);
+    lv_obj_set_style_border_color(search_input, ZV_COLOR_BORDER, 0);
+    lv_obj_set_style_radius(search_input, 10, 0);
+    lv_obj_set_style_text_color(search_input, ZV_COLOR_TEXT_MAIN, 0);
+    lv_obj_set_style_text_color(search_input, ZV_COLOR_TEXT_MUTED, LV_PART_TEXTAREA_PLACEHOLDER);
+    lv_obj_set_style_pad_left(search_input, 10, 0);
+    lv_obj_add_event_cb(search_input, search_input_event_cb, LV_EVENT_VALUE_CHANGED, NULL);
+    lv_obj_add_event_cb(search_input, search_input_event_cb, LV_EVENT_CLICKED, NULL);
+    lv_obj_add_event_cb(search_input, search_input_event_cb, LV_EVENT_KEY, NULL);
+
+    const zv_config *cfg = config_get();
+    if (cfg && cfg->ir.use_on_screen_keyboard)
+    {
+        // Top layer so the menu page does not clip it.
+        search_keyboard = lv_keyboard_create(lv_layer_top());
+        lv_obj_set_size(search_keyboard, lv_pct(100), 120);
+        lv_obj_align(search_keyboard, LV_ALIGN_BOTTOM_MID, 0, 0);
+        lv_obj_add_flag(search_keyboard, LV_OBJ_FLAG_HIDDEN);
+        lv_obj_add_event_cb(search_keyboard, search_keyboard_event_cb, LV_EVENT_READY, NULL);
+        lv_obj_add_event_cb(search_keyboard, search_keyboard_event_cb, LV_EVENT_CANCEL, NULL);
+    }
+}
+
 lv_obj_t *bt_scanner_page_create(lv_obj_t *menu)
 {
     lv_obj_t *page = lv_menu_page_create(menu, "BLE Scanner");
@@ -216,6 +391,7 @@ lv_obj_t *bt_scanner_page_create(lv_obj_t *menu)
     lv_obj_set_flex_flow(root, LV_FLEX_FLOW_COLUMN);
 
     create_scanner_panel(root);
+    create_search_panel(root);
     create_filter_panel(root);
 
     device_detail_page = bt_device_detail_page_create(menu);
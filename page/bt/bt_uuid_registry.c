@@ -1,51 +1,172 @@
 #include "bt_uuid_registry.h"
+#include "bt_assigned_numbers.h"
+
 #include <string.h>
-#include <ctype.h>
-#include <stdint.h>
-
-#define BT_BASE_UUID_TAIL "-0000-1000-8000-00805f9b34fb"
-
-static const uuid_name_t known_services[] = {
-    {"0x1800", "GAP"},
-    {"0x1801", "GATT"},
-    {"0x180A", "Device Info"},
-    {"0x180D", "Heart Rate"},
-    {"0x180F", "Battery"},
-    {"0x1812", "HID"},
-    {"0x1816", "Cycling Speed"},
-    {"0x181A", "Environmental"},
-    {"0x181C", "User Data"},
-    {"0xFE9F", "Apple Continuity"},
-};
 
-static const uuid_name_t known_chars[] = {
-    {"0x2A00", "Device Name"},
-    {"0x2A01", "Appearance"},
-    {"0x2A19", "Battery Lvl"},
-    {"0x2A24", "Model Number"},
-    {"0x2A25", "Serial Number"},
-    {"0x2A26", "Firmware Rev"},
-    {"0x2A27", "Hardware Rev"},
-    {"0x2A29", "Manufacturer"},
-    {"0x2A37", "HR Meas."},
-    {"0x2A38", "Body Loc."},
-    {"0x2A4D", "HID Report"},
+// 0000xxxx-0000-1000-8000-00805F9B34FB
+static const uint8_t bt_base_uuid[16] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
+    0x80, 0x00, 0x00, 0x80, 0x5F, 0x9B, 0x34, 0xFB,
 };
 
-static int is_bt_base_uuid(const char *uuid)
+static int hex_value(char c)
+{
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+bool bt_uuid_parse(const char *text, bt_uuid_t *out)
+{
+    if (!text || !out)
+        return false;
+
+    if (text[0] == '0' && (text[1] == 'x' || text[1] == 'X'))
+        text += 2;
+
+    uint8_t digits[32];
+    size_t count = 0;
+    for (size_t i = 0; text[i]; i++)
+    {
+        if (text[i] == '-')
+            continue;
+
+        int v = hex_value(text[i]);
+        if (v < 0 || count == sizeof(digits))
+            return false;
+
+        digits[count++] = (uint8_t)v;
+    }
+
+    if (count == 4 || count == 8)
+    {
+        // Short forms live in the first 32 bits of the SIG base UUID.
+        memcpy(out->bytes, bt_base_uuid, sizeof(bt_base_uuid));
+        size_t offset = 8 - count;
+        uint8_t padded[8] = {0};
+        memcpy(padded + offset, digits, count);
+        for (int i = 0; i < 4; i++)
+            out->bytes[i] = (uint8_t)((padded[i * 2] << 4) | padded[i * 2 + 1]);
+        return true;
+    }
+
+    if (count != 32)
+        return false;
+
+    for (int i = 0; i < 16; i++)
+        out->bytes[i] = (uint8_t)((digits[i * 2] << 4) | digits[i * 2 + 1]);
+
+    return true;
+}
+
+bool bt_uuid_to_16(const bt_uuid_t *uuid, uint16_t *out)
+{
+    if (!uuid)
+        return false;
+
+    if (uuid->bytes[0] != 0 || uuid->bytes[1] != 0 ||
+        memcmp(uuid->bytes + 4, bt_base_uuid + 4, 12) != 0)
+        return false;
+
+    if (out)
+        *out = (uint16_t)((uuid->bytes[2] << 8) | uuid->bytes[3]);
+
+    return true;
+}
+
+bool bt_uuid_equal(const bt_uuid_t *a, const bt_uuid_t *b)
+{
+    return memcmp(a->bytes, b->bytes, sizeof(a->bytes)) == 0;
+}
+
+void bt_uuid_format(const bt_uuid_t *uuid, char *out, size_t out_size)
+{
+    if (!out || out_size == 0)
+        return;
+
+    uint16_t short_uuid;
+    if (bt_uuid_to_16(uuid, &short_uuid)) {
+        snprintf(out, out_size, "0x%04X", short_uuid);
+        return;
+    }
+
+    const uint8_t *b = uuid->bytes;
+    snprintf(out, out_size,
+             "%02X%02X%02X%02X-%02X%02X-%02X%02X-%02X%02X-%02X%02X%02X%02X%02X%02X",
+             b[0], b[1], b[2], b[3], b[4], b[5], b[6], b[7],
+             b[8], b[9], b[10], b[11], b[12], b[13], b[14], b[15]);
+}
+
+/*
+ * Lower-bound search without an early exit: the loop runs log2(n) times
+ * whatever the key, and the select compiles to a conditional move.
+ */
+static const char *search16(const bt_an_entry16_t *table, size_t count, uint16_t key)
+{
+    if (count == 0)
+        return NULL;
+
+    const bt_an_entry16_t *base = table;
+    while (count > 1)
+    {
+        size_t half = count / 2;
+        base = (base[half].id <= key) ? base + half : base;
+        count -= half;
+    }
+
+    return base->id == key ? bt_an_names + base->name : NULL;
+}
+
+static const char *search128(const bt_an_entry128_t *table, size_t count, const bt_uuid_t *key)
+{
+    if (count == 0)
+        return NULL;
+
+    const bt_an_entry128_t *base = table;
+    while (count > 1)
+    {
+        size_t half = count / 2;
+        base = (memcmp(base[half].uuid, key->bytes, 16) <= 0) ? base + half : base;
+        count -= half;
+    }
+
+    return memcmp(base->uuid, key->bytes, 16) == 0 ? bt_an_names + base->name : NULL;
+}
+
+const char *bt_uuid_name(const bt_uuid_t *uuid)
 {
-    return strlen(uuid) == 36 &&
-           strncasecmp(uuid, "0000", 4) == 0 &&
-           strncasecmp(uuid + 8, BT_BASE_UUID_TAIL, 28) == 0;
+    if (!uuid)
+        return NULL;
+
+    uint16_t id;
+    if (!bt_uuid_to_16(uuid, &id))
+        return search128(bt_an_vendor_uuids, bt_an_vendor_uuids_count, uuid);
+
+    // The SIG hands out 16-bit UUIDs in disjoint ranges, so one table is enough.
+    if ((id & 0xFF00) == 0x1800)
+        return search16(bt_an_services, bt_an_services_count, id);
+    if ((id & 0xFF00) == 0x2900)
+        return search16(bt_an_descriptors, bt_an_descriptors_count, id);
+    if (id >= 0xFC00)
+        return search16(bt_an_member_services, bt_an_member_services_count, id);
+
+    return search16(bt_an_characteristics, bt_an_characteristics_count, id);
 }
 
-static void extract_uuid16(const char *uuid, char *out, size_t size)
+const char *bt_company_name(uint16_t company_id)
 {
-    snprintf(out, size, "0x%c%c%c%c",
-             toupper((unsigned char)uuid[4]),
-             toupper((unsigned char)uuid[5]),
-             toupper((unsigned char)uuid[6]),
-             toupper((unsigned char)uuid[7]));
+    return search16(bt_an_companies, bt_an_companies_count, company_id);
+}
+
+const char *bt_appearance_name(uint16_t appearance)
+{
+    const char *name = search16(bt_an_appearances, bt_an_appearances_count, appearance);
+    if (name)
+        return name;
+
+    // Unknown sub-category: fall back to the category (upper 10 bits).
+    return search16(bt_an_appearances, bt_an_appearances_count, (uint16_t)(appearance & ~0x3Fu));
 }
 
 const char *lookup_name(const char *uuid, char *normalized_uuid, size_t normalized_size)
@@ -55,23 +176,12 @@ const char *lookup_name(const char *uuid, char *normalized_uuid, size_t normaliz
 
     normalized_uuid[0] = '\0';
 
-    if (is_bt_base_uuid(uuid)) {
-        extract_uuid16(uuid, normalized_uuid, normalized_size);
-    } else {
+    bt_uuid_t parsed;
+    if (!bt_uuid_parse(uuid, &parsed)) {
         snprintf(normalized_uuid, normalized_size, "%s", uuid);
+        return NULL;
     }
 
-    size_t size = sizeof(known_services) / sizeof(known_services[0]);
-    for (size_t i = 0; i < size; i++) {
-        if (strcmp(normalized_uuid, known_services[i].uuid) == 0)
-            return known_services[i].name;
-    }
-
-    size = sizeof(known_chars) / sizeof(known_chars[0]);
-    for (size_t i = 0; i < size; i++) {
-        if (strcmp(normalized_uuid, known_chars[i].uuid) == 0)
-            return known_chars[i].name;
-    }
-
-    return NULL;
+    bt_uuid_format(&parsed, normalized_uuid, normalized_size);
+    return bt_uuid_name(&parsed);
 }
@@ -1,14 +1,27 @@
 #ifndef BT_UUID_REGISTRY_H
 #define BT_UUID_REGISTRY_H
+#include <stdbool.h>
+#include <stdint.h>
 #include <stdio.h>
 
+#include "types.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
-typedef struct {
-    const char *uuid;
-    const char *name;
-} uuid_name_t;
+
+// Accepts "180F", "0x180F", "0000180F", and the 128-bit form with or without dashes.
+bool bt_uuid_parse(const char *text, bt_uuid_t *out);
+bool bt_uuid_to_16(const bt_uuid_t *uuid, uint16_t *out);
+bool bt_uuid_equal(const bt_uuid_t *a, const bt_uuid_t *b);
+
+// "0x180F" for SIG base UUIDs, canonical upper-case 128-bit form otherwise.
+void bt_uuid_format(const bt_uuid_t *uuid, char *out, size_t out_size);
+
+// Registry lookups over the generated assigned-numbers tables. NULL if unknown.
+const char *bt_uuid_name(const bt_uuid_t *uuid);
+const char *bt_company_name(uint16_t company_id);
+const char *bt_appearance_name(uint16_t appearance);
 
 const char *lookup_name(const char *uui, char *normalized_uuid, size_t normalized_size);
 
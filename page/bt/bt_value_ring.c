@@ -0,0 +1,83 @@
+#include "bt_value_ring.h"
+
+#include <string.h>
+
+typedef char ring_slots_must_be_power_of_two[(BT_VALUE_RING_SLOTS & (BT_VALUE_RING_SLOTS - 1)) == 0 ? 1 : -1];
+
+void bt_value_ring_init(bt_value_ring_t *ring)
+{
+    if (ring)
+        memset(ring, 0, sizeof(*ring));
+}
+
+bool bt_value_ring_push(bt_value_ring_t *ring, const uint8_t *data, size_t len, uint32_t ts_ms)
+{
+    if (!ring)
+        return false;
+
+    __atomic_fetch_add(&ring->received, 1, __ATOMIC_RELAXED);
+
+    uint32_t head = __atomic_load_n(&ring->head, __ATOMIC_RELAXED);
+    uint32_t tail = __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE);
+    if (head - tail >= BT_VALUE_RING_SLOTS)
+    {
+        __atomic_fetch_add(&ring->dropped, 1, __ATOMIC_RELAXED);
+        return false;
+    }
+
+    bt_value_t *slot = &ring->slots[head & (BT_VALUE_RING_SLOTS - 1)];
+    size_t n = len < BT_VALUE_MAX_LEN ? len : BT_VALUE_MAX_LEN;
+    if (n > 0 && data)
+        memcpy(slot->data, data, n);
+    slot->len = (uint16_t)(len > UINT16_MAX ? UINT16_MAX : len);
+    slot->ts_ms = ts_ms;
+
+    // Publish the slot only once it is fully written.
+    __atomic_store_n(&ring->head, head + 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+bool bt_value_ring_pop(bt_value_ring_t *ring, bt_value_t *out)
+{
+    if (!ring)
+        return false;
+
+    uint32_t tail = __atomic_load_n(&ring->tail, __ATOMIC_RELAXED);
+    uint32_t head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+    if (tail == head)
+        return false;
+
+    if (out)
+        *out = ring->slots[tail & (BT_VALUE_RING_SLOTS - 1)];
+
+    __atomic_store_n(&ring->tail, tail + 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+size_t bt_value_ring_drain_latest(bt_value_ring_t *ring, bt_value_t *out)
+{
+    if (!ring)
+        return 0;
+
+    uint32_t tail = __atomic_load_n(&ring->tail, __ATOMIC_RELAXED);
+    uint32_t head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+    if (tail == head)
+        return 0;
+
+    // Only the newest slot is copied; the ones before it are just skipped.
+    if (out)
+        *out = ring->slots[(head - 1) & (BT_VALUE_RING_SLOTS - 1)];
+
+    __atomic_store_n(&ring->tail, head, __ATOMIC_RELEASE);
+    return head - tail;
+}
+
+uint32_t bt_value_ring_received(const bt_value_ring_t *ring)
+{
+    return ring ? __atomic_load_n(&ring->received, __ATOMIC_RELAXED) : 0;
+}
+
+uint32_t bt_value_ring_dropped(const bt_value_ring_t *ring)
+{
+    return ring ? __atomic_load_n(&ring->dropped, __ATOMIC_RELAXED) : 0;
+}
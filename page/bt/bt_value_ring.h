@@ -0,0 +1,49 @@
+#ifndef BT_VALUE_RING_H
+#define BT_VALUE_RING_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define BT_VALUE_RING_SLOTS 16   // power of two
+#define BT_VALUE_MAX_LEN    64   // longer values are truncated, `len` keeps the real size
+
+typedef struct {
+    uint32_t ts_ms;             // CLOCK_MONOTONIC, milliseconds
+    uint16_t len;
+    uint8_t data[BT_VALUE_MAX_LEN];
+} bt_value_t;
+
+/*
+ * Last values received for one characteristic (read results and
+ * notifications). Single producer, single consumer, no locks: the UART side
+ * pushes, the view pops whenever it gets to it. When the view falls behind
+ * the new value is dropped and counted instead of blocking the producer.
+ */
+typedef struct bt_value_ring_t {
+    bt_value_t slots[BT_VALUE_RING_SLOTS];
+    uint32_t head;              // next slot to write, producer only
+    uint32_t tail;              // next slot to read, consumer only
+    uint32_t received;          // every push, dropped or not
+    uint32_t dropped;
+} bt_value_ring_t;
+
+void bt_value_ring_init(bt_value_ring_t *ring);
+bool bt_value_ring_push(bt_value_ring_t *ring, const uint8_t *data, size_t len, uint32_t ts_ms);
+bool bt_value_ring_pop(bt_value_ring_t *ring, bt_value_t *out);
+
+// Pops everything queued and keeps only the newest. Returns how many were popped.
+size_t bt_value_ring_drain_latest(bt_value_ring_t *ring, bt_value_t *out);
+
+uint32_t bt_value_ring_received(const bt_value_ring_t *ring);
+uint32_t bt_value_ring_dropped(const bt_value_ring_t *ring);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BT_VALUE_RING_H */
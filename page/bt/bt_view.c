@@ -1,13 +1,72 @@
 #include "bt_view.h"
 #include "bt_scanner.h"
+#include "bt_controller.h"
 #include "components/ui_theme.h"
 #include "components/component_helper.h"
 #include "components/list/ui_list.h"
 #include "components/nav.h"
 #include <stdio.h>
+#include <string.h>
+
+#define EXPORT_POLL_PERIOD_MS 200
+
+static lv_obj_t *export_status = NULL;
+static lv_timer_t *export_timer = NULL;
+static char export_path[512];
+static int export_item_tag;   // identifies the export item in the shared list handler
+
+static void export_poll_cb(lv_timer_t *timer)
+{
+    (void)timer;
+
+    int rc;
+    if (!bt_controller_export_scan_log_poll(&rc))
+        return;
+
+    lv_timer_delete(export_timer);
+    export_timer = NULL;
+
+    if (rc != 0) {
+        lv_label_set_text(export_status, "Export failed");
+        return;
+    }
+
+    const char *name = strrchr(export_path, '/');
+    lv_label_set_text_fmt(export_status, "Saved %s", name ? name + 1 : export_path);
+}
+
+// The poll only touches the label, so it goes with it.
+static void export_status_delete_cb(lv_event_t *e)
+{
+    (void)e;
+
+    if (export_timer)
+        lv_timer_delete(export_timer);
+    export_timer = NULL;
+    export_status = NULL;
+}
+
+static void export_scan_log(void)
+{
+    if (export_timer)
+        return;
+
+    if (bt_controller_export_scan_log(export_path, sizeof(export_path)) != 0) {
+        lv_label_set_text(export_status, "Export failed");
+        return;
+    }
+
+    lv_label_set_text(export_status, "Exporting...");
+    export_timer = lv_timer_create(export_poll_cb, EXPORT_POLL_PERIOD_MS, NULL);
+}
 
 static void handler(ui_list *list, const list_item_t *item, void *user_data)
 {
+    if (item && item->user_data == &export_item_tag) {
+        export_scan_log();
+        return;
+    }
+
     nav_ctx_t *ctx = (nav_ctx_t *)user_data;
     if (!ctx || !ctx->menu || !ctx->page)
         return;
@@ -53,5 +112,20 @@ lv_obj_t *bt_page_create(lv_obj_t *menu, const zv_config *cfg)
 
     add_item(list, &item);
 
+    list_item_t export_item = {
+        .text = "Export log",
+        .subtitle = "Scan history as pcap",
+        .left_badge = { .label = LV_SYMBOL_SAVE, .type = BADGE_TEXT_TYPE },
+        .user_data = &export_item_tag,
+    };
+
+    add_item(list, &export_item);
+
+    export_status = lv_label_create(page);
+    lv_label_set_text(export_status, "");
+    lv_obj_set_style_text_color(export_status, ZV_COLOR_TEXT_MUTED, 0);
+    lv_obj_set_style_text_font(export_status, &lv_font_montserrat_10, 0);
+    lv_obj_add_event_cb(export_status, export_status_delete_cb, LV_EVENT_DELETE, NULL);
+
     return page;
 }
@@ -1,4 +1,5 @@
 #include "page/hid/hid_controller.h"
+#include "service/fs_watch.h"
 #include "utils/logger.h"
 #include "utils/error_handler.h"
 
@@ -40,7 +41,11 @@ hid_status_t hid_controller_init(hid_controller *controller, const zv_config *cf
             cfg->hid.selected_file) < 0))
         return HID_ERR_INVALID;
 
+    // Listed paths and watch events both join on it, keep one spelling.
+    normalize_dir_path(controller->scripts_dir);
+
     controller->hid_enabled = cfg ? cfg->hid.is_enabled : false;
+    controller->watch_handle = -1;
     set_last_error(NULL);
     return HID_OK;
 }
@@ -189,6 +194,72 @@ void hid_controller_free_script_list(hid_script_list *list)
     list->count = 0;
 }
 
+static void scripts_watch_cb(const fs_watch_event *fs_event, void *user_data)
+{
+    hid_controller *controller = (hid_controller *)user_data;
+    if (!controller || !controller->watch_cb)
+        return;
+
+    hid_script_event event;
+    memset(&event, 0, sizeof(event));
+
+    if (fs_event->type == FS_WATCH_OVERFLOW)
+    {
+        event.type = HID_SCRIPT_RESYNC;
+        controller->watch_cb(&event, controller->watch_user_data);
+        return;
+    }
+
+    // Same filter as hid_service_list_scripts_cb(): visible regular files only.
+    if (fs_event->is_dir || fs_event->name[0] == '.' || fs_event->type == FS_WATCH_MODIFIED)
+        return;
+
+    event.type = fs_event->type == FS_WATCH_ADDED ? HID_SCRIPT_ADDED : HID_SCRIPT_REMOVED;
+    snprintf(event.script.name, sizeof(event.script.name), "%s", fs_event->name);
+    if (snprintf(event.script.path, sizeof(event.script.path), "%s/%s", fs_event->dir, fs_event->name) >=
+        (int)sizeof(event.script.path))
+        return;
+
+    controller->watch_cb(&event, controller->watch_user_data);
+}
+
+hid_status_t hid_controller_watch_scripts(hid_controller *controller, hid_script_watch_cb cb, void *user_data)
+{
+    if (!controller || !cb)
+    {
+        set_last_error("Invalid arguments");
+        return HID_ERR_INVALID;
+    }
+
+    hid_controller_unwatch_scripts(controller);
+
+    controller->watch_handle = fs_watch_add(controller->scripts_dir, 0, scripts_watch_cb, controller);
+    if (controller->watch_handle < 0)
+    {
+        log_warning("[HID::controller]::hid_controller_watch_scripts can't watch %s\n", controller->scripts_dir);
+        set_last_error("Can't watch the scripts directory");
+        return HID_ERR_IO;
+    }
+
+    controller->watch_cb = cb;
+    controller->watch_user_data = user_data;
+    set_last_error(NULL);
+    return HID_OK;
+}
+
+void hid_controller_unwatch_scripts(hid_controller *controller)
+{
+    if (!controller)
+        return;
+
+    if (controller->watch_handle >= 0)
+        fs_watch_remove(controller->watch_handle);
+
+    controller->watch_handle = -1;
+    controller->watch_cb = NULL;
+    controller->watch_user_data = NULL;
+}
+
 const char *hid_controller_selected_script(const hid_controller *controller)
 {
     if (!controller)
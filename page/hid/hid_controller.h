@@ -23,11 +23,28 @@ typedef struct {
     size_t count;
 } hid_script_list;
 
+typedef enum {
+    HID_SCRIPT_ADDED,
+    HID_SCRIPT_REMOVED,
+    HID_SCRIPT_RESYNC       // events were lost, list the directory again
+} hid_script_event_type;
+
+typedef struct {
+    hid_script_event_type type;
+    hid_script_item script;
+} hid_script_event;
+
+typedef void (*hid_script_watch_cb)(const hid_script_event *event, void *user_data);
+
 typedef struct {
     char scripts_dir[HID_MAX_PATH];
     char selected_path[HID_MAX_PATH];
     char selected_script[HID_MAX_PATH];
     bool hid_enabled;
+
+    int watch_handle;
+    hid_script_watch_cb watch_cb;
+    void *watch_user_data;
 } hid_controller;
 
 hid_status_t hid_controller_init(hid_controller *controller, const zv_config *cfg);
@@ -35,6 +52,12 @@ hid_status_t hid_controller_set_selected_script(hid_controller *controller, cons
 hid_status_t hid_controller_toggle(hid_controller *controller, bool enable);
 hid_status_t hid_controller_list_scripts(hid_controller *controller, hid_script_list *out_list);
 void hid_controller_free_script_list(hid_script_list *list);
+/*
+ * Reports scripts created, moved in or deleted in scripts_dir through the
+ * filesystem watch (service/fs_watch.h), on the UI thread.
+ */
+hid_status_t hid_controller_watch_scripts(hid_controller *controller, hid_script_watch_cb cb, void *user_data);
+void hid_controller_unwatch_scripts(hid_controller *controller);
 const char *hid_controller_selected_script(const hid_controller *controller);
 const char *hid_controller_last_error(void);
 
@@ -49,6 +49,22 @@ static void hid_script_item_clicked(ui_list *list, const list_item_t *item, void
     set_status("Script selected.", ZV_COLOR_TEXT_MAIN, self);
 }
 
+static void add_script_item(hid_view *self, const hid_script_item *script)
+{
+    list_item_t item = {
+        .text = script->name,
+        .left_badge = {
+            .label = LV_SYMBOL_FILE,
+            .type = BADGE_TEXT_TYPE,
+            .text_color = ZV_COLOR_ACCENT,
+            .has_text_color = true,
+        },
+        .raw_value = script->path,
+    };
+
+    add_item(self->list, &item);
+}
+
 static void refresh_list_impl(hid_view *self)
 {
     if (!self)
@@ -63,24 +79,34 @@ static void refresh_list_impl(hid_view *self)
         return;
     }
 
-    for (size_t i = 0; i < scripts.count; i++) {
-        list_item_t item = {
-            .text = scripts.scripts[i].name,
-            .left_badge = {
-                .label = LV_SYMBOL_FILE,
-                .type = BADGE_TEXT_TYPE,
-                .text_color = ZV_COLOR_ACCENT,
-                .has_text_color = true,
-            },
-            .raw_value = scripts.scripts[i].path,
-        };
-
-        add_item(self->list, &item);
-    }
+    for (size_t i = 0; i < scripts.count; i++)
+        add_script_item(self, &scripts.scripts[i]);
 
     hid_controller_free_script_list(&scripts);
 }
 
+// Patches the list in place; an editor saving through a rename re-adds an existing script.
+static void hid_scripts_changed(const hid_script_event *event, void *user_data)
+{
+    hid_view *self = (hid_view *)user_data;
+    if (!self || !event)
+        return;
+
+    switch (event->type)
+    {
+        case HID_SCRIPT_ADDED:
+            if (!find_item(self->list, event->script.path))
+                add_script_item(self, &event->script);
+            break;
+        case HID_SCRIPT_REMOVED:
+            remove_item(self->list, event->script.path);
+            break;
+        case HID_SCRIPT_RESYNC:
+            refresh_list_impl(self);
+            break;
+    }
+}
+
 static void hid_refresh_btn_cb(lv_event_t *e)
 {
     hid_view *self = (hid_view *)lv_event_get_user_data(e);
@@ -167,6 +193,8 @@ static hid_view *hid_page_create(hid_view *self, lv_obj_t *menu, const zv_config
 
     hid_set_selected_label(self);
     refresh_list_impl(self);
+    // The refresh button stays for when inotify is not available.
+    hid_controller_watch_scripts(&self->controller, hid_scripts_changed, self);
     lv_obj_set_state(self->toggle, LV_STATE_CHECKED, self->controller.hid_enabled);
 
     return self;
@@ -185,9 +213,23 @@ lv_obj_t *hid_view_create(lv_obj_t *menu, const zv_config *cfg)
         return NULL;
     }
 
+    lv_obj_set_user_data(self->base.page, self);
     return self->base.page;
 }
 
+void hid_view_destroy(lv_obj_t *page)
+{
+    if (!page)
+        return;
+
+    hid_view *self = (hid_view *)lv_obj_get_user_data(page);
+    if (self)
+        hid_controller_unwatch_scripts(&self->controller);
+
+    lv_obj_del(page);
+    free(self);
+}
+
 void hid_refresh_scripts(hid_view *self)
 {
     refresh_list_impl(self);
@@ -22,6 +22,7 @@ typedef struct {
 } hid_view;
 
 lv_obj_t *hid_view_create(lv_obj_t *menu, const zv_config *cfg);
+void hid_view_destroy(lv_obj_t *page);
 void hid_refresh_scripts(hid_view *self);
 const char *hid_get_selected_script(hid_view *self);
 
@@ -1,6 +1,122 @@
 #include "home_view.h"
 
 #include "components/component_helper.h"
+#include "utils/logger.h"
+
+#define HOME_EVICT_PERIOD_MS 1000
+
+static bool is_at_home(home_view *self)
+{
+    return lv_menu_get_cur_main_page(self->menu) == self->base.page;
+}
+
+static void destroy_item(home_item *item)
+{
+    log_debug("home: dropping %s page\n", item->label);
+
+    item->destroy_page(item->nav.page);
+    item->nav.page = NULL;
+    if (item->owner->active == item)
+        item->owner->active = NULL;
+}
+
+static bool can_evict(const home_item *item)
+{
+    return item->nav.page && item->destroy_page && !(item->busy && item->busy());
+}
+
+static size_t resident_count(const home_view *self)
+{
+    size_t count = 0;
+    for (size_t i = 0; i < self->item_count; i++)
+    {
+        if (self->items[i].nav.page)
+            count++;
+    }
+    return count;
+}
+
+/*
+ * Drops the least recently used pages, never `keep`, until the cap is met.
+ * Busy modules are passed over, so the cap can be exceeded until they finish.
+ */
+static void enforce_page_cap(home_view *self, const home_item *keep)
+{
+    int cap = self->cfg ? self->cfg->display.page_cache_max : 0;
+    if (cap <= 0)
+        return;
+
+    while (resident_count(self) > (size_t)cap)
+    {
+        home_item *lru = NULL;
+        for (size_t i = 0; i < self->item_count; i++)
+        {
+            home_item *item = &self->items[i];
+            if (item == keep || !can_evict(item))
+                continue;
+
+            if (!lru || lv_tick_elaps(item->last_used_ms) > lv_tick_elaps(lru->last_used_ms))
+                lru = item;
+        }
+
+        if (!lru)
+            return;
+
+        destroy_item(lru);
+    }
+}
+
+/*
+ * Pages are only dropped while the home screen is showing, so nothing of a
+ * module is on screen or in the menu history when it goes away.
+ */
+static void evict_timer_cb(lv_timer_t *t)
+{
+    home_view *self = (home_view *)lv_timer_get_user_data(t);
+
+    if (!is_at_home(self))
+    {
+        if (self->active)
+            self->active->last_used_ms = lv_tick_get();
+        return;
+    }
+
+    int idle_s = self->cfg ? self->cfg->display.page_idle_timeout_s : 0;
+    if (idle_s <= 0)
+        return;
+
+    for (size_t i = 0; i < self->item_count; i++)
+    {
+        home_item *item = &self->items[i];
+        if (can_evict(item) && lv_tick_elaps(item->last_used_ms) >= (uint32_t)idle_s * 1000u)
+            destroy_item(item);
+    }
+}
+
+static void open_item_cb(lv_event_t *e)
+{
+    home_item *item = (home_item *)lv_event_get_user_data(e);
+    if (!item || !item->nav.menu)
+        return;
+
+    home_view *self = item->owner;
+    if (!item->nav.page)
+    {
+        item->nav.page = item->create_page(item->nav.menu, self->cfg);
+        if (!item->nav.page)
+        {
+            log_warning("home: could not build %s page\n", item->label);
+            return;
+        }
+    }
+
+    item->last_used_ms = lv_tick_get();
+    self->active = item;
+    enforce_page_cap(self, item);
+
+    lv_menu_set_page(item->nav.menu, item->nav.page);
+    zv_nav_update_group(item->nav.menu, item->nav.page);
+}
 
 home_view *home_view_create(home_view *self, lv_obj_t *menu, const zv_config *cfg, home_item *items, size_t item_count)
 {
@@ -10,8 +126,15 @@ home_view *home_view_create(home_view *self, lv_obj_t *menu, const zv_config *cf
     if (!zv_view_create(&self->base, menu, NULL))
         return NULL;
 
+    self->menu = menu;
+    self->cfg = cfg;
+    self->items = items;
+    self->item_count = item_count;
+    self->active = NULL;
+
     self->base.set_flex_layout(&self->base, LV_FLEX_FLOW_ROW_WRAP, 16, 14);
 
+    // Only the buttons are built here; each page waits for its first open.
     for (size_t i = 0; i < item_count; i++) 
     {
         home_item *item = &items[i];
@@ -19,15 +142,16 @@ home_view *home_view_create(home_view *self, lv_obj_t *menu, const zv_config *cf
             continue;
 
         item->nav.menu = menu;
-        item->nav.page = item->create_page(menu, cfg);
-        if (!item->nav.page)
-            continue;
+        item->nav.page = NULL;
+        item->owner = self;
 
-        lv_obj_t *btn = create_square_main_button(self->base.root, item->label, item->icon, zv_goto_page_cb, &item->nav);
+        lv_obj_t *btn = create_square_main_button(self->base.root, item->label, item->icon, open_item_cb, item);
         if (btn && item->rotate_icon_90)
             rotate_icon_by_tag(btn, 90);
     }
 
+    self->evict_timer = lv_timer_create(evict_timer_cb, HOME_EVICT_PERIOD_MS, self);
+
     return self;
 }
 
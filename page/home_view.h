@@ -11,18 +11,42 @@ extern "C" {
 #endif
 
 typedef lv_obj_t *(*home_page_create_cb)(lv_obj_t *menu, const zv_config *cfg);
-
+// Deletes a page built by create_page, subpages included.
+typedef void (*home_page_destroy_cb)(lv_obj_t *page);
+// True while the module has work running that destroy_page would cut short.
+typedef bool (*home_page_busy_cb)(void);
+
+typedef struct home_view home_view;
+
+/*
+ * A module on the home screen. Its page is built the first time it is
+ * opened; modules with destroy_page can be dropped again when idle or when
+ * too many pages are resident (display.page_cache_max / page_idle_timeout_s),
+ * except while `busy` says they are working.
+ */
 typedef struct {
     const char *label;
     const char *icon;
     home_page_create_cb create_page;
+    home_page_destroy_cb destroy_page;
+    home_page_busy_cb busy;
     bool rotate_icon_90;
-    nav_ctx_t nav;
+    nav_ctx_t nav;              // nav.page is NULL while not built
+
+    uint32_t last_used_ms;
+    home_view *owner;
 } home_item;
 
-typedef struct {
+struct home_view {
     base_view base;
-} home_view;
+
+    lv_obj_t *menu;
+    const zv_config *cfg;
+    home_item *items;
+    size_t item_count;
+    home_item *active;          // module last opened from the home screen
+    lv_timer_t *evict_timer;
+};
 
 lv_obj_t *get_page(home_view *self);
 home_view *home_view_create(home_view *self, lv_obj_t *menu, const zv_config *cfg, 
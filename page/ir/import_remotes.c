@@ -0,0 +1,174 @@
+#include "page/ir/import_remotes.h"
+#include "components/component_helper.h"
+#include "components/ui_theme.h"
+#include "config.h"
+#include "page/ir/ir_controller.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#define IMPORT_POLL_PERIOD_MS 100
+
+typedef struct {
+    lv_obj_t *page;
+    lv_obj_t *bar;
+    lv_obj_t *counts;
+    lv_obj_t *status;
+    lv_timer_t *poll_timer;     // paused unless an import runs
+    char path[512];
+} import_ui_t;
+
+static import_ui_t g_import;
+
+static void import_set_status(const char *txt)
+{
+    if (g_import.status)
+        lv_label_set_text(g_import.status, txt);
+}
+
+static void import_show_progress(const ir_import_progress *p)
+{
+    // Bytes rather than files: one lircd.conf can hold a whole library.
+    int32_t percent = p->bytes_total > 0 ? (int32_t)(p->bytes_done * 100 / p->bytes_total) : 0;
+    lv_bar_set_value(g_import.bar, p->finished && p->status == IR_OK ? 100 : percent, LV_ANIM_OFF);
+    lv_label_set_text_fmt(g_import.counts, "Files %d/%d  Remotes %d  Buttons %d  Skipped %d  Kept %d",
+                          p->files, p->files_total, p->remotes, p->buttons, p->skipped, p->existing);
+    import_set_status(p->message);
+}
+
+static void import_poll_timer_cb(lv_timer_t *timer)
+{
+    (void)timer;
+    ir_import_progress progress;
+
+    if (!ir_controller_import_poll(&progress)) {
+        lv_timer_pause(g_import.poll_timer);
+        return;
+    }
+
+    import_show_progress(&progress);
+    if (progress.finished)
+        lv_timer_pause(g_import.poll_timer);
+}
+
+static void import_start_cb(lv_event_t *e)
+{
+    (void)e;
+
+    if (ir_controller_import_busy())
+        return;
+
+    if (ir_controller_import_async(g_import.path) != IR_OK) {
+        import_set_status(ir_controller_last_error());
+        return;
+    }
+
+    lv_bar_set_value(g_import.bar, 0, LV_ANIM_OFF);
+    lv_label_set_text(g_import.counts, "");
+    import_set_status("Scanning library...");
+    lv_timer_resume(g_import.poll_timer);
+}
+
+static void import_cancel_cb(lv_event_t *e)
+{
+    (void)e;
+
+    if (!ir_controller_import_busy())
+        return;
+
+    // The poll timer keeps running and shows the summary once the worker stops.
+    ir_controller_import_cancel();
+    import_set_status("Canceling...");
+}
+
+static lv_obj_t *import_create_footer_btn(lv_obj_t *parent, const char *text, lv_event_cb_t cb)
+{
+    lv_obj_t *btn = lv_btn_create(parent);
+    lv_obj_set_size(btn, LV_PCT(45), 40);
+    lv_obj_set_style_bg_color(btn, ZV_COLOR_BG_PANEL, 0);
+    lv_obj_set_style_bg_opa(btn, LV_OPA_COVER, 0);
+    lv_obj_set_style_border_width(btn, 2, 0);
+    lv_obj_set_style_border_color(btn, ZV_COLOR_BORDER, 0);
+    lv_obj_set_style_radius(btn, 12, 0);
+    lv_obj_add_event_cb(btn, cb, LV_EVENT_CLICKED, NULL);
+
+    lv_obj_t *label = lv_label_create(btn);
+    lv_label_set_text(label, text);
+    lv_obj_set_style_text_color(label, ZV_COLOR_TEXT_MAIN, 0);
+    lv_obj_center(label);
+
+    return btn;
+}
+
+lv_obj_t *ir_import_remotes_page_create(lv_obj_t *menu)
+{
+    lv_obj_t *page = lv_menu_page_create(menu, "Import Remotes");
+    lv_obj_set_scrollbar_mode(page, LV_SCROLLBAR_MODE_OFF);
+
+    memset(&g_import, 0, sizeof(g_import));
+    g_import.page = page;
+
+    const zv_config *cfg = config_get();
+    if (cfg)
+        snprintf(g_import.path, sizeof(g_import.path), "%s", cfg->ir.import_path);
+
+    lv_obj_t *root = lv_obj_create(page);
+    lv_obj_set_size(root, LV_PCT(100), LV_PCT(100));
+    lv_obj_set_style_bg_opa(root, LV_OPA_TRANSP, 0);
+    lv_obj_set_style_border_width(root, 0, 0);
+    lv_obj_set_style_pad_all(root, 12, 0);
+    lv_obj_clear_flag(root, LV_OBJ_FLAG_SCROLLABLE);
+
+    lv_obj_set_layout(root, LV_LAYOUT_FLEX);
+    lv_obj_set_flex_flow(root, LV_FLEX_FLOW_COLUMN);
+    lv_obj_set_style_pad_row(root, 10, 0);
+
+    create_section_label(root, "Library (lircd.conf / Flipper .ir):");
+
+    lv_obj_t *path_label = lv_label_create(root);
+    lv_label_set_text(path_label, g_import.path[0] ? g_import.path : "(ir.import_path not set)");
+    lv_obj_set_style_text_color(path_label, ZV_COLOR_TEXT_MUTED, 0);
+    lv_label_set_long_mode(path_label, LV_LABEL_LONG_WRAP);
+    lv_obj_set_width(path_label, LV_PCT(100));
+
+    g_import.bar = lv_bar_create(root);
+    lv_obj_set_size(g_import.bar, LV_PCT(100), 16);
+    lv_bar_set_range(g_import.bar, 0, 100);
+    lv_bar_set_value(g_import.bar, 0, LV_ANIM_OFF);
+    lv_obj_set_style_bg_color(g_import.bar, ZV_COLOR_BG_PANEL, LV_PART_MAIN);
+    lv_obj_set_style_bg_color(g_import.bar, ZV_COLOR_ACCENT, LV_PART_INDICATOR);
+
+    g_import.counts = lv_label_create(root);
+    lv_label_set_text(g_import.counts, "");
+    lv_obj_set_style_text_color(g_import.counts, ZV_COLOR_TEXT_MAIN, 0);
+    lv_label_set_long_mode(g_import.counts, LV_LABEL_LONG_WRAP);
+    lv_obj_set_width(g_import.counts, LV_PCT(100));
+
+    g_import.status = lv_label_create(root);
+    lv_label_set_text(g_import.status, "Buttons are stored decoded when the protocol is known.");
+    lv_obj_set_style_text_color(g_import.status, ZV_COLOR_TEXT_MAIN, 0);
+    lv_label_set_long_mode(g_import.status, LV_LABEL_LONG_WRAP);
+    lv_obj_set_width(g_import.status, LV_PCT(100));
+
+    lv_obj_t *footer_row = create_transparent_flex_row(root, LV_PCT(100), 50);
+    import_create_footer_btn(footer_row, "Cancel", import_cancel_cb);
+    import_create_footer_btn(footer_row, LV_SYMBOL_DOWNLOAD "  Import", import_start_cb);
+
+    g_import.poll_timer = lv_timer_create(import_poll_timer_cb, IMPORT_POLL_PERIOD_MS, NULL);
+    lv_timer_pause(g_import.poll_timer);
+
+    return page;
+}
+
+void ir_import_remotes_page_destroy(void)
+{
+    // An import left running would outlive the page; what it wrote so far is kept
+    // and published by the next import.
+    ir_controller_import_cancel();
+    if (g_import.poll_timer)
+        lv_timer_delete(g_import.poll_timer);
+    if (g_import.page)
+        lv_obj_del(g_import.page);
+
+    memset(&g_import, 0, sizeof(g_import));
+}
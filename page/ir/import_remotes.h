@@ -0,0 +1,17 @@
+#ifndef IR_IMPORT_REMOTES_H
+#define IR_IMPORT_REMOTES_H
+
+#include "lvgl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+lv_obj_t *ir_import_remotes_page_create(lv_obj_t *menu);
+void ir_import_remotes_page_destroy(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* IR_IMPORT_REMOTES_H */
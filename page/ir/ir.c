@@ -6,6 +6,11 @@
 #include "page/ir/learn_button.h"
 #include "page/ir/send_signal.h"
 #include "page/ir/remotes.h"
+#include "page/ir/import_remotes.h"
+#include "page/ir/macros.h"
+#include "page/ir/sniffer.h"
+#include "page/ir/waveform.h"
+#include "page/ir/ir_controller.h"
 
 static void ir_menu_handler(ui_list *list, const list_item_t *item, void *user_data)
 {
@@ -33,11 +38,19 @@ lv_obj_t *ir_page_create(lv_obj_t *menu, const zv_config *cfg)
     lv_obj_t *new_remote_page = ir_new_remote_page_create(menu);
     lv_obj_t *learn_button_page = ir_learn_button_page_create(menu);
     lv_obj_t *send_signal_page = ir_send_signal_page_create(menu);
+    lv_obj_t *macros_page = ir_macros_page_create(menu);
+    lv_obj_t *import_page = ir_import_remotes_page_create(menu);
+    lv_obj_t *sniffer_page = ir_sniffer_page_create(menu);
+    lv_obj_t *waveform_page = ir_waveform_page_create(menu);
 
     static nav_ctx_t nav_remotes;
     static nav_ctx_t nav_new_remote;
     static nav_ctx_t nav_learn_button;
     static nav_ctx_t nav_send_signal;
+    static nav_ctx_t nav_macros;
+    static nav_ctx_t nav_import;
+    static nav_ctx_t nav_sniffer;
+    static nav_ctx_t nav_waveform;
 
     nav_remotes.menu = menu;
     nav_remotes.page = remotes_page;
@@ -51,6 +64,18 @@ lv_obj_t *ir_page_create(lv_obj_t *menu, const zv_config *cfg)
     nav_send_signal.menu = menu;
     nav_send_signal.page = send_signal_page;
 
+    nav_macros.menu = menu;
+    nav_macros.page = macros_page;
+
+    nav_import.menu = menu;
+    nav_import.page = import_page;
+
+    nav_sniffer.menu = menu;
+    nav_sniffer.page = sniffer_page;
+
+    nav_waveform.menu = menu;
+    nav_waveform.page = waveform_page;
+
     ui_list *list = create_list(page, 100, 100);
     set_list_border(list, false);
     set_list_bg_color(list, ZV_COLOR_BG_MAIN);
@@ -111,6 +136,30 @@ lv_obj_t *ir_page_create(lv_obj_t *menu, const zv_config *cfg)
             },
             .user_data = &nav_send_signal,
         },
+        {
+            .text = "Macros",
+            .subtitle = "Several buttons in one tap",
+            .left_badge = { .label = LV_SYMBOL_PLAY, .type = BADGE_TEXT_TYPE },
+            .user_data = &nav_macros,
+        },
+        {
+            .text = "Import",
+            .subtitle = "lircd.conf / Flipper .ir",
+            .left_badge = { .label = LV_SYMBOL_DOWNLOAD, .type = BADGE_TEXT_TYPE },
+            .user_data = &nav_import,
+        },
+        {
+            .text = "IR Monitor",
+            .subtitle = "Decode what remotes send",
+            .left_badge = { .label = LV_SYMBOL_EYE_OPEN, .type = BADGE_TEXT_TYPE },
+            .user_data = &nav_sniffer,
+        },
+        {
+            .text = "Waveform",
+            .subtitle = "Inspect a capture",
+            .left_badge = { .label = LV_SYMBOL_IMAGE, .type = BADGE_TEXT_TYPE },
+            .user_data = &nav_waveform,
+        },
     };
 
     for (size_t i = 0; i < sizeof(items) / sizeof(items[0]); i++)
@@ -118,3 +167,25 @@ lv_obj_t *ir_page_create(lv_obj_t *menu, const zv_config *cfg)
 
     return page;
 }
+
+// Destroying the pages would cancel these, so the home screen keeps them around.
+bool ir_page_busy(void)
+{
+    return ir_controller_learn_busy() || ir_controller_import_busy() ||
+           ir_controller_macro_busy() || ir_controller_monitor_busy();
+}
+
+void ir_page_destroy(lv_obj_t *page)
+{
+    ir_remotes_page_destroy();
+    ir_new_remote_page_destroy();
+    ir_learn_button_page_destroy();
+    ir_send_signal_page_destroy();
+    ir_macros_page_destroy();
+    ir_import_remotes_page_destroy();
+    ir_sniffer_page_destroy();
+    ir_waveform_page_destroy();
+
+    if (page)
+        lv_obj_del(page);
+}
@@ -10,6 +10,8 @@ extern "C" {
 
 
 lv_obj_t *ir_page_create(lv_obj_t *menu, const zv_config *cfg);
+void ir_page_destroy(lv_obj_t *page);
+bool ir_page_busy(void);
 
 
 #ifdef __cplusplus
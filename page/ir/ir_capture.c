@@ -0,0 +1,314 @@
+#include "page/ir/ir_capture.h"
+#include "utils/logger.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#define FRAME_GAP_US        10000   // a space this long separates two frames
+#define DEFAULT_GAP_US      20000   // same synthetic gap as ir_raw_helper
+#define MIN_FRAME_DURATIONS 3       // NEC repeat code; anything shorter is a glitch
+
+#define SHAPE_TOLERANCE_PCT 25
+#define SHAPE_SLACK_US      150     // short marks jitter by a fixed amount, not a ratio
+#define SNAP_TOLERANCE_PCT  20
+#define SNAP_STEP_US        10
+
+#define MAX_FRAMES          64
+#define MAX_PATTERN         16
+
+typedef struct {
+    const uint32_t *durations;  // into the capture, pulse first, without the trailing gap
+    int count;                  // always odd
+    uint32_t gap;               // space that followed the frame, 0 for the last one
+    int capture;
+    int cluster;
+} frame_ref;
+
+// Consecutive frames of the same cluster collapsed into one step.
+typedef struct {
+    int cluster[MAX_PATTERN];
+    int run[MAX_PATTERN];
+    int steps;
+    bool valid;
+} press_pattern;
+
+static bool close_enough(uint32_t a, uint32_t b)
+{
+    uint32_t diff = a > b ? a - b : b - a;
+    uint32_t slack = (a > b ? a : b) * SHAPE_TOLERANCE_PCT / 100;
+    return diff <= (slack > SHAPE_SLACK_US ? slack : SHAPE_SLACK_US);
+}
+
+static bool same_shape(const frame_ref *a, const frame_ref *b)
+{
+    if (a->count != b->count)
+        return false;
+
+    for (int i = 0; i < a->count; i++)
+    {
+        if (!close_enough(a->durations[i], b->durations[i]))
+            return false;
+    }
+
+    return true;
+}
+
+static void add_frame(frame_ref *frames, int *used, const uint32_t *d, int count, uint32_t gap, int capture)
+{
+    // A frame cut right after a space loses that space.
+    if (count % 2 == 0)
+        count--;
+
+    if (count < MIN_FRAME_DURATIONS || *used == MAX_FRAMES)
+        return;
+
+    frame_ref *f = &frames[(*used)++];
+    f->durations = d;
+    f->count = count;
+    f->gap = gap;
+    f->capture = capture;
+    f->cluster = -1;
+}
+
+static int split_frames(const ir_signal *captures, int count, frame_ref *frames)
+{
+    int used = 0;
+    for (int c = 0; c < count; c++)
+    {
+        const uint32_t *d = captures[c].durations;
+        int start = 0;
+
+        for (int i = 1; i < captures[c].count; i += 2)
+        {
+            if (d[i] < FRAME_GAP_US)
+                continue;
+
+            add_frame(frames, &used, d + start, i - start, d[i], c);
+            start = i + 1;
+        }
+
+        if (start < captures[c].count)
+            add_frame(frames, &used, d + start, captures[c].count - start, 0, c);
+    }
+
+    return used;
+}
+
+// Greedy: a frame joins the first cluster whose first member has its shape.
+static int cluster_frames(frame_ref *frames, int count, int *first_member)
+{
+    int clusters = 0;
+    for (int i = 0; i < count; i++)
+    {
+        for (int k = 0; k < clusters && frames[i].cluster < 0; k++)
+        {
+            if (same_shape(&frames[i], &frames[first_member[k]]))
+                frames[i].cluster = k;
+        }
+
+        if (frames[i].cluster < 0)
+        {
+            first_member[clusters] = i;
+            frames[i].cluster = clusters++;
+        }
+    }
+
+    return clusters;
+}
+
+static void build_pattern(const frame_ref *frames, int count, int capture, press_pattern *out)
+{
+    memset(out, 0, sizeof(*out));
+    out->valid = true;
+
+    for (int i = 0; i < count; i++)
+    {
+        if (frames[i].capture != capture)
+            continue;
+
+        if (out->steps > 0 && out->cluster[out->steps - 1] == frames[i].cluster)
+        {
+            out->run[out->steps - 1]++;
+            continue;
+        }
+
+        if (out->steps == MAX_PATTERN)
+        {
+            out->valid = false;
+            return;
+        }
+
+        out->cluster[out->steps] = frames[i].cluster;
+        out->run[out->steps++] = 1;
+    }
+
+    out->valid = out->steps > 0;
+}
+
+static bool same_pattern(const press_pattern *a, const press_pattern *b)
+{
+    return a->valid && b->valid && a->steps == b->steps &&
+           memcmp(a->cluster, b->cluster, (size_t)a->steps * sizeof(int)) == 0;
+}
+
+// Element-wise mean of the cluster members that belong to agreeing captures.
+static uint32_t average_frame(const frame_ref *frames, int count, int cluster, const bool *agrees,
+                              uint32_t *out, int out_len)
+{
+    uint64_t sums[IR_SIGNAL_MAX_DURATIONS];
+    uint64_t gap_sum = 0;
+    int members = 0;
+    int gaps = 0;
+
+    memset(sums, 0, (size_t)out_len * sizeof(uint64_t));
+    for (int i = 0; i < count; i++)
+    {
+        if (frames[i].cluster != cluster || !agrees[frames[i].capture])
+            continue;
+
+        for (int k = 0; k < out_len; k++)
+            sums[k] += frames[i].durations[k];
+        members++;
+
+        if (frames[i].gap)
+        {
+            gap_sum += frames[i].gap;
+            gaps++;
+        }
+    }
+
+    for (int k = 0; k < out_len; k++)
+        out[k] = (uint32_t)(sums[k] / (uint64_t)members);
+
+    return gaps ? (uint32_t)(gap_sum / (uint64_t)gaps) : DEFAULT_GAP_US;
+}
+
+static int compare_u32(const void *a, const void *b)
+{
+    uint32_t x = *(const uint32_t *)a;
+    uint32_t y = *(const uint32_t *)b;
+    return (x > y) - (x < y);
+}
+
+/*
+ * Groups the pulses (parity 0) or spaces (parity 1) below FRAME_GAP_US into
+ * bands of close values and replaces each with its band mean, so a frame
+ * ends up with the two or three timings the protocol defines.
+ */
+static void snap_timings(uint32_t *d, int count, int parity)
+{
+    uint32_t sorted[IR_SIGNAL_MAX_DURATIONS];
+    int n = 0;
+    for (int i = parity; i < count; i += 2)
+    {
+        if (d[i] < FRAME_GAP_US)
+            sorted[n++] = d[i];
+    }
+    if (n == 0)
+        return;
+
+    qsort(sorted, (size_t)n, sizeof(uint32_t), compare_u32);
+
+    int start = 0;
+    while (start < n)
+    {
+        uint32_t low = sorted[start];
+        uint32_t limit = low + low * SNAP_TOLERANCE_PCT / 100;
+        uint64_t sum = 0;
+        int end = start;
+        while (end < n && sorted[end] <= limit)
+            sum += sorted[end++];
+
+        uint32_t mean = (uint32_t)(sum / (uint64_t)(end - start));
+        uint32_t snapped = (mean + SNAP_STEP_US / 2) / SNAP_STEP_US * SNAP_STEP_US;
+        uint32_t high = sorted[end - 1];
+
+        for (int i = parity; i < count; i += 2)
+        {
+            if (d[i] >= low && d[i] <= high)
+                d[i] = snapped;
+        }
+
+        start = end;
+    }
+}
+
+int ir_capture_merge(const ir_signal *captures, int count, ir_signal *out)
+{
+    if (!captures || count <= 0 || count > IR_CAPTURE_MAX_PRESSES || !out)
+        return -1;
+
+    frame_ref frames[MAX_FRAMES];
+    int first_member[MAX_FRAMES];
+    int frame_count = split_frames(captures, count, frames);
+    if (frame_count == 0)
+        return -1;
+
+    int clusters = cluster_frames(frames, frame_count, first_member);
+
+    press_pattern patterns[IR_CAPTURE_MAX_PRESSES];
+    for (int c = 0; c < count; c++)
+        build_pattern(frames, frame_count, c, &patterns[c]);
+
+    // The pattern most presses agree on; glued or noisy presses fall out here.
+    int best = -1;
+    int best_votes = 0;
+    for (int c = 0; c < count; c++)
+    {
+        int votes = 0;
+        for (int k = 0; k < count; k++)
+            votes += same_pattern(&patterns[c], &patterns[k]);
+
+        if (votes > best_votes)
+        {
+            best = c;
+            best_votes = votes;
+        }
+    }
+    if (best < 0)
+        return -1;
+
+    bool agrees[IR_CAPTURE_MAX_PRESSES];
+    int min_run = 0;
+    for (int c = 0; c < count; c++)
+    {
+        agrees[c] = same_pattern(&patterns[best], &patterns[c]);
+        if (agrees[c] && (min_run == 0 || patterns[c].run[0] < min_run))
+            min_run = patterns[c].run[0];
+    }
+
+    memset(out, 0, sizeof(*out));
+    out->durations = (uint32_t *)malloc(IR_SIGNAL_MAX_DURATIONS * sizeof(uint32_t));
+    if (!out->durations)
+        return -1;
+
+    const press_pattern *pattern = &patterns[best];
+    for (int s = 0; s < pattern->steps; s++)
+    {
+        const frame_ref *model = &frames[first_member[pattern->cluster[s]]];
+        if (out->count + model->count + 1 > IR_SIGNAL_MAX_DURATIONS)
+        {
+            ir_signal_free(out);
+            return -1;
+        }
+
+        uint32_t *frame = out->durations + out->count;
+        uint32_t gap = average_frame(frames, frame_count, pattern->cluster[s], agrees, frame, model->count);
+        snap_timings(frame, model->count, 0);
+        snap_timings(frame, model->count, 1);
+
+        frame[model->count] = gap;
+        out->count += model->count + 1;
+    }
+
+    // A single repeated frame is stored once; a multi-part message as a whole.
+    if (pattern->steps == 1)
+        out->repeats = (uint8_t)(min_run - 1 > 255 ? 255 : min_run - 1);
+
+    out->carrier = captures[best].carrier;
+    out->duty_cycle = captures[best].duty_cycle;
+
+    log_info("[IR][capture]::ir_capture_merge presses=%d agreeing=%d frames=%d clusters=%d durations=%d repeats=%d",
+             count, best_votes, frame_count, clusters, out->count, (int)out->repeats);
+    return 0;
+}
@@ -0,0 +1,27 @@
+#ifndef IR_CAPTURE_H
+#define IR_CAPTURE_H
+
+#include "service/ir_signal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define IR_CAPTURE_MAX_PRESSES 8
+
+/*
+ * Merges several captures of the same button into one signal. Captures are
+ * split into frames on long spaces, frames of the same shape are clustered
+ * and averaged, and the result is snapped to the few timings it really uses.
+ *
+ * When every press repeats a single frame, `out` holds that frame once,
+ * ending in its gap, with `repeats` set. Captures that disagree with the
+ * majority are ignored. Returns 0 on success.
+ */
+int ir_capture_merge(const ir_signal *captures, int count, ir_signal *out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* IR_CAPTURE_H */
@@ -1,23 +1,41 @@
 #include "ir_controller.h"
+#include "page/ir/ir_capture.h"
+#include "page/ir/ir_macro.h"
 #include "page/ir/ir_raw_helper.h"
+#include "page/ir/ir_remote_catalog.h"
+#include "page/ir/ir_signal_cache.h"
+#include "service/fs_watch.h"
+#include "service/ir_import.h"
+#include "service/ir_protocol.h"
 #include "utils/string_utils.h"
 #include "utils/error_handler.h"
+#include "utils/logger.h"
 
+#include <ctype.h>
 #include <stdio.h>
 #include <string.h>
 #include <limits.h>
 #include <stdlib.h>
 #include <unistd.h>
 #include <errno.h>
+#include <pthread.h>
+#include <dirent.h>
+#include <sys/stat.h>
 
 #define DEFAULT_LIST_AMOUNT 8
 #define IR_LEARN_MAX_ATTEMPTS 3
+#define IR_WATCH_MAX_LISTENERS 4
+#define IR_MACRO_MAX_FILES 64
+#define IR_IMPORT_MAX_DEPTH 8           // sub-directories followed under an import path
+#define IR_IMPORT_RESYNC_REMOTES 16     // past this, listeners get one RESYNC instead of an event each
 
-typedef struct {
-    ir_remote_list *list;
-    size_t capacity;
-    int has_error;
-} remotes_handler_ctx;
+// Must be a power of two. One learn reports at most 4 events per attempt + DONE.
+#define IR_LEARN_EVENT_RING 16
+
+// Must be a power of two. About 6 s of NEC holding a key at the UI's 16 frames per tick.
+#define IR_MONITOR_RING 64
+#define IR_MONITOR_REPEAT_GAP_US 150000 // a frame this close to the previous one can be its repeat
+#define IR_MONITOR_REPEAT_COUNT 3       // NEC repeat code: 9 ms pulse, 2.25 ms space, 560 µs pulse
 
 typedef struct {
     ir_button_list *list;
@@ -27,13 +45,136 @@ typedef struct {
 
 static ir_remote_ctx remote_context;
 
-static void count_raw_file_cb(const file_desc *desc, void *obj)
+/*
+ * One learn at a time. The worker is the only producer of `events` and the
+ * UI thread the only consumer; the thread is joined once it reported DONE.
+ */
+static struct {
+    pthread_t thread;
+    bool started;
+    bool finished;
+    char remote[IR_MAX_NAME];
+    char button[IR_MAX_NAME];
+    uint16_t protocol;          // what the last capture decoded to, reported with DONE
+    int press;                  // multi-press learn progress, copied into every event
+    int presses;
+
+    ir_learn_event events[IR_LEARN_EVENT_RING];
+    unsigned int head;
+    unsigned int tail;
+} learn_job;
+
+static void learn_join(void);
+
+typedef struct {
+    ir_catalog_remote info;     // button_count counts the buttons the import added
+    bool existed;               // the import extended a remote that was already there
+} import_remote;
+
+/*
+ * One import at a time. `progress` is shared with the UI thread under
+ * import_lock; the rest belongs to the worker until the UI thread joins it.
+ */
+static struct {
+    pthread_t thread;
+    bool started;
+    bool finished;
+    bool cancel;
+    char path[PATH_MAX];
+    ir_import_progress progress;
+
+    import_remote *remotes;
+    size_t remote_count;
+    size_t remote_capacity;
+    size_t current;             // remote of the last button, files list a remote's buttons together
+    char buttons_dir[PATH_MAX];
+    long file_offset;           // bytes of the files already read
+    int failed;                 // buttons that could not be written
+    int existing;               // name already taken in the remote, left alone
+    ir_import_stats stats;
+
+    // UI thread: remotes of the watch events skipped while started, checked on publish.
+    char dropped_remotes[IR_IMPORT_RESYNC_REMOTES][IR_MAX_NAME];
+    int dropped_count;
+    bool events_dropped;        // one could not be tied to a remote or the list is full
+} import_job;
+
+static pthread_mutex_t import_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/*
+ * One macro at a time. The plan is built on the UI thread before the
+ * worker starts and freed after the join; the worker only reads it.
+ */
+static struct {
+    pthread_t thread;
+    bool started;
+    bool finished;
+    bool cancel;
+    char name[IR_MAX_NAME];
+    ir_macro_plan plan;
+    ir_macro_result result;
+} macro_job;
+
+static void macro_join(void);
+
+/*
+ * The monitor reader is the only producer of `frames` and the UI thread the
+ * only consumer. A full ring drops the new frame and counts it in `dropped`
+ * instead of waiting, so a burst never backs up into the driver.
+ */
+static struct {
+    pthread_t thread;
+    bool started;
+    bool finished;
+    ir_status_t status;
+    char message[128];
+
+    ir_monitor_frame frames[IR_MONITOR_RING];
+    unsigned int head;
+    unsigned int tail;
+    unsigned int received;
+    unsigned int dropped;
+    ir_decoded last;            // reader only: previous frame, for `repeat`
+    uint32_t last_gap_us;
+} monitor_job;
+
+static void monitor_join(void);
+
+static void import_stop(void);
+
+// Remote picked in the send page; its buttons are kept parsed in the signal cache.
+static struct {
+    char remote[IR_MAX_NAME];
+    char buttons_dir[PATH_MAX];
+} selected;
+
+/*
+ * Pages listening for remote changes. One fs_watch subscription covers them
+ * all: remotes_root, each remote directory and its buttons/ (depth 2).
+ */
+static struct {
+    int fs_handle;
+    struct {
+        ir_watch_cb cb;
+        void *user_data;
+    } listeners[IR_WATCH_MAX_LISTENERS];
+} watch = { -1, {} };
+
+static void watch_stop(void);
+
+// A button converted with zv-ir-convert -k has both files; the .irb wins.
+static bool shadowed_by_binary(const file_desc *desc)
 {
-    (void)desc;
+    if (!file_has_extension(desc->file_name, IR_SIGNAL_EXT_RAW))
+        return false;
 
-    int *counter = (int *)obj;
-    if (counter)
-        (*counter)++;
+    char bin_path[PATH_MAX];
+    size_t base_len = strlen(desc->file_path) - strlen(IR_SIGNAL_EXT_RAW);
+    if (snprintf(bin_path, sizeof(bin_path), "%.*s%s", (int)base_len, desc->file_path,
+                 IR_SIGNAL_EXT_BIN) >= (int)sizeof(bin_path))
+        return false;
+
+    return access(bin_path, F_OK) == 0;
 }
 
 static int create_directory_path(const char *parent_directory, const char *new_directory, char *result_directory, size_t out_sz)
@@ -54,68 +195,28 @@ static int create_file_path(const char *parent_directory, const char *file_name,
     return 0;
 }
 
-static void handle_file_list(const file_desc *description, void *obj_target)
+static ir_button *button_list_append(buttons_handler_ctx *handler_ctx)
 {
-    remotes_handler_ctx *handler_ctx = (remotes_handler_ctx *)obj_target;
-    if (!handler_ctx || !handler_ctx->list->remotes || !description)
-        return;
-
-    if (!description->is_dir)
-        return;
-
-    if (handler_ctx->list->count == handler_ctx->capacity) 
+    if (handler_ctx->list->count == handler_ctx->capacity)
     {
-        // we need to add more space to the list because we have more remotes than expected.
-
         size_t new_capacity = handler_ctx->capacity * 2;
-        ir_remote_info *tmp_remotes = (ir_remote_info *)realloc(
-            handler_ctx->list->remotes, new_capacity * sizeof(ir_remote_info));
-        if (!tmp_remotes) 
+        ir_button *tmp_buttons = (ir_button *)realloc(
+            handler_ctx->list->buttons, new_capacity * sizeof(ir_button));
+
+        if (!tmp_buttons)
         {
             handler_ctx->has_error = 1;
-            return;
+            return NULL;
         }
 
-        handler_ctx->list->remotes = tmp_remotes;
+        handler_ctx->list->buttons = tmp_buttons;
         handler_ctx->capacity = new_capacity;
     }
 
-    int next_slot = handler_ctx->list->count;
-    ir_remote_info *remote = &handler_ctx->list->remotes[next_slot];
-    memset(remote, 0, sizeof(*remote));
-
-    // getting the remote directory name
-    strncpy(remote->name, description->file_name, sizeof(remote->name) - 1);
-    remote->name[sizeof(remote->name) - 1] = '\0';
-
-    char buttons_dir[PATH_MAX];
-    int n = snprintf(buttons_dir, sizeof(buttons_dir), "%s/buttons", description->file_path);
-    if (n < 0 || (size_t)n >= sizeof(buttons_dir))
-    {
-        remote->button_count = 0;
-        handler_ctx->list->count++;
-        return;
-    }
-
-    if (!file_is_directory(buttons_dir)) {
-        remote->button_count = 0;
-        handler_ctx->list->count++;
-        return;
-    }
-
-    int raw_counter = 0;
-    ir_callback_event event;
-    memset(&event, 0, sizeof(event));
-    event.cb = count_raw_file_cb;
-    event.data = &raw_counter;
-
-    if (ir_list_raw_files_cb(buttons_dir, &event) != IR_OK) {
-        remote->button_count = 0;
-    } else {
-        remote->button_count = raw_counter;
-    }
-
-    handler_ctx->list->count++;
+    size_t next_slot = handler_ctx->list->count++;
+    ir_button *button = &handler_ctx->list->buttons[next_slot];
+    memset(button, 0, sizeof(*button));
+    return button;
 }
 
 static void handle_raw_filelist(const file_desc *description, void *obj_target)
@@ -127,37 +228,51 @@ static void handle_raw_filelist(const file_desc *description, void *obj_target)
     if (!description->is_file)
         return;
 
-    if (!file_has_extension(description->file_name, ".raw"))
+    if (!ir_signal_is_file_name(description->file_name) || shadowed_by_binary(description))
         return;
 
-    if (handler_ctx->list->count == handler_ctx->capacity)
-    {
-        size_t new_capacity = handler_ctx->capacity * 2;
-        ir_button *tmp_buttons = (ir_button *)realloc(
-            handler_ctx->list->buttons, new_capacity * sizeof(ir_button));
-
-        if (!tmp_buttons)
-        {
-            handler_ctx->has_error = 1;
-            return;
-        }
-
-        handler_ctx->list->buttons = tmp_buttons;
-        handler_ctx->capacity = new_capacity;
-    }
-
-    size_t next_slot = handler_ctx->list->count;
-    ir_button *button = &handler_ctx->list->buttons[next_slot];
-    memset(button, 0, sizeof(*button));
+    ir_button *button = button_list_append(handler_ctx);
+    if (!button)
+        return;
 
     strncpy(button->name, description->file_name, sizeof(button->name) - 1);
     button->name[sizeof(button->name) - 1] = '\0';
 
+    // Both extensions are 4 chars long.
     size_t len = strlen(button->name);
-    if (len >= 4 && strcmp(button->name + len - 4, ".raw") == 0)
+    if (len >= 4)
         button->name[len - 4] = '\0';
+}
+
+/*
+ * Buttons plus what a learn leaves behind: "<button>.raw.<n>" presses and
+ * the ".invalid<n>" captures that failed validation.
+ */
+static bool is_capture_file_name(const char *name)
+{
+    if (name[0] == '.' || file_has_extension(name, ".tmp"))
+        return false;
+
+    return ir_signal_is_file_name(name) || strstr(name, IR_SIGNAL_EXT_RAW ".") != NULL;
+}
+
+static void handle_capture_filelist(const file_desc *description, void *obj_target)
+{
+    buttons_handler_ctx *handler_ctx = (buttons_handler_ctx *)obj_target;
+    if (!handler_ctx || !handler_ctx->list || !handler_ctx->list->buttons || !description)
+        return;
+
+    if (!description->is_file || !is_capture_file_name(description->file_name))
+        return;
+
+    ir_button *button = button_list_append(handler_ctx);
+    if (button)
+        snprintf(button->name, sizeof(button->name), "%s", description->file_name);
+}
 
-    handler_ctx->list->count++;
+static int compare_button_names(const void *a, const void *b)
+{
+    return strcmp(((const ir_button *)a)->name, ((const ir_button *)b)->name);
 }
 
 static ir_status_t create_remote_directory(const char *remote_name, char *out_sanitized_name,
@@ -204,31 +319,55 @@ ir_status_t ir_controller_init(const ir_remote_ctx *remote_ctx)
         free(remote_context.remotes_root);
         remote_context.remotes_root = NULL;
     }
+    free(remote_context.macros_root);
 
     memset(&remote_context, 0, sizeof(ir_remote_ctx));
 
     if (duplicate_string(remote_ctx->remotes_root, &remote_context.remotes_root) != 0)
         return IR_ERR_IO;
 
+    // Optional: without it only the macro calls fail.
+    if (!zv_is_empty(remote_ctx->macros_root) &&
+        duplicate_string(remote_ctx->macros_root, &remote_context.macros_root) != 0)
+        remote_context.macros_root = NULL;
+
     remote_context.ir_ctx = remote_ctx->ir_ctx;
+    remote_context.learn_presses = remote_ctx->learn_presses;
 
     ir_status_t service_success = ir_service_init(&remote_context.ir_ctx);
     if (service_success != IR_OK) 
     {
         free(remote_context.remotes_root);
         remote_context.remotes_root = NULL;
+        free(remote_context.macros_root);
+        remote_context.macros_root = NULL;
         return service_success;
     }
+
+    ir_remote_catalog_init(remote_context.remotes_root);
     
     return IR_OK;
 }
 
 void ir_controller_deinit(void)
 {
+    import_stop();
+    watch_stop();
+    ir_controller_learn_cancel();
+    learn_join();
+    ir_controller_macro_cancel();
+    macro_join();
+    ir_controller_monitor_stop();
+    ir_signal_cache_clear();
+    ir_remote_catalog_deinit();
+    memset(&selected, 0, sizeof(selected));
+    ir_service_deinit();
+
     if (remote_context.remotes_root) {
         free(remote_context.remotes_root);
         remote_context.remotes_root = NULL;
     }
+    free(remote_context.macros_root);
 
     memset(&remote_context, 0, sizeof(remote_context));
 }
@@ -278,6 +417,7 @@ ir_status_t ir_controller_create_remote(const char *remote_name)
             return IR_ERR_IO;
     }
 
+    ir_remote_catalog_touch(remote_name_sanitize);
     return IR_OK;
 }
 
@@ -290,24 +430,23 @@ ir_status_t ir_controller_list_remotes(ir_remote_list *out_list)
         return IR_ERR_CONFIG;
     
     memset(out_list, 0, sizeof(*out_list));
-    out_list->remotes = (ir_remote_info *) calloc (DEFAULT_LIST_AMOUNT, sizeof(ir_remote_info));
+
+    size_t count = 0;
+    const ir_catalog_remote *remotes = ir_remote_catalog_get(&count);
+
+    out_list->remotes = (ir_remote_info *) calloc (count > DEFAULT_LIST_AMOUNT ? count : DEFAULT_LIST_AMOUNT,
+                                                   sizeof(ir_remote_info));
     if (!out_list->remotes)
         return IR_ERR_IO;
 
-    remotes_handler_ctx handler_ctx;
-    memset(&handler_ctx, 0, sizeof(handler_ctx));
-    handler_ctx.capacity = DEFAULT_LIST_AMOUNT;
-    handler_ctx.list = out_list;
-
-    get_file_list(remote_context.remotes_root, handle_file_list, &handler_ctx);
-    if (handler_ctx.has_error != 0) 
+    for (size_t i = 0; i < count; i++)
     {
-        free(out_list->remotes);
-        out_list->remotes = NULL;
-        out_list->count = 0;
-        
-        return IR_ERR_IO;
+        ir_remote_info *remote = &out_list->remotes[i];
+        snprintf(remote->name, sizeof(remote->name), "%s", remotes[i].name);
+        snprintf(remote->label, sizeof(remote->label), "%s", remotes[i].label);
+        remote->button_count = remotes[i].button_count;
     }
+    out_list->count = count;
 
     return IR_OK;
 }
@@ -380,7 +519,194 @@ ir_status_t ir_controller_list_buttons(const char *remote_name, ir_button_list *
     return IR_OK;
 }
 
-ir_status_t ir_controller_learn_button(const char *remote_name, const char *button_name)
+static void learn_report(bool report, ir_learn_event_type type, int attempt, int pulses, ir_status_t status)
+{
+    if (!report)
+        return;
+
+    unsigned int head = learn_job.head;
+    unsigned int tail = __atomic_load_n(&learn_job.tail, __ATOMIC_ACQUIRE);
+    if (head - tail >= IR_LEARN_EVENT_RING)
+        return;
+
+    ir_learn_event *ev = &learn_job.events[head & (IR_LEARN_EVENT_RING - 1)];
+    memset(ev, 0, sizeof(*ev));
+    ev->type = type;
+    ev->attempt = attempt;
+    ev->max_attempts = IR_LEARN_MAX_ATTEMPTS;
+    ev->press = learn_job.press;
+    ev->presses = learn_job.presses;
+    ev->pulses = pulses;
+    ev->status = status;
+    if (type == IR_LEARN_EV_DONE && status != IR_OK)
+        snprintf(ev->message, sizeof(ev->message), "%s", last_error());
+    else if (type == IR_LEARN_EV_DONE && learn_job.protocol != IR_PROTO_NONE)
+        snprintf(ev->message, sizeof(ev->message), "%s", ir_protocol_name(learn_job.protocol));
+
+    __atomic_store_n(&learn_job.head, head + 1, __ATOMIC_RELEASE);
+}
+
+/*
+ * Reads the capture once; an odd capture is repaired in memory and written
+ * back only when the repaired text validates.
+ */
+static bool validate_capture(const char *raw_path, int *token_count)
+{
+    long sz = 0;
+    int last_sign = 0;
+    char *buf = read_file_as_buffer(raw_path, &sz);
+    if (!buf || sz <= 0) {
+        free(buf);
+        return false;
+    }
+
+    bool valid = ir_validate_raw_capture_text(buf, token_count, &last_sign);
+    if (!valid) {
+        size_t patched_len = 0;
+        char *patched = ir_patch_odd_capture_text(buf, (size_t)sz, *token_count, last_sign, &patched_len);
+        int fixed_tokens = 0;
+        int fixed_last_sign = 0;
+
+        if (patched && ir_validate_raw_capture_text(patched, &fixed_tokens, &fixed_last_sign) &&
+            write_entire_file(raw_path, patched, patched_len) == 0) {
+            *token_count = fixed_tokens;
+            valid = true;
+        }
+        free(patched);
+    }
+
+    free(buf);
+    return valid;
+}
+
+/*
+ * Stores a learned signal as a header-only .irb when it decodes to a known
+ * protocol, as a full .irb when it was merged from several presses (the
+ * repeat count needs the binary header), or leaves the .raw ir-ctl wrote.
+ * The unused .raw/.irb of the button is removed so it cannot shadow the new one.
+ */
+static ir_status_t store_learned(const char *raw_path, ir_signal *signal, bool keep_raw, uint16_t *protocol)
+{
+    *protocol = IR_PROTO_NONE;
+
+    char irb_path[PATH_MAX];
+    size_t base_len = strlen(raw_path) - strlen(IR_SIGNAL_EXT_RAW);
+    if (snprintf(irb_path, sizeof(irb_path), "%.*s%s", (int)base_len, raw_path, IR_SIGNAL_EXT_BIN) >= (int)sizeof(irb_path))
+        return IR_ERR_INVALID;
+
+    ir_decoded code;
+    int repeats = 0;
+    bool decoded = ir_protocol_decode_signal(signal, &code, &repeats);
+    if (decoded) {
+        signal->protocol = code.protocol;
+        signal->address = code.address;
+        signal->command = code.command;
+        signal->repeats = (uint8_t)repeats;
+    }
+
+    if ((decoded || !keep_raw) && ir_signal_save_binary(irb_path, signal) == 0) {
+        remove(raw_path);
+        if (decoded) {
+            *protocol = code.protocol;
+            log_info("[IR][controller]::store_learned %s: %s address=0x%X command=0x%X repeats=%d",
+                     irb_path, ir_protocol_name(code.protocol), code.address, code.command, repeats);
+        }
+        return IR_OK;
+    }
+
+    remove(irb_path);
+    if (keep_raw)
+        return IR_OK;
+
+    set_last_error("Could not store the signal");
+    return IR_ERR_IO;
+}
+
+// One valid capture into `capture_path`, retried up to IR_LEARN_MAX_ATTEMPTS times.
+static ir_status_t capture_press(const char *capture_path, bool report)
+{
+    ir_status_t rc = IR_ERR_IO;
+    for (int attempt = 1; attempt <= IR_LEARN_MAX_ATTEMPTS; attempt++)
+    {
+        char invalid_path[PATH_MAX];
+        int token_count = 0;
+
+        if (attempt > 1)
+            learn_report(report, IR_LEARN_EV_RETRY, attempt - 1, 0, rc);
+        learn_report(report, IR_LEARN_EV_WAITING, attempt, 0, IR_OK);
+
+        rc = ir_learn_raw(capture_path);
+        if (rc == IR_ERR_CANCELED)
+            return rc;
+        if (rc != IR_OK)
+            continue;
+
+        learn_report(report, IR_LEARN_EV_VALIDATING, attempt, 0, IR_OK);
+        if (validate_capture(capture_path, &token_count)) {
+            learn_report(report, IR_LEARN_EV_CAPTURED, attempt, (token_count + 1) / 2, IR_OK);
+            return IR_OK;
+        }
+
+        learn_report(report, IR_LEARN_EV_CAPTURED, attempt, (token_count + 1) / 2, IR_ERR_INVALID);
+        set_last_error("Capture too short or malformed");
+        rc = IR_ERR_INVALID;
+
+        if (snprintf(invalid_path, sizeof(invalid_path), "%s.invalid%d", capture_path, attempt) > 0 &&
+            strnlen(invalid_path, sizeof(invalid_path)) < sizeof(invalid_path)) {
+            if (rename(capture_path, invalid_path) != 0) {
+                (void)errno;
+            }
+        }
+    }
+
+    return rc;
+}
+
+/*
+ * Several presses captured to "<button>.raw.<n>" and merged: jitter is
+ * averaged out and a press with glued or missing frames is outvoted.
+ */
+static ir_status_t learn_merged(const char *raw_path, int presses, bool report)
+{
+    ir_signal captures[IR_CAPTURE_MAX_PRESSES];
+    int captured = 0;
+    ir_status_t rc = IR_OK;
+
+    for (int press = 1; press <= presses && rc == IR_OK; press++)
+    {
+        char capture_path[PATH_MAX];
+        if (snprintf(capture_path, sizeof(capture_path), "%s.%d", raw_path, press) >= (int)sizeof(capture_path))
+            return IR_ERR_INVALID;
+
+        learn_job.press = press;
+        rc = capture_press(capture_path, report);
+        if (rc == IR_OK) {
+            if (ir_signal_load(capture_path, &captures[captured]) == 0)
+                captured++;
+            else
+                rc = IR_ERR_IO;
+        }
+        remove(capture_path);
+    }
+
+    ir_signal merged;
+    if (rc == IR_OK && ir_capture_merge(captures, captured, &merged) != 0) {
+        set_last_error("The presses did not match");
+        rc = IR_ERR_INVALID;
+    }
+
+    for (int i = 0; i < captured; i++)
+        ir_signal_free(&captures[i]);
+
+    if (rc != IR_OK)
+        return rc;
+
+    rc = store_learned(raw_path, &merged, false, &learn_job.protocol);
+    ir_signal_free(&merged);
+    return rc;
+}
+
+static ir_status_t learn_button_run(const char *remote_name, const char *button_name, bool report)
 {
     if (zv_is_empty(remote_name) || zv_is_empty(button_name))
         return IR_ERR_INVALID;
@@ -421,39 +747,68 @@ ir_status_t ir_controller_learn_button(const char *remote_name, const char *butt
     if (ret < 0)
         return IR_ERR_INVALID;
 
-    ir_status_t rc = IR_ERR_IO;
-    for (int attempt = 1; attempt <= IR_LEARN_MAX_ATTEMPTS; attempt++)
-    {
-        char invalid_path[PATH_MAX];
-        int token_count = 0;
-        int last_sign = 0;
-
-        rc = ir_learn_raw(raw_path);
-        if (rc != IR_OK)
-            continue;
+    int presses = remote_context.learn_presses;
+    if (presses > IR_CAPTURE_MAX_PRESSES)
+        presses = IR_CAPTURE_MAX_PRESSES;
 
-        if (ir_validate_raw_capture_file(raw_path, &token_count, &last_sign))
-            return IR_OK;
+    learn_job.protocol = IR_PROTO_NONE;
+    learn_job.press = 1;
+    learn_job.presses = presses > 1 ? presses : 1;
+    if (presses > 1)
+        return learn_merged(raw_path, presses, report);
 
-        if (ir_append_synthetic_gap_for_odd_capture(raw_path, token_count, last_sign)) {
-            int fixed_tokens = 0;
-            int fixed_last_sign = 0;
-            if (ir_validate_raw_capture_file(raw_path, &fixed_tokens, &fixed_last_sign))
-                return IR_OK;
-        }
+    ir_status_t rc = capture_press(raw_path, report);
+    if (rc != IR_OK)
+        return rc;
 
-        if (snprintf(invalid_path, sizeof(invalid_path), "%s.invalid%d", raw_path, attempt) > 0 &&
-            strnlen(invalid_path, sizeof(invalid_path)) < sizeof(invalid_path)) {
-            if (rename(raw_path, invalid_path) != 0) {
-                (void)errno;
-            }
-        }
+    ir_signal capture;
+    if (ir_signal_load(raw_path, &capture) == 0) {
+        store_learned(raw_path, &capture, true, &learn_job.protocol);
+        ir_signal_free(&capture);
     }
 
+    return IR_OK;
+}
+
+// The catalog is UI-thread only, so an async learn updates it when DONE is polled.
+static void catalog_touch_remote(const char *remote_name)
+{
+    char remote_name_sanitize[IR_MAX_NAME];
+    if (zv_sanitize_name(remote_name, remote_name_sanitize, sizeof(remote_name_sanitize)))
+        ir_remote_catalog_touch(remote_name_sanitize);
+}
+
+ir_status_t ir_controller_learn_button(const char *remote_name, const char *button_name)
+{
+    ir_status_t rc = learn_button_run(remote_name, button_name, false);
+    if (rc == IR_OK)
+        catalog_touch_remote(remote_name);
+
     return rc;
 }
 
-ir_status_t ir_controller_send_button(const char *remote_name, const char *button_name)
+static void *learn_worker_main(void *arg)
+{
+    (void)arg;
+
+    ir_status_t rc = learn_button_run(learn_job.remote, learn_job.button, true);
+    learn_report(true, IR_LEARN_EV_DONE, 0, 0, rc);
+    log_debug("[IR][controller]::learn_worker_main done rc=%d", (int)rc);
+
+    __atomic_store_n(&learn_job.finished, true, __ATOMIC_RELEASE);
+    return NULL;
+}
+
+static void learn_join(void)
+{
+    if (!learn_job.started)
+        return;
+
+    pthread_join(learn_job.thread, NULL);
+    learn_job.started = false;
+}
+
+ir_status_t ir_controller_learn_button_async(const char *remote_name, const char *button_name)
 {
     if (zv_is_empty(remote_name) || zv_is_empty(button_name))
         return IR_ERR_INVALID;
@@ -461,66 +816,1183 @@ ir_status_t ir_controller_send_button(const char *remote_name, const char *butto
     if (remote_context.remotes_root == NULL)
         return IR_ERR_CONFIG;
 
-    char remote_name_sanitize[IR_MAX_NAME];
-    char button_name_sanitize[IR_MAX_NAME];
-    if (!zv_sanitize_name(remote_name, remote_name_sanitize, sizeof(remote_name_sanitize)) ||
-        zv_has_whitespace(remote_name)) {
+    if (ir_controller_learn_busy())
+    {
+        set_last_error("A capture is already running");
         return IR_ERR_INVALID;
     }
-    if (!zv_sanitize_name(button_name, button_name_sanitize, sizeof(button_name_sanitize)) ||
-        zv_has_whitespace(button_name)) {
+
+    if (monitor_job.started)
+    {
+        set_last_error("Stop the IR monitor first");
         return IR_ERR_INVALID;
     }
 
-    char remote_directory[PATH_MAX];
-    int ret = create_directory_path(remote_context.remotes_root,
-        remote_name_sanitize, remote_directory, sizeof(remote_directory));
-    if (ret < 0)
-        return IR_ERR_INVALID;
+    learn_join();
 
-    char buttons_directory[PATH_MAX];
-    ret = create_directory_path(remote_directory, "buttons",
-        buttons_directory, sizeof(buttons_directory));
-    if (ret < 0)
-        return IR_ERR_INVALID;
+    snprintf(learn_job.remote, sizeof(learn_job.remote), "%s", remote_name);
+    snprintf(learn_job.button, sizeof(learn_job.button), "%s", button_name);
+    learn_job.head = learn_job.tail = 0;
+    learn_job.finished = false;
+    ir_learn_reset();
 
-    char button_raw_name[IR_MAX_NAME];
-    int n = snprintf(button_raw_name, sizeof(button_raw_name), "%s.raw", button_name_sanitize);
-    if (n < 0 || (size_t)n >= sizeof(button_raw_name))
-        return IR_ERR_INVALID;
+    if (pthread_create(&learn_job.thread, NULL, learn_worker_main, NULL) != 0)
+    {
+        set_last_error("Can't start the capture");
+        log_error("[IR][controller]::ir_controller_learn_button_async pthread_create failed");
+        return IR_ERR_IO;
+    }
 
-    char raw_path[PATH_MAX];
-    ret = create_file_path(buttons_directory, button_raw_name, raw_path, sizeof(raw_path));
-    if (ret < 0)
-        return IR_ERR_INVALID;
+    learn_job.started = true;
+    return IR_OK;
+}
 
-    if (access(raw_path, R_OK) != 0)
-        return IR_ERR_IO;
+bool ir_controller_learn_poll(ir_learn_event *out)
+{
+    unsigned int tail = learn_job.tail;
+    if (!out || tail == __atomic_load_n(&learn_job.head, __ATOMIC_ACQUIRE))
+        return false;
 
-    return ir_send_raw(raw_path);
+    *out = learn_job.events[tail & (IR_LEARN_EVENT_RING - 1)];
+    __atomic_store_n(&learn_job.tail, tail + 1, __ATOMIC_RELEASE);
+
+    if (out->type == IR_LEARN_EV_DONE) {
+        learn_join();
+        if (out->status == IR_OK)
+            catalog_touch_remote(learn_job.remote);
+    }
+
+    return true;
 }
 
-const char *ir_controller_last_error(void)
+void ir_controller_learn_cancel(void)
 {
-    return last_error();
+    if (ir_controller_learn_busy())
+        ir_learn_cancel();
 }
 
-void ir_controller_free_remote_list(ir_remote_list *list)
+bool ir_controller_learn_busy(void)
 {
-    if (!list)
-        return;
+    return learn_job.started && !__atomic_load_n(&learn_job.finished, __ATOMIC_ACQUIRE);
+}
 
-    free(list->remotes);
-    list->remotes = NULL;
-    list->count = 0;
+static int remote_buttons_dir(const char *remote_name, char *out, size_t out_sz)
+{
+    char remote_name_sanitize[IR_MAX_NAME];
+    if (!zv_sanitize_name(remote_name, remote_name_sanitize, sizeof(remote_name_sanitize)) ||
+        zv_has_whitespace(remote_name)) {
+        return -1;
+    }
+
+    char remote_directory[PATH_MAX];
+    if (create_directory_path(remote_context.remotes_root,
+        remote_name_sanitize, remote_directory, sizeof(remote_directory)) < 0)
+        return -1;
+
+    return create_directory_path(remote_directory, "buttons", out, out_sz);
 }
 
-void ir_controller_free_button_list(ir_button_list *list)
+ir_status_t ir_controller_select_remote(const char *remote_name)
 {
-    if (!list)
-        return;
+    if (zv_is_empty(remote_name))
+        return IR_ERR_INVALID;
 
-    free(list->buttons);
-    list->buttons = NULL;
+    if (remote_context.remotes_root == NULL)
+        return IR_ERR_CONFIG;
+
+    char buttons_directory[PATH_MAX];
+    if (remote_buttons_dir(remote_name, buttons_directory, sizeof(buttons_directory)) < 0)
+        return IR_ERR_INVALID;
+
+    snprintf(selected.remote, sizeof(selected.remote), "%s", remote_name);
+    snprintf(selected.buttons_dir, sizeof(selected.buttons_dir), "%s", buttons_directory);
+    ir_signal_cache_preload(selected.buttons_dir);
+
+    return IR_OK;
+}
+
+ir_status_t ir_controller_list_captures(const char *remote_name, ir_button_list *out_list)
+{
+    if (!out_list || zv_is_empty(remote_name))
+        return IR_ERR_INVALID;
+
+    if (remote_context.remotes_root == NULL)
+        return IR_ERR_CONFIG;
+
+    memset(out_list, 0, sizeof(*out_list));
+
+    char buttons_directory[PATH_MAX];
+    if (remote_buttons_dir(remote_name, buttons_directory, sizeof(buttons_directory)) < 0)
+        return IR_ERR_INVALID;
+
+    out_list->buttons = (ir_button *)calloc(DEFAULT_LIST_AMOUNT, sizeof(ir_button));
+    if (!out_list->buttons)
+        return IR_ERR_IO;
+
+    buttons_handler_ctx handler_ctx;
+    memset(&handler_ctx, 0, sizeof(handler_ctx));
+    handler_ctx.capacity = DEFAULT_LIST_AMOUNT;
+    handler_ctx.list = out_list;
+
+    // Not ir_list_raw_files_cb(): it only passes button files.
+    if (!file_is_directory(buttons_directory))
+    {
+        ir_controller_free_button_list(out_list);
+        set_last_error("Directory not found");
+        return IR_ERR_IO;
+    }
+
+    get_file_list(buttons_directory, handle_capture_filelist, &handler_ctx);
+    if (handler_ctx.has_error != 0)
+    {
+        ir_controller_free_button_list(out_list);
+        return IR_ERR_IO;
+    }
+
+    qsort(out_list->buttons, out_list->count, sizeof(ir_button), compare_button_names);
+    return IR_OK;
+}
+
+ir_status_t ir_controller_load_capture(const char *remote_name, const char *file_name, ir_signal *out)
+{
+    if (!out || zv_is_empty(remote_name) || zv_is_empty(file_name))
+        return IR_ERR_INVALID;
+
+    if (remote_context.remotes_root == NULL)
+        return IR_ERR_CONFIG;
+
+    // Names come from ir_controller_list_captures(); anything else stays out of buttons/.
+    char buttons_directory[PATH_MAX];
+    char capture_path[PATH_MAX];
+    if (strchr(file_name, '/') || !is_capture_file_name(file_name) ||
+        remote_buttons_dir(remote_name, buttons_directory, sizeof(buttons_directory)) < 0 ||
+        create_file_path(buttons_directory, file_name, capture_path, sizeof(capture_path)) < 0)
+        return IR_ERR_INVALID;
+
+    // Not the signal cache: leftovers are read once and would only evict the buttons.
+    if (ir_signal_load(capture_path, out) != 0)
+    {
+        set_last_error("Capture is empty or unreadable");
+        return IR_ERR_INVALID;
+    }
+
+    return IR_OK;
+}
+
+// Converted buttons (.irb) first, then ir-ctl captures (.raw). Served from the signal cache.
+static ir_status_t button_signal(const char *remote_name, const char *button_name, const ir_signal **out,
+                                 char *raw_path, size_t raw_path_sz)
+{
+    char button_name_sanitize[IR_MAX_NAME];
+    if (!zv_sanitize_name(button_name, button_name_sanitize, sizeof(button_name_sanitize)) ||
+        zv_has_whitespace(button_name)) {
+        return IR_ERR_INVALID;
+    }
+
+    // The selected remote already has its directory resolved.
+    char buttons_directory[PATH_MAX];
+    if (selected.remote[0] && strcmp(selected.remote, remote_name) == 0)
+        snprintf(buttons_directory, sizeof(buttons_directory), "%s", selected.buttons_dir);
+    else if (remote_buttons_dir(remote_name, buttons_directory, sizeof(buttons_directory)) < 0)
+        return IR_ERR_INVALID;
+
+    const char *extensions[] = { IR_SIGNAL_EXT_BIN, IR_SIGNAL_EXT_RAW };
+    *out = NULL;
+    for (size_t i = 0; i < sizeof(extensions) / sizeof(extensions[0]) && !*out; i++) {
+        char button_raw_name[IR_MAX_NAME];
+        int n = snprintf(button_raw_name, sizeof(button_raw_name), "%s%s", button_name_sanitize, extensions[i]);
+        if (n < 0 || (size_t)n >= sizeof(button_raw_name))
+            return IR_ERR_INVALID;
+
+        if (create_file_path(buttons_directory, button_raw_name, raw_path, raw_path_sz) < 0)
+            return IR_ERR_INVALID;
+
+        *out = ir_signal_cache_get(raw_path);
+    }
+
+    if (!*out) {
+        set_last_error("Button signal missing or invalid");
+        return IR_ERR_IO;
+    }
+
+    return IR_OK;
+}
+
+ir_status_t ir_controller_send_button(const char *remote_name, const char *button_name)
+{
+    if (zv_is_empty(remote_name) || zv_is_empty(button_name))
+        return IR_ERR_INVALID;
+
+    if (remote_context.remotes_root == NULL)
+        return IR_ERR_CONFIG;
+
+    // The macro thread owns the transmitter until it is done.
+    if (ir_controller_macro_busy()) {
+        set_last_error("A macro is running");
+        return IR_ERR_INVALID;
+    }
+
+    const ir_signal *signal = NULL;
+    char raw_path[PATH_MAX];
+    ir_status_t rc = button_signal(remote_name, button_name, &signal, raw_path, sizeof(raw_path));
+    if (rc != IR_OK)
+        return rc;
+
+    return ir_send_signal(signal, raw_path);
+}
+
+static const ir_signal *macro_lookup(const char *remote, const char *button, void *user_data)
+{
+    (void)user_data;
+
+    const ir_signal *signal = NULL;
+    char raw_path[PATH_MAX];
+    return button_signal(remote, button, &signal, raw_path, sizeof(raw_path)) == IR_OK ? signal : NULL;
+}
+
+static void handle_macro_filelist(const file_desc *description, void *obj_target)
+{
+    ir_macro_list *list = (ir_macro_list *)obj_target;
+    if (!description->is_file || !file_has_extension(description->file_name, IR_MACRO_EXT) ||
+        list->count >= IR_MACRO_MAX_FILES)
+        return;
+
+    size_t base_len = strlen(description->file_name) - strlen(IR_MACRO_EXT);
+    if (base_len == 0 || base_len >= IR_MAX_NAME)
+        return;
+
+    snprintf(list->macros[list->count].name, IR_MAX_NAME, "%.*s", (int)base_len, description->file_name);
+    list->count++;
+}
+
+static int compare_macro_names(const void *a, const void *b)
+{
+    return strcmp(((const ir_macro_info *)a)->name, ((const ir_macro_info *)b)->name);
+}
+
+ir_status_t ir_controller_list_macros(ir_macro_list *out_list)
+{
+    if (!out_list)
+        return IR_ERR_INVALID;
+
+    memset(out_list, 0, sizeof(*out_list));
+    if (remote_context.macros_root == NULL)
+        return IR_ERR_CONFIG;
+
+    out_list->macros = (ir_macro_info *)calloc(IR_MACRO_MAX_FILES, sizeof(ir_macro_info));
+    if (!out_list->macros)
+        return IR_ERR_IO;
+
+    if (file_is_directory(remote_context.macros_root))
+        get_file_list(remote_context.macros_root, handle_macro_filelist, out_list);
+
+    qsort(out_list->macros, out_list->count, sizeof(ir_macro_info), compare_macro_names);
+    return IR_OK;
+}
+
+static void *macro_worker_main(void *arg)
+{
+    (void)arg;
+
+    ir_macro_result *result = &macro_job.result;
+    result->status = ir_send_frames(macro_job.plan.frames, macro_job.plan.count, &macro_job.cancel,
+                                    &result->max_late_us);
+    result->frames = macro_job.plan.count;
+    if (result->status != IR_OK)
+        snprintf(result->message, sizeof(result->message), "%s", last_error());
+
+    log_debug("[IR][controller]::macro_worker_main %s rc=%d frames=%d max_late_us=%d", macro_job.name,
+              (int)result->status, result->frames, result->max_late_us);
+
+    __atomic_store_n(&macro_job.finished, true, __ATOMIC_RELEASE);
+    return NULL;
+}
+
+static void macro_join(void)
+{
+    if (!macro_job.started)
+        return;
+
+    pthread_join(macro_job.thread, NULL);
+    macro_job.started = false;
+    ir_macro_plan_free(&macro_job.plan);
+}
+
+ir_status_t ir_controller_run_macro_async(const char *macro_name)
+{
+    if (zv_is_empty(macro_name))
+        return IR_ERR_INVALID;
+
+    if (remote_context.remotes_root == NULL || remote_context.macros_root == NULL)
+        return IR_ERR_CONFIG;
+
+    if (ir_controller_macro_busy())
+    {
+        set_last_error("A macro is already running");
+        return IR_ERR_INVALID;
+    }
+
+    macro_join();
+
+    char macro_name_sanitize[IR_MAX_NAME];
+    char file_name[IR_MAX_NAME];
+    char macro_path[PATH_MAX];
+    if (!zv_sanitize_name(macro_name, macro_name_sanitize, sizeof(macro_name_sanitize)) ||
+        zv_has_whitespace(macro_name) ||
+        snprintf(file_name, sizeof(file_name), "%s%s", macro_name_sanitize, IR_MACRO_EXT) >= (int)sizeof(file_name) ||
+        create_file_path(remote_context.macros_root, file_name, macro_path, sizeof(macro_path)) < 0)
+        return IR_ERR_INVALID;
+
+    // Everything is resolved here, on the UI thread: the worker only sleeps and writes.
+    ir_macro macro;
+    if (ir_macro_load(macro_path, &macro) != 0)
+        return IR_ERR_INVALID;
+
+    int rc = ir_macro_plan_build(&macro, macro_lookup, NULL, &macro_job.plan);
+    ir_macro_free(&macro);
+    if (rc != 0)
+        return IR_ERR_INVALID;
+
+    snprintf(macro_job.name, sizeof(macro_job.name), "%s", macro_name_sanitize);
+    memset(&macro_job.result, 0, sizeof(macro_job.result));
+    macro_job.finished = false;
+    macro_job.cancel = false;
+
+    if (pthread_create(&macro_job.thread, NULL, macro_worker_main, NULL) != 0)
+    {
+        ir_macro_plan_free(&macro_job.plan);
+        set_last_error("Can't start the macro");
+        log_error("[IR][controller]::ir_controller_run_macro_async pthread_create failed");
+        return IR_ERR_IO;
+    }
+
+    macro_job.started = true;
+    return IR_OK;
+}
+
+bool ir_controller_macro_poll(ir_macro_result *out)
+{
+    if (!out || !macro_job.started || !__atomic_load_n(&macro_job.finished, __ATOMIC_ACQUIRE))
+        return false;
+
+    *out = macro_job.result;
+    macro_join();
+    return true;
+}
+
+void ir_controller_macro_cancel(void)
+{
+    if (ir_controller_macro_busy())
+        __atomic_store_n(&macro_job.cancel, true, __ATOMIC_RELEASE);
+}
+
+bool ir_controller_macro_busy(void)
+{
+    return macro_job.started && !__atomic_load_n(&macro_job.finished, __ATOMIC_ACQUIRE);
+}
+
+static void monitor_frame(const uint32_t *durations, int count, uint32_t gap_us, void *user_data)
+{
+    (void)user_data;
+
+    unsigned int seq = monitor_job.received;
+    __atomic_store_n(&monitor_job.received, seq + 1, __ATOMIC_RELAXED);
+
+    ir_decoded code;
+    if (!ir_protocol_decode(durations, count, &code))
+        memset(&code, 0, sizeof(code));
+
+    // Decoding runs before the ring check so `repeat` stays right across drops.
+    bool close_to_last = monitor_job.last_gap_us > 0 && monitor_job.last_gap_us < IR_MONITOR_REPEAT_GAP_US;
+    bool repeat = close_to_last && monitor_job.last.protocol != IR_PROTO_NONE &&
+                  (code.protocol == IR_PROTO_NONE ? count == IR_MONITOR_REPEAT_COUNT
+                                                  : memcmp(&code, &monitor_job.last, sizeof(code)) == 0);
+    if (!repeat || code.protocol != IR_PROTO_NONE)
+        monitor_job.last = code;
+    monitor_job.last_gap_us = gap_us;
+
+    unsigned int head = monitor_job.head;
+    if (head - __atomic_load_n(&monitor_job.tail, __ATOMIC_ACQUIRE) == IR_MONITOR_RING)
+    {
+        __atomic_store_n(&monitor_job.dropped, monitor_job.dropped + 1, __ATOMIC_RELAXED);
+        return;
+    }
+
+    ir_monitor_frame *frame = &monitor_job.frames[head & (IR_MONITOR_RING - 1)];
+    memset(frame, 0, sizeof(*frame));
+    frame->seq = seq;
+    frame->protocol = code.protocol;
+    frame->address = code.address;
+    frame->command = code.command;
+    frame->repeat = repeat;
+    frame->count = count;
+    frame->gap_us = gap_us;
+    frame->min_pulse_us = UINT32_MAX;
+
+    for (int i = 0; i < count; i++)
+    {
+        frame->duration_us += durations[i];
+        if (i % 2 != 0)
+            continue;
+
+        if (durations[i] < frame->min_pulse_us)
+            frame->min_pulse_us = durations[i];
+        if (durations[i] > frame->max_pulse_us)
+            frame->max_pulse_us = durations[i];
+    }
+
+    __atomic_store_n(&monitor_job.head, head + 1, __ATOMIC_RELEASE);
+}
+
+static void *monitor_worker_main(void *arg)
+{
+    (void)arg;
+
+    ir_status_t rc = ir_monitor_run(monitor_frame, NULL);
+    monitor_job.status = rc;
+    if (rc != IR_OK)
+        snprintf(monitor_job.message, sizeof(monitor_job.message), "%s", last_error());
+
+    log_debug("[IR][controller]::monitor_worker_main rc=%d frames=%u dropped=%u", (int)rc,
+              monitor_job.received, monitor_job.dropped);
+
+    __atomic_store_n(&monitor_job.finished, true, __ATOMIC_RELEASE);
+    return NULL;
+}
+
+static void monitor_join(void)
+{
+    if (!monitor_job.started)
+        return;
+
+    pthread_join(monitor_job.thread, NULL);
+    monitor_job.started = false;
+}
+
+ir_status_t ir_controller_monitor_start(void)
+{
+    if (remote_context.remotes_root == NULL)
+        return IR_ERR_CONFIG;
+
+    if (monitor_job.started && !__atomic_load_n(&monitor_job.finished, __ATOMIC_ACQUIRE))
+        return IR_OK;
+
+    monitor_join();
+
+    if (ir_controller_learn_busy())
+    {
+        set_last_error("A capture is already running");
+        return IR_ERR_INVALID;
+    }
+
+    learn_join();
+
+    // Counters and the queue start over; the page shows this run only.
+    memset(&monitor_job, 0, sizeof(monitor_job));
+    ir_monitor_reset();
+
+    if (pthread_create(&monitor_job.thread, NULL, monitor_worker_main, NULL) != 0)
+    {
+        set_last_error("Can't start the IR monitor");
+        log_error("[IR][controller]::ir_controller_monitor_start pthread_create failed");
+        return IR_ERR_IO;
+    }
+
+    monitor_job.started = true;
+    return IR_OK;
+}
+
+void ir_controller_monitor_stop(void)
+{
+    if (!monitor_job.started)
+        return;
+
+    ir_monitor_stop();
+    monitor_join();
+}
+
+bool ir_controller_monitor_poll(ir_monitor_frame *out)
+{
+    unsigned int tail = monitor_job.tail;
+    if (!out || tail == __atomic_load_n(&monitor_job.head, __ATOMIC_ACQUIRE))
+        return false;
+
+    *out = monitor_job.frames[tail & (IR_MONITOR_RING - 1)];
+    __atomic_store_n(&monitor_job.tail, tail + 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+bool ir_controller_monitor_busy(void)
+{
+    return monitor_job.started && !__atomic_load_n(&monitor_job.finished, __ATOMIC_ACQUIRE);
+}
+
+void ir_controller_monitor_stats(ir_monitor_stats *out)
+{
+    if (!out)
+        return;
+
+    // A reader that failed on its own is joined here; its queued frames stay readable.
+    if (monitor_job.started && __atomic_load_n(&monitor_job.finished, __ATOMIC_ACQUIRE))
+        monitor_join();
+
+    memset(out, 0, sizeof(*out));
+    out->running = monitor_job.started;
+    out->frames = __atomic_load_n(&monitor_job.received, __ATOMIC_RELAXED);
+    out->dropped = __atomic_load_n(&monitor_job.dropped, __ATOMIC_RELAXED);
+    if (!monitor_job.started)
+    {
+        out->status = monitor_job.status;
+        snprintf(out->message, sizeof(out->message), "%s", monitor_job.message);
+    }
+}
+
+static void watch_notify(const ir_watch_event *event)
+{
+    for (int i = 0; i < IR_WATCH_MAX_LISTENERS; i++)
+    {
+        if (watch.listeners[i].cb)
+            watch.listeners[i].cb(event, watch.listeners[i].user_data);
+    }
+}
+
+static bool watch_fill_remote(const char *remote_name, ir_watch_event *event)
+{
+    ir_catalog_remote remote;
+    if (!ir_remote_catalog_find(remote_name, &remote))
+        return false;
+
+    snprintf(event->remote.name, sizeof(event->remote.name), "%s", remote.name);
+    snprintf(event->remote.label, sizeof(event->remote.label), "%s", remote.label);
+    event->remote.button_count = remote.button_count;
+    return true;
+}
+
+// `name` in buttons/ without extension, and whether the other signal file still backs it.
+static bool watch_button_name(const char *buttons_dir, const char *file_name, char *out, size_t out_sz,
+                              bool *other_exists)
+{
+    const char *ext = file_has_extension(file_name, IR_SIGNAL_EXT_BIN) ? IR_SIGNAL_EXT_BIN : IR_SIGNAL_EXT_RAW;
+    const char *other = strcmp(ext, IR_SIGNAL_EXT_BIN) == 0 ? IR_SIGNAL_EXT_RAW : IR_SIGNAL_EXT_BIN;
+    size_t base_len = strlen(file_name) - strlen(ext);
+    if (base_len == 0 || base_len >= out_sz)
+        return false;
+
+    snprintf(out, out_sz, "%.*s", (int)base_len, file_name);
+
+    char other_path[PATH_MAX];
+    *other_exists = snprintf(other_path, sizeof(other_path), "%s/%s%s", buttons_dir, out, other) <
+                    (int)sizeof(other_path) && access(other_path, F_OK) == 0;
+    return true;
+}
+
+// UI thread, import running: remembers which remote a skipped watch event was about, NULL if none.
+static void import_note_event(const char *remote_name)
+{
+    if (!remote_name)
+    {
+        import_job.events_dropped = true;
+        return;
+    }
+
+    for (int i = 0; i < import_job.dropped_count; i++)
+    {
+        if (strcmp(import_job.dropped_remotes[i], remote_name) == 0)
+            return;
+    }
+
+    if (import_job.dropped_count == IR_IMPORT_RESYNC_REMOTES)
+    {
+        import_job.events_dropped = true;
+        return;
+    }
+
+    snprintf(import_job.dropped_remotes[import_job.dropped_count++], IR_MAX_NAME, "%s", remote_name);
+}
+
+static void watch_fs_event(const fs_watch_event *fs_event, void *user_data)
+{
+    (void)user_data;
+
+    ir_watch_event event;
+    memset(&event, 0, sizeof(event));
+
+    if (fs_event->type == FS_WATCH_OVERFLOW)
+    {
+        if (import_job.started)
+        {
+            import_note_event(NULL);
+            return;
+        }
+
+        event.type = IR_WATCH_RESYNC;
+        watch_notify(&event);
+        return;
+    }
+
+    // Which level of the tree: "" for the root, "<remote>" or "<remote>/buttons".
+    size_t root_len = strlen(remote_context.remotes_root);
+    while (root_len > 1 && remote_context.remotes_root[root_len - 1] == '/')
+        root_len--;
+    if (strncmp(fs_event->dir, remote_context.remotes_root, root_len) != 0 ||
+        (fs_event->dir[root_len] != '\0' && fs_event->dir[root_len] != '/'))
+        return;
+
+    const char *rel = fs_event->dir + root_len;
+    if (*rel == '/')
+        rel++;
+
+    if (fs_event->name[0] == '.')
+        return;
+
+    // An import writes thousands of files; it reports its remotes once when polled as finished.
+    if (import_job.started)
+    {
+        const char *name = *rel ? rel : fs_event->name;
+        const char *slash = strchr(name, '/');
+        size_t name_len = slash ? (size_t)(slash - name) : strlen(name);
+        char remote_name[IR_MAX_NAME];
+        snprintf(remote_name, sizeof(remote_name), "%.*s", (int)name_len, name);
+        import_note_event(remote_name);
+        return;
+    }
+
+    if (!*rel)
+    {
+        // The catalog index and anything else that is not a remote directory.
+        if (!fs_event->is_dir || fs_event->type == FS_WATCH_MODIFIED)
+            return;
+
+        snprintf(event.remote.name, sizeof(event.remote.name), "%s", fs_event->name);
+        if (fs_event->type == FS_WATCH_ADDED)
+        {
+            ir_remote_catalog_touch(fs_event->name);
+            if (!watch_fill_remote(fs_event->name, &event))
+                return;
+            event.type = IR_WATCH_REMOTE_ADDED;
+        }
+        else
+        {
+            ir_remote_catalog_forget(fs_event->name);
+            event.type = IR_WATCH_REMOTE_REMOVED;
+        }
+
+        watch_notify(&event);
+        return;
+    }
+
+    char remote_name[IR_MAX_NAME];
+    const char *slash = strchr(rel, '/');
+    size_t name_len = slash ? (size_t)(slash - rel) : strlen(rel);
+    if (name_len >= sizeof(remote_name))
+        return;
+    snprintf(remote_name, sizeof(remote_name), "%.*s", (int)name_len, rel);
+
+    // A remote the catalog never saw (or just forgot) is announced by the root event.
+    ir_catalog_remote known;
+    if (!ir_remote_catalog_find(remote_name, &known))
+        return;
+
+    if (!slash)
+    {
+        if (strcmp(fs_event->name, "meta.json") != 0 && strcmp(fs_event->name, "buttons") != 0)
+            return;
+
+        ir_remote_catalog_touch(remote_name);
+        if (!watch_fill_remote(remote_name, &event))
+            return;
+        event.type = IR_WATCH_REMOTE_CHANGED;
+        watch_notify(&event);
+        return;
+    }
+
+    if (strcmp(slash + 1, "buttons") != 0 || fs_event->is_dir || fs_event->type == FS_WATCH_MODIFIED ||
+        !ir_signal_is_file_name(fs_event->name))
+        return;
+
+    bool other_exists = false;
+    if (!watch_button_name(fs_event->dir, fs_event->name, event.button, sizeof(event.button), &other_exists))
+        return;
+
+    ir_remote_catalog_touch(remote_name);
+    if (!watch_fill_remote(remote_name, &event))
+        return;
+
+    // A button converted next to its .raw (or losing one of the two) is still one button.
+    if (other_exists)
+        event.type = IR_WATCH_REMOTE_CHANGED;
+    else
+        event.type = fs_event->type == FS_WATCH_ADDED ? IR_WATCH_BUTTON_ADDED : IR_WATCH_BUTTON_REMOVED;
+
+    log_debug("[IR][controller]::watch_fs_event %s/%s type=%d", remote_name, fs_event->name, (int)event.type);
+    watch_notify(&event);
+}
+
+static void watch_stop(void)
+{
+    if (watch.fs_handle >= 0)
+        fs_watch_remove(watch.fs_handle);
+
+    memset(&watch, 0, sizeof(watch));
+    watch.fs_handle = -1;
+}
+
+int ir_controller_watch(ir_watch_cb cb, void *user_data)
+{
+    if (!cb || remote_context.remotes_root == NULL)
+        return -1;
+
+    for (int i = 0; i < IR_WATCH_MAX_LISTENERS; i++)
+    {
+        if (watch.listeners[i].cb)
+            continue;
+
+        if (watch.fs_handle < 0)
+        {
+            watch.fs_handle = fs_watch_add(remote_context.remotes_root, 2, watch_fs_event, NULL);
+            if (watch.fs_handle < 0)
+                return -1;
+        }
+
+        watch.listeners[i].cb = cb;
+        watch.listeners[i].user_data = user_data;
+        return i;
+    }
+
+    log_warning("[IR][controller]::ir_controller_watch no free listener");
+    return -1;
+}
+
+void ir_controller_unwatch(int handle)
+{
+    if (handle < 0 || handle >= IR_WATCH_MAX_LISTENERS)
+        return;
+
+    watch.listeners[handle].cb = NULL;
+    watch.listeners[handle].user_data = NULL;
+
+    for (int i = 0; i < IR_WATCH_MAX_LISTENERS; i++)
+    {
+        if (watch.listeners[i].cb)
+            return;
+    }
+
+    watch_stop();
+}
+
+// Whitespace to '_' first: controller paths reject it, and library names are full of it.
+static bool import_name(const char *src, char *out, size_t out_sz)
+{
+    char spaced[IR_MAX_NAME];
+    snprintf(spaced, sizeof(spaced), "%s", src);
+    for (char *c = spaced; *c; c++)
+    {
+        if (isspace((unsigned char)*c))
+            *c = '_';
+    }
+
+    return zv_sanitize_name(spaced, out, out_sz);
+}
+
+static void import_set_message(const char *fmt, const char *arg)
+{
+    pthread_mutex_lock(&import_lock);
+    snprintf(import_job.progress.message, sizeof(import_job.progress.message), fmt, arg);
+    pthread_mutex_unlock(&import_lock);
+}
+
+static bool import_write_meta(const char *remote_dir, const char *label)
+{
+    char meta_path[PATH_MAX];
+    if (create_file_path(remote_dir, "meta.json", meta_path, sizeof(meta_path)) < 0)
+        return false;
+
+    cJSON *meta = cJSON_CreateObject();
+    if (!meta)
+        return false;
+
+    cJSON_AddStringToObject(meta, "name", label);
+    char *printed = cJSON_Print(meta);
+    bool ok = printed && write_entire_file(meta_path, printed, strlen(printed)) == 0;
+
+    cJSON_free(printed);
+    cJSON_Delete(meta);
+    return ok;
+}
+
+// The remote a button goes to, created with its meta.json on first use.
+static import_remote *import_remote_for(const char *library_name)
+{
+    char name[IR_MAX_NAME];
+    if (!import_name(library_name, name, sizeof(name)))
+        return NULL;
+
+    if (import_job.current < import_job.remote_count &&
+        strcmp(import_job.remotes[import_job.current].info.name, name) == 0)
+        return &import_job.remotes[import_job.current];
+
+    char remote_dir[PATH_MAX];
+    if (create_directory_path(remote_context.remotes_root, name, remote_dir, sizeof(remote_dir)) < 0)
+        return NULL;
+
+    size_t index = 0;
+    while (index < import_job.remote_count && strcmp(import_job.remotes[index].info.name, name) != 0)
+        index++;
+
+    if (index == import_job.remote_count)
+    {
+        if (import_job.remote_count == import_job.remote_capacity)
+        {
+            size_t new_capacity = import_job.remote_capacity ? import_job.remote_capacity * 2 : 16;
+            import_remote *grown = (import_remote *)realloc(import_job.remotes, new_capacity * sizeof(import_remote));
+            if (!grown)
+                return NULL;
+
+            import_job.remotes = grown;
+            import_job.remote_capacity = new_capacity;
+        }
+
+        bool existed = file_is_directory(remote_dir);
+        if (file_ensure_dir_recursive(remote_dir) != 0 || (!existed && !import_write_meta(remote_dir, library_name)))
+            return NULL;
+
+        import_remote *remote = &import_job.remotes[import_job.remote_count++];
+        memset(remote, 0, sizeof(*remote));
+        snprintf(remote->info.name, sizeof(remote->info.name), "%s", name);
+        snprintf(remote->info.label, sizeof(remote->info.label), "%s", library_name);
+        remote->existed = existed;
+    }
+
+    if (create_buttons_directory(remote_dir, import_job.buttons_dir, sizeof(import_job.buttons_dir)) != IR_OK)
+        return NULL;
+
+    import_job.current = index;
+    return &import_job.remotes[index];
+}
+
+static bool import_store_button(const ir_import_entry *entry, void *user_data)
+{
+    (void)user_data;
+
+    if (__atomic_load_n(&import_job.cancel, __ATOMIC_ACQUIRE))
+        return false;
+
+    import_remote *remote = import_remote_for(entry->remote);
+    char button[IR_MAX_NAME];
+    char irb_path[PATH_MAX];
+    char raw_path[PATH_MAX];
+    if (!remote || !import_name(entry->button, button, sizeof(button)) ||
+        snprintf(irb_path, sizeof(irb_path), "%s/%s%s", import_job.buttons_dir, button, IR_SIGNAL_EXT_BIN) >=
+            (int)sizeof(irb_path) ||
+        snprintf(raw_path, sizeof(raw_path), "%s/%s%s", import_job.buttons_dir, button, IR_SIGNAL_EXT_RAW) >=
+            (int)sizeof(raw_path))
+    {
+        import_job.failed++;
+    }
+    else if (access(irb_path, F_OK) == 0 || access(raw_path, F_OK) == 0)
+    {
+        // A learned .raw would be shadowed by the .irb, and a same-named library button overwritten.
+        import_job.existing++;
+    }
+    else if (ir_signal_save_binary(irb_path, entry->signal) != 0)
+        import_job.failed++;
+    else
+        remote->info.button_count++;
+
+    pthread_mutex_lock(&import_lock);
+    import_job.progress.bytes_done = import_job.file_offset + entry->offset;
+    import_job.progress.remotes = (int)import_job.remote_count;
+    import_job.progress.buttons = import_job.stats.buttons - import_job.failed - import_job.existing;
+    import_job.progress.skipped = import_job.stats.skipped + import_job.failed;
+    import_job.progress.existing = import_job.existing;
+    pthread_mutex_unlock(&import_lock);
+    return true;
+}
+
+static void import_count_file(const char *path, long size)
+{
+    (void)path;
+
+    pthread_mutex_lock(&import_lock);
+    import_job.progress.files_total++;
+    import_job.progress.bytes_total += size;
+    pthread_mutex_unlock(&import_lock);
+}
+
+static void import_read_file(const char *path, long size)
+{
+    const char *base = strrchr(path, '/');
+    import_set_message("Reading %s", base ? base + 1 : path);
+
+    if (ir_import_file(path, import_store_button, NULL, &import_job.stats, &import_job.cancel) != 0)
+        log_warning("[IR][controller]::import_read_file can't read %s", path);
+
+    import_job.file_offset += size;
+    pthread_mutex_lock(&import_lock);
+    import_job.progress.files++;
+    import_job.progress.bytes_done = import_job.file_offset;
+    import_job.progress.buttons = import_job.stats.buttons - import_job.failed - import_job.existing;
+    import_job.progress.skipped = import_job.stats.skipped + import_job.failed;
+    import_job.progress.existing = import_job.existing;
+    pthread_mutex_unlock(&import_lock);
+}
+
+// Walked twice, to size the progress and then to import, so no file list is kept.
+static void import_walk(const char *dir_path, int depth, void (*fn)(const char *path, long size))
+{
+    DIR *dir = opendir(dir_path);
+    if (!dir)
+        return;
+
+    struct dirent *ent;
+    while (!__atomic_load_n(&import_job.cancel, __ATOMIC_ACQUIRE) && (ent = readdir(dir)) != NULL)
+    {
+        if (ent->d_name[0] == '.')
+            continue;
+
+        char path[PATH_MAX];
+        struct stat st;
+        if (snprintf(path, sizeof(path), "%s/%s", dir_path, ent->d_name) >= (int)sizeof(path) || stat(path, &st) != 0)
+            continue;
+
+        if (S_ISDIR(st.st_mode) && depth < IR_IMPORT_MAX_DEPTH)
+            import_walk(path, depth + 1, fn);
+        else if (S_ISREG(st.st_mode) && ir_import_is_library_file(ent->d_name))
+            fn(path, (long)st.st_size);
+    }
+
+    closedir(dir);
+}
+
+static void *import_worker_main(void *arg)
+{
+    (void)arg;
+
+    struct stat st;
+    if (stat(import_job.path, &st) == 0 && S_ISDIR(st.st_mode))
+    {
+        import_walk(import_job.path, 0, import_count_file);
+        import_walk(import_job.path, 0, import_read_file);
+    }
+    else if (stat(import_job.path, &st) == 0 && ir_import_is_library_file(import_job.path))
+    {
+        import_count_file(import_job.path, (long)st.st_size);
+        import_read_file(import_job.path, (long)st.st_size);
+    }
+
+    pthread_mutex_lock(&import_lock);
+    ir_import_progress *p = &import_job.progress;
+    if (__atomic_load_n(&import_job.cancel, __ATOMIC_ACQUIRE))
+    {
+        p->status = IR_ERR_CANCELED;
+        snprintf(p->message, sizeof(p->message), "Canceled, %d buttons written", p->buttons);
+    }
+    else if (p->files_total == 0)
+    {
+        p->status = IR_ERR_INVALID;
+        snprintf(p->message, sizeof(p->message), "No %s or %s files found", IR_IMPORT_EXT_LIRCD, IR_IMPORT_EXT_FLIPPER);
+    }
+    else
+    {
+        p->status = IR_OK;
+        snprintf(p->message, sizeof(p->message), "%d buttons in %d remotes, %d skipped, %d already there",
+                 p->buttons, p->remotes, p->skipped, p->existing);
+    }
+    p->finished = true;
+    pthread_mutex_unlock(&import_lock);
+
+    log_info("[IR][controller]::import_worker_main %s: %s", import_job.path, import_job.progress.message);
+    __atomic_store_n(&import_job.finished, true, __ATOMIC_RELEASE);
+    return NULL;
+}
+
+static void import_join(void)
+{
+    if (!import_job.started)
+        return;
+
+    pthread_join(import_job.thread, NULL);
+    import_job.started = false;
+}
+
+static void import_release(void)
+{
+    free(import_job.remotes);
+    import_job.remotes = NULL;
+    import_job.remote_count = 0;
+    import_job.remote_capacity = 0;
+}
+
+// Whether a watch event skipped during the import was about a remote the import did not touch.
+static bool import_missed_events(void)
+{
+    if (import_job.events_dropped)
+        return true;
+
+    for (int i = 0; i < import_job.dropped_count; i++)
+    {
+        size_t k = 0;
+        while (k < import_job.remote_count && strcmp(import_job.remotes[k].info.name, import_job.dropped_remotes[i]) != 0)
+            k++;
+        if (k == import_job.remote_count)
+            return true;
+    }
+
+    return false;
+}
+
+// UI thread, after the join: new remotes go into the catalog as one batch, no rescan.
+static void import_publish(void)
+{
+    ir_catalog_remote *fresh = (ir_catalog_remote *)malloc((import_job.remote_count + 1) * sizeof(ir_catalog_remote));
+    size_t fresh_count = 0;
+    for (size_t i = 0; i < import_job.remote_count; i++)
+    {
+        if (!import_job.remotes[i].existed && fresh)
+            fresh[fresh_count++] = import_job.remotes[i].info;
+        else
+            ir_remote_catalog_touch(import_job.remotes[i].info.name);
+    }
+    ir_remote_catalog_store(fresh, fresh_count);
+    free(fresh);
+
+    ir_watch_event event;
+    memset(&event, 0, sizeof(event));
+    bool missed = import_missed_events();
+    import_job.dropped_count = 0;
+    import_job.events_dropped = false;
+    if (missed || import_job.remote_count > IR_IMPORT_RESYNC_REMOTES)
+    {
+        event.type = IR_WATCH_RESYNC;
+        watch_notify(&event);
+        return;
+    }
+
+    for (size_t i = 0; i < import_job.remote_count; i++)
+    {
+        if (!watch_fill_remote(import_job.remotes[i].info.name, &event))
+            continue;
+
+        event.type = import_job.remotes[i].existed ? IR_WATCH_REMOTE_CHANGED : IR_WATCH_REMOTE_ADDED;
+        watch_notify(&event);
+    }
+}
+
+// Deinit: the catalog and the listeners are going away, nothing is published.
+static void import_stop(void)
+{
+    __atomic_store_n(&import_job.cancel, true, __ATOMIC_RELEASE);
+    import_join();
+    import_release();
+}
+
+ir_status_t ir_controller_import_async(const char *path)
+{
+    if (zv_is_empty(path))
+        return IR_ERR_INVALID;
+
+    if (remote_context.remotes_root == NULL)
+        return IR_ERR_CONFIG;
+
+    if (ir_controller_import_busy())
+    {
+        set_last_error("An import is already running");
+        return IR_ERR_INVALID;
+    }
+
+    // Finished with nobody polling, e.g. canceled as its page went away.
+    if (import_job.started)
+    {
+        import_join();
+        import_publish();
+    }
+
+    if (access(path, R_OK) != 0)
+    {
+        set_last_error("Import path not found");
+        return IR_ERR_INVALID;
+    }
+
+    import_release();
+    memset(&import_job, 0, sizeof(import_job));
+    snprintf(import_job.path, sizeof(import_job.path), "%s", path);
+    normalize_dir_path(import_job.path);
+
+    if (pthread_create(&import_job.thread, NULL, import_worker_main, NULL) != 0)
+    {
+        set_last_error("Can't start the import");
+        log_error("[IR][controller]::ir_controller_import_async pthread_create failed");
+        return IR_ERR_IO;
+    }
+
+    import_job.started = true;
+    return IR_OK;
+}
+
+bool ir_controller_import_poll(ir_import_progress *out)
+{
+    if (!out || !import_job.started)
+        return false;
+
+    pthread_mutex_lock(&import_lock);
+    *out = import_job.progress;
+    pthread_mutex_unlock(&import_lock);
+
+    if (out->finished)
+    {
+        import_join();
+        import_publish();
+        import_release();
+    }
+
+    return true;
+}
+
+// Only raises the flag: the worker stops within a word and the next poll joins it.
+void ir_controller_import_cancel(void)
+{
+    if (!import_job.started)
+        return;
+
+    __atomic_store_n(&import_job.cancel, true, __ATOMIC_RELEASE);
+}
+
+bool ir_controller_import_busy(void)
+{
+    return import_job.started && !__atomic_load_n(&import_job.finished, __ATOMIC_ACQUIRE);
+}
+
+const char *ir_controller_last_error(void)
+{
+    return last_error();
+}
+
+void ir_controller_free_remote_list(ir_remote_list *list)
+{
+    if (!list)
+        return;
+
+    free(list->remotes);
+    list->remotes = NULL;
+    list->count = 0;
+}
+
+void ir_controller_free_button_list(ir_button_list *list)
+{
+    if (!list)
+        return;
+
+    free(list->buttons);
+    list->buttons = NULL;
+    list->count = 0;
+}
+
+void ir_controller_free_macro_list(ir_macro_list *list)
+{
+    if (!list)
+        return;
+
+    free(list->macros);
+    list->macros = NULL;
     list->count = 0;
 }
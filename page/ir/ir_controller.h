@@ -3,18 +3,23 @@
 
 #include "service/ir_service.h"
 
+#include <stdbool.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
 typedef struct {
     char *remotes_root;
+    char *macros_root;          // ir.macros_path, NULL disables macros
     ir_context ir_ctx;
+    int learn_presses;          // captures merged into one learned button, 1 keeps the first valid one
 } ir_remote_ctx;
 
 // Remote control definition
 typedef struct {
-    char name[IR_MAX_NAME];
+    char name[IR_MAX_NAME];     // directory name, what the other calls take
+    char label[IR_MAX_NAME];    // "name" from meta.json
     int button_count;
 } ir_remote_info;
 
@@ -32,15 +37,184 @@ typedef struct {
     size_t count;
 } ir_button_list;
 
+// Progress of an asynchronous learn, in the order the worker reports it.
+typedef enum {
+    IR_LEARN_EV_WAITING,        // attempt `attempt` is waiting for the remote
+    IR_LEARN_EV_CAPTURED,       // `pulses` pulses captured
+    IR_LEARN_EV_VALIDATING,
+    IR_LEARN_EV_RETRY,          // attempt `attempt` failed, another one follows
+    IR_LEARN_EV_DONE            // final `status`; `message` is the error, or the decoded protocol
+} ir_learn_event_type;
+
+typedef struct {
+    ir_learn_event_type type;
+    int attempt;
+    int max_attempts;
+    int press;                  // 1-based, of `presses` when ir.learn_presses > 1
+    int presses;
+    int pulses;
+    ir_status_t status;
+    char message[128];
+} ir_learn_event;
+
+// Changes under remotes_root seen by the filesystem watch (service/fs_watch.h).
+typedef enum {
+    IR_WATCH_REMOTE_ADDED,
+    IR_WATCH_REMOTE_REMOVED,    // only `remote.name` is set
+    IR_WATCH_REMOTE_CHANGED,    // label or button count moved
+    IR_WATCH_BUTTON_ADDED,      // `button` is the name without extension
+    IR_WATCH_BUTTON_REMOVED,
+    IR_WATCH_RESYNC             // events were lost, list everything again
+} ir_watch_event_type;
+
+typedef struct {
+    ir_watch_event_type type;
+    ir_remote_info remote;
+    char button[IR_MAX_NAME];
+} ir_watch_event;
+
+typedef void (*ir_watch_cb)(const ir_watch_event *event, void *user_data);
+
+typedef struct {
+    char name[IR_MAX_NAME];     // file name in macros_root without ".json"
+} ir_macro_info;
+
+typedef struct {
+    ir_macro_info *macros;
+    size_t count;
+} ir_macro_list;
+
+typedef struct {
+    ir_status_t status;
+    int frames;
+    int max_late_us;            // worst wake-up delay of the timing thread
+    char message[128];          // the error when `status` is not IR_OK
+} ir_macro_result;
+
+// Snapshot of a library import (service/ir_import.h), see ir_controller_import_poll().
+typedef struct {
+    long bytes_done;
+    long bytes_total;
+    int files;                  // library files read so far
+    int files_total;
+    int remotes;                // remotes created or extended
+    int buttons;
+    int skipped;
+    int existing;               // a button of that name was already there and was kept
+    bool finished;
+    ir_status_t status;         // meaningful once `finished`
+    char message[128];          // the file being read, then a summary or the error
+} ir_import_progress;
+
+// One frame seen by the monitor, see ir_controller_monitor_poll().
+typedef struct {
+    unsigned int seq;           // counts every frame received, dropped ones included
+    uint16_t protocol;          // IR_PROTO_NONE when it did not decode
+    uint32_t address;
+    uint32_t command;
+    bool repeat;                // same code, or a short repeat burst, right after the previous frame
+    int count;                  // pulses and spaces
+    uint32_t duration_us;       // first pulse to last pulse
+    uint32_t gap_us;            // silence after the frame, 0 when it was cut at the buffer size
+    uint32_t min_pulse_us;
+    uint32_t max_pulse_us;
+} ir_monitor_frame;
+
+typedef struct {
+    bool running;
+    unsigned int frames;        // received since ir_controller_monitor_start()
+    unsigned int dropped;       // lost because the queue was full
+    ir_status_t status;         // why the monitor stopped on its own
+    char message[128];
+} ir_monitor_stats;
+
 ir_status_t ir_controller_init(const ir_remote_ctx *remote_ctx);
 void ir_controller_deinit(void);
 ir_status_t ir_controller_create_remote(const char *remote_name);
+// Served from the remote catalog (ir_remote_catalog.h), not a directory walk.
 ir_status_t ir_controller_list_remotes(ir_remote_list *out_list);
 ir_status_t ir_controller_list_buttons(const char *remote_name, ir_button_list *out);
 ir_status_t ir_controller_learn_button(const char *remote_name, const char *button_name);
+
+/*
+ * Runs ir_controller_learn_button() on a worker thread. Progress is queued
+ * and read on the UI thread with ir_controller_learn_poll(); the last event
+ * is always IR_LEARN_EV_DONE.
+ */
+ir_status_t ir_controller_learn_button_async(const char *remote_name, const char *button_name);
+bool ir_controller_learn_poll(ir_learn_event *out);
+void ir_controller_learn_cancel(void);
+bool ir_controller_learn_busy(void);
+/*
+ * Imports a lircd.conf / Flipper .ir file, or every one found under a
+ * directory, into remotes_root on a worker thread. Buttons are written as
+ * .irb, never over a button that already exists, and the catalog is
+ * updated in one go when the import ends.
+ */
+ir_status_t ir_controller_import_async(const char *path);
+/*
+ * Copies the latest progress. Returns false when no import is running;
+ * the call that returns `finished` joins the worker, updates the catalog
+ * and notifies the watch listeners.
+ */
+bool ir_controller_import_poll(ir_import_progress *out);
+/*
+ * Asks the worker to stop and returns at once; it notices within one word
+ * of the file. Keep polling: the poll that reports `finished` publishes the
+ * buttons written so far, as for a finished import.
+ */
+void ir_controller_import_cancel(void);
+bool ir_controller_import_busy(void);
+// Preloads the parsed signals of `remote_name` for ir_controller_send_button().
+ir_status_t ir_controller_select_remote(const char *remote_name);
 ir_status_t ir_controller_send_button(const char *remote_name, const char *button_name);
+
+/*
+ * Every signal file in the remote's buttons/, learn leftovers included
+ * (".raw.<n>", ".invalid<n>"), as file names with their extension.
+ */
+ir_status_t ir_controller_list_captures(const char *remote_name, ir_button_list *out);
+// Loads one of those files; release `out` with ir_signal_free().
+ir_status_t ir_controller_load_capture(const char *remote_name, const char *file_name, ir_signal *out);
+
+// Macro files (page/ir/ir_macro.h) in macros_root, sorted by name.
+ir_status_t ir_controller_list_macros(ir_macro_list *out_list);
+
+/*
+ * Resolves every step and builds all the frames on the calling thread,
+ * then sends them on a timing thread at their monotonic deadlines. Needs
+ * the lircdev backend. ir_controller_send_button() fails while it runs.
+ */
+ir_status_t ir_controller_run_macro_async(const char *macro_name);
+// True once, with the result, after the macro ended.
+bool ir_controller_macro_poll(ir_macro_result *out);
+void ir_controller_macro_cancel(void);
+bool ir_controller_macro_busy(void);
+
+/*
+ * Listens continuously on rx_dev (lircdev backend) on a reader thread that
+ * decodes every frame and queues it for ir_controller_monitor_poll(). When
+ * the UI falls behind frames are dropped and counted; the reader never
+ * waits. Learning is refused while the monitor runs, and the other way round.
+ */
+ir_status_t ir_controller_monitor_start(void);
+void ir_controller_monitor_stop(void);
+bool ir_controller_monitor_busy(void);
+// Oldest queued frame first.
+bool ir_controller_monitor_poll(ir_monitor_frame *out);
+void ir_controller_monitor_stats(ir_monitor_stats *out);
+
+/*
+ * Live updates for pages listing remotes or buttons, delivered on the UI
+ * thread. The catalog is already updated when the callback runs. Returns a
+ * handle for ir_controller_unwatch(), or -1 when watching is unavailable.
+ */
+int ir_controller_watch(ir_watch_cb cb, void *user_data);
+void ir_controller_unwatch(int handle);
+
 void ir_controller_free_remote_list(ir_remote_list *list);
 void ir_controller_free_button_list(ir_button_list *list);
+void ir_controller_free_macro_list(ir_macro_list *list);
 const char *ir_controller_last_error(void);
 
 #ifdef __cplusplus
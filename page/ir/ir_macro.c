@@ -0,0 +1,203 @@
+#include "page/ir/ir_macro.h"
+#include "utils/error_handler.h"
+#include "utils/file.h"
+#include "utils/logger.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MACRO_MAX_REPEAT    20
+#define MACRO_MAX_DELAY_MS  60000
+#define MACRO_FRAME_GAP_US  40000   // between sends of a button whose signal has no trailing gap
+
+// How one step turns into frames: the part sent, the silence after it, and how many sends.
+typedef struct {
+    int body;
+    uint32_t gap;
+    int frames;
+} step_shape;
+
+static void step_error(int index, const ir_macro_step *step, const char *what)
+{
+    char msg[160];
+    snprintf(msg, sizeof(msg), "Step %d (%.40s/%.40s): %s", index + 1, step->remote, step->button, what);
+    set_last_error(msg);
+}
+
+static int json_int_clamped(const cJSON *obj, const char *key, int max)
+{
+    const cJSON *item = cJSON_GetObjectItemCaseSensitive(obj, key);
+    if (!cJSON_IsNumber(item) || item->valueint < 0)
+        return 0;
+
+    return item->valueint > max ? max : item->valueint;
+}
+
+int ir_macro_load(const char *path, ir_macro *out)
+{
+    memset(out, 0, sizeof(*out));
+
+    cJSON *root = read_json_file(path);
+    if (!root)
+    {
+        set_last_error("Can't read the macro file");
+        return -1;
+    }
+
+    const cJSON *steps = cJSON_GetObjectItemCaseSensitive(root, "steps");
+    int count = cJSON_IsArray(steps) ? cJSON_GetArraySize(steps) : 0;
+    if (count <= 0 || count > IR_MACRO_MAX_STEPS)
+    {
+        cJSON_Delete(root);
+        set_last_error("A macro needs 1 to 64 steps");
+        return -1;
+    }
+
+    out->steps = (ir_macro_step *)calloc((size_t)count, sizeof(ir_macro_step));
+    if (!out->steps)
+    {
+        cJSON_Delete(root);
+        set_last_error("Out of memory");
+        return -1;
+    }
+
+    const cJSON *item;
+    cJSON_ArrayForEach(item, steps)
+    {
+        const cJSON *remote = cJSON_GetObjectItemCaseSensitive(item, "remote");
+        const cJSON *button = cJSON_GetObjectItemCaseSensitive(item, "button");
+        ir_macro_step *step = &out->steps[out->count];
+        if (!cJSON_IsString(remote) || !cJSON_IsString(button) ||
+            !remote->valuestring[0] || !button->valuestring[0])
+        {
+            step_error(out->count, step, "needs \"remote\" and \"button\"");
+            cJSON_Delete(root);
+            ir_macro_free(out);
+            return -1;
+        }
+
+        snprintf(step->remote, sizeof(step->remote), "%s", remote->valuestring);
+        snprintf(step->button, sizeof(step->button), "%s", button->valuestring);
+        step->repeat = json_int_clamped(item, "repeat", MACRO_MAX_REPEAT);
+        step->delay_ms = json_int_clamped(item, "delay_ms", MACRO_MAX_DELAY_MS);
+        out->count++;
+    }
+
+    cJSON_Delete(root);
+    return 0;
+}
+
+void ir_macro_free(ir_macro *macro)
+{
+    if (!macro)
+        return;
+
+    free(macro->steps);
+    macro->steps = NULL;
+    macro->count = 0;
+}
+
+// Signals ending in a space carry their frame gap, and only those can repeat (see ir_signal.h).
+static bool shape_of(const ir_signal *signal, const ir_macro_step *step, step_shape *out)
+{
+    if (!signal || signal->count <= 0 || !signal->durations)
+        return false;
+
+    bool has_gap = signal->count % 2 == 0;
+    out->body = has_gap ? signal->count - 1 : signal->count;
+    out->gap = has_gap ? signal->durations[signal->count - 1] : MACRO_FRAME_GAP_US;
+    out->frames = (step->repeat + 1) * (1 + (has_gap ? signal->repeats : 0));
+    return out->body > 0;
+}
+
+int ir_macro_plan_build(const ir_macro *macro, ir_macro_lookup lookup, void *user_data, ir_macro_plan *out)
+{
+    memset(out, 0, sizeof(*out));
+    if (!macro || macro->count <= 0 || !lookup)
+    {
+        set_last_error("Empty macro");
+        return -1;
+    }
+
+    // First pass sizes the buffers, so the second never reallocates under the frame pointers.
+    int frame_count = 0;
+    size_t pool_count = 0;
+    for (int i = 0; i < macro->count; i++)
+    {
+        step_shape shape;
+        if (!shape_of(lookup(macro->steps[i].remote, macro->steps[i].button, user_data), &macro->steps[i], &shape))
+        {
+            step_error(i, &macro->steps[i], "button missing or invalid");
+            return -1;
+        }
+
+        frame_count += shape.frames;
+        pool_count += (size_t)shape.body;
+    }
+
+    out->frames = (ir_frame *)calloc((size_t)frame_count, sizeof(ir_frame));
+    out->pool = (uint32_t *)malloc(pool_count * sizeof(uint32_t));
+    if (!out->frames || !out->pool)
+    {
+        ir_macro_plan_free(out);
+        set_last_error("Out of memory");
+        return -1;
+    }
+
+    // A button repeated by its step is copied once; its frames share the durations.
+    size_t used = 0;
+    uint64_t at = 0;
+    uint64_t end = 0;
+    for (int i = 0; i < macro->count; i++)
+    {
+        const ir_macro_step *step = &macro->steps[i];
+        const ir_signal *signal = lookup(step->remote, step->button, user_data);
+        step_shape shape;
+        if (!shape_of(signal, step, &shape) || out->count + shape.frames > frame_count ||
+            used + (size_t)shape.body > pool_count)
+        {
+            step_error(i, step, "changed while preparing");
+            ir_macro_plan_free(out);
+            return -1;
+        }
+
+        uint32_t *durations = out->pool + used;
+        memcpy(durations, signal->durations, (size_t)shape.body * sizeof(uint32_t));
+        used += (size_t)shape.body;
+
+        uint64_t body_us = 0;
+        for (int d = 0; d < shape.body; d++)
+            body_us += durations[d];
+
+        for (int f = 0; f < shape.frames; f++)
+        {
+            ir_frame *frame = &out->frames[out->count++];
+            frame->durations = durations;
+            frame->count = shape.body;
+            frame->carrier = signal->carrier;
+            frame->duty_cycle = signal->duty_cycle;
+            frame->at_us = at;
+
+            end = at + body_us;
+            at = end + shape.gap;
+        }
+
+        at = end + (step->delay_ms > 0 ? (uint64_t)step->delay_ms * 1000 : shape.gap);
+    }
+
+    out->total_us = end;
+    log_debug("[IR][macro]::ir_macro_plan_build steps=%d frames=%d durations=%zu total_ms=%llu",
+              macro->count, out->count, used, (unsigned long long)(end / 1000));
+    return 0;
+}
+
+void ir_macro_plan_free(ir_macro_plan *plan)
+{
+    if (!plan)
+        return;
+
+    free(plan->frames);
+    free(plan->pool);
+    memset(plan, 0, sizeof(*plan));
+}
@@ -0,0 +1,61 @@
+#ifndef IR_MACRO_H
+#define IR_MACRO_H
+
+#include "service/ir_service.h"
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define IR_MACRO_EXT        ".json"
+#define IR_MACRO_MAX_STEPS  64
+
+/*
+ * A macro file, in ir.macros_path:
+ *   { "steps": [ { "remote": "LG_TV", "button": "KEY_POWER",
+ *                  "repeat": 0, "delay_ms": 800 }, ... ] }
+ * `repeat` extra sends of the button; `delay_ms` of silence after the step
+ * before the next one starts (0 keeps the button's own frame gap).
+ */
+typedef struct {
+    char remote[IR_MAX_NAME];
+    char button[IR_MAX_NAME];
+    int repeat;
+    int delay_ms;
+} ir_macro_step;
+
+typedef struct {
+    ir_macro_step *steps;
+    int count;
+} ir_macro;
+
+// Returns 0, or -1 with last_error set. Release with ir_macro_free().
+int ir_macro_load(const char *path, ir_macro *out);
+void ir_macro_free(ir_macro *macro);
+
+// Resolves a step to its signal; the pointer only has to stay valid until the next call.
+typedef const ir_signal *(*ir_macro_lookup)(const char *remote, const char *button, void *user_data);
+
+/*
+ * Every frame of a macro with its send time, and one buffer holding the
+ * durations of all its buttons. Built up front so the timing thread only
+ * sleeps and writes.
+ */
+typedef struct {
+    ir_frame *frames;
+    int count;
+    uint32_t *pool;
+    uint64_t total_us;          // start of the first frame to the end of the last one
+} ir_macro_plan;
+
+// Returns 0, or -1 with last_error naming the step that failed.
+int ir_macro_plan_build(const ir_macro *macro, ir_macro_lookup lookup, void *user_data, ir_macro_plan *out);
+void ir_macro_plan_free(ir_macro_plan *plan);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* IR_MACRO_H */
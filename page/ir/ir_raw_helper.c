@@ -39,7 +39,8 @@
 #define IR_RAW_MIN_TOKENS 20
 
 /*
- * Validate a raw capture file produced by ir-ctl.
+ * Validate raw capture text produced by ir-ctl (the _file variant reads it
+ * from disk first).
  *
  * Expected token format: (+|-)<positive_integer> separated by whitespace.
  * Example: "+9000 -4500 +560 -560 ..."
@@ -54,27 +55,21 @@
  * - token_count_out: total parsed tokens.
  * - last_sign_out: sign of the last token (+1 or -1), used by repair flow.
  */
-int ir_validate_raw_capture_file(const char *raw_path, int *token_count_out, int *last_sign_out)
+int ir_validate_raw_capture_text(const char *text, int *token_count_out, int *last_sign_out)
 {
-    long sz = 0;
     int token_count = 0;
     int first_sign = 0;
     int last_sign = 0;
-    char *buf = read_file_as_buffer(raw_path, &sz);
-    char *p = NULL;
+    const char *p = text;
 
     if (token_count_out)
         *token_count_out = 0;
     if (last_sign_out)
         *last_sign_out = 0;
 
-    if (!buf || sz <= 0)
-    {
-        free(buf);
+    if (!text)
         return 0;
-    }
 
-    p = buf;
     while (*p) 
     {
         char *end = NULL;
@@ -87,7 +82,6 @@ int ir_validate_raw_capture_file(const char *raw_path, int *token_count_out, int
             break;
 
         if (*p != '+' && *p != '-') {
-            free(buf);
             return 0;
         }
 
@@ -98,13 +92,11 @@ int ir_validate_raw_capture_file(const char *raw_path, int *token_count_out, int
         p++;
 
         if (*p < '0' || *p > '9') {
-            free(buf);
             return 0;
         }
 
         value = strtol(p, &end, 10);
         if (end == p || value <= 0) {
-            free(buf);
             return 0;
         }
 
@@ -112,8 +104,6 @@ int ir_validate_raw_capture_file(const char *raw_path, int *token_count_out, int
         p = end;
     }
 
-    free(buf);
-
     if (token_count_out)
         *token_count_out = token_count;
     if (last_sign_out)
@@ -127,6 +117,26 @@ int ir_validate_raw_capture_file(const char *raw_path, int *token_count_out, int
     return 1;
 }
 
+int ir_validate_raw_capture_file(const char *raw_path, int *token_count_out, int *last_sign_out)
+{
+    long sz = 0;
+    char *buf = read_file_as_buffer(raw_path, &sz);
+
+    if (token_count_out)
+        *token_count_out = 0;
+    if (last_sign_out)
+        *last_sign_out = 0;
+
+    if (!buf || sz <= 0) {
+        free(buf);
+        return 0;
+    }
+
+    int rc = ir_validate_raw_capture_text(buf, token_count_out, last_sign_out);
+    free(buf);
+    return rc;
+}
+
 /*
  * Try to repair an odd raw capture by appending a synthetic trailing gap.
  *
@@ -139,22 +149,49 @@ int ir_validate_raw_capture_file(const char *raw_path, int *token_count_out, int
  * - token_count is odd
  * - last_sign is '+'
  *
- * Returns 1 on successful rewrite, 0 otherwise.
+ * ir_patch_odd_capture_text() returns the patched copy (caller frees) or
+ * NULL; ir_append_synthetic_gap_for_odd_capture() rewrites the file and
+ * returns 1 on success, 0 otherwise.
  */
-int ir_append_synthetic_gap_for_odd_capture(const char *raw_path, int token_count, int last_sign)
+char *ir_patch_odd_capture_text(const char *text, size_t len, int token_count, int last_sign,
+                                size_t *out_len)
 {
     const char *gap = " -20000\n";
+    size_t gap_len = strlen(gap);
+    size_t trimmed_len = len;
+    char *patched = NULL;
+
+    if (!text || len == 0)
+        return NULL;
+    if (token_count < IR_RAW_MIN_TOKENS || (token_count % 2) == 0 || last_sign <= 0)
+        return NULL;
+
+    while (trimmed_len > 0 && isspace((unsigned char)text[trimmed_len - 1]))
+        trimmed_len--;
+
+    patched = (char *)malloc(trimmed_len + gap_len + 1);
+    if (!patched)
+        return NULL;
+
+    memcpy(patched, text, trimmed_len);
+    memcpy(patched + trimmed_len, gap, gap_len);
+    patched[trimmed_len + gap_len] = '\0';
+
+    if (out_len)
+        *out_len = trimmed_len + gap_len;
+    return patched;
+}
+
+int ir_append_synthetic_gap_for_odd_capture(const char *raw_path, int token_count, int last_sign)
+{
     char *buf = NULL;
     char *patched = NULL;
     long sz = 0;
-    size_t gap_len = strlen(gap);
-    size_t trimmed_len = 0;
+    size_t patched_len = 0;
     int rc = 0;
 
     if (!raw_path || raw_path[0] == '\0')
         return 0;
-    if (token_count < IR_RAW_MIN_TOKENS || (token_count % 2) == 0 || last_sign <= 0)
-        return 0;
 
     buf = read_file_as_buffer(raw_path, &sz);
     if (!buf || sz <= 0) {
@@ -162,21 +199,13 @@ int ir_append_synthetic_gap_for_odd_capture(const char *raw_path, int token_coun
         return 0;
     }
 
-    trimmed_len = (size_t)sz;
-    while (trimmed_len > 0 && isspace((unsigned char)buf[trimmed_len - 1]))
-        trimmed_len--;
-
-    patched = (char *)malloc(trimmed_len + gap_len + 1);
+    patched = ir_patch_odd_capture_text(buf, (size_t)sz, token_count, last_sign, &patched_len);
     if (!patched) {
         free(buf);
         return 0;
     }
 
-    memcpy(patched, buf, trimmed_len);
-    memcpy(patched + trimmed_len, gap, gap_len);
-    patched[trimmed_len + gap_len] = '\0';
-
-    rc = write_entire_file(raw_path, patched, trimmed_len + gap_len);
+    rc = write_entire_file(raw_path, patched, patched_len);
 
     free(patched);
     free(buf);
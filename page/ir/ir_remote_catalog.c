@@ -0,0 +1,447 @@
+#include "page/ir/ir_remote_catalog.h"
+#include "service/ir_signal.h"
+#include "utils/file.h"
+#include "utils/logger.h"
+
+#include <dirent.h>
+#include <limits.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define CATALOG_VERSION 1
+
+typedef struct {
+    ir_catalog_remote info;
+    struct timespec dir_mtime;      // meta.json replaced, buttons/ created
+    struct timespec buttons_mtime;  // a button stored, removed or renamed
+    bool seen;                      // scratch for rescan_root()
+} catalog_entry;
+
+static struct {
+    char root[PATH_MAX];
+    char index_path[PATH_MAX];
+    struct timespec root_mtime;
+
+    catalog_entry *entries;
+    size_t count;
+    size_t capacity;
+
+    ir_catalog_remote *view;        // what ir_remote_catalog_get() hands out
+    size_t view_capacity;
+    bool dirty;                     // entries differ from the index file
+} catalog;
+
+static bool same_time(const struct timespec *a, const struct timespec *b)
+{
+    return a->tv_sec == b->tv_sec && a->tv_nsec == b->tv_nsec;
+}
+
+// Zero when the path is missing, so a deleted buttons/ also reads as a change.
+static void stat_mtime(const char *path, struct timespec *out)
+{
+    struct stat st;
+    if (stat(path, &st) == 0)
+        *out = st.st_mtim;
+    else
+        memset(out, 0, sizeof(*out));
+}
+
+static catalog_entry *find_entry(const char *name)
+{
+    for (size_t i = 0; i < catalog.count; i++)
+    {
+        if (strcmp(catalog.entries[i].info.name, name) == 0)
+            return &catalog.entries[i];
+    }
+
+    return NULL;
+}
+
+static catalog_entry *add_entry(const char *name)
+{
+    if (catalog.count == catalog.capacity)
+    {
+        size_t new_capacity = catalog.capacity ? catalog.capacity * 2 : 16;
+        catalog_entry *grown = (catalog_entry *)realloc(catalog.entries, new_capacity * sizeof(catalog_entry));
+        if (!grown)
+            return NULL;
+
+        catalog.entries = grown;
+        catalog.capacity = new_capacity;
+    }
+
+    catalog_entry *entry = &catalog.entries[catalog.count++];
+    memset(entry, 0, sizeof(*entry));
+    snprintf(entry->info.name, sizeof(entry->info.name), "%s", name);
+    snprintf(entry->info.label, sizeof(entry->info.label), "%s", name);
+    entry->seen = true;
+    return entry;
+}
+
+static void read_label(const char *remote_dir, catalog_entry *entry)
+{
+    snprintf(entry->info.label, sizeof(entry->info.label), "%s", entry->info.name);
+
+    char meta_path[PATH_MAX];
+    if (snprintf(meta_path, sizeof(meta_path), "%s/meta.json", remote_dir) >= (int)sizeof(meta_path))
+        return;
+
+    cJSON *meta = file_exists(meta_path) ? read_json_file(meta_path) : NULL;
+    if (!meta)
+        return;
+
+    cJSON *name = cJSON_GetObjectItemCaseSensitive(meta, "name");
+    if (cJSON_IsString(name) && name->valuestring && name->valuestring[0])
+        snprintf(entry->info.label, sizeof(entry->info.label), "%s", name->valuestring);
+
+    cJSON_Delete(meta);
+}
+
+// readdir() only; a .raw is stat'ed just to see whether a converted .irb shadows it.
+static int count_buttons(const char *buttons_dir)
+{
+    DIR *dir = opendir(buttons_dir);
+    if (!dir)
+        return 0;
+
+    int count = 0;
+    struct dirent *ent;
+    while ((ent = readdir(dir)) != NULL)
+    {
+        if (ent->d_name[0] == '.' || !ir_signal_is_file_name(ent->d_name))
+            continue;
+
+        if (file_has_extension(ent->d_name, IR_SIGNAL_EXT_RAW))
+        {
+            char bin_path[PATH_MAX];
+            size_t base_len = strlen(ent->d_name) - strlen(IR_SIGNAL_EXT_RAW);
+            if (snprintf(bin_path, sizeof(bin_path), "%s/%.*s%s", buttons_dir, (int)base_len, ent->d_name,
+                         IR_SIGNAL_EXT_BIN) < (int)sizeof(bin_path) && access(bin_path, F_OK) == 0)
+                continue;
+        }
+
+        count++;
+    }
+
+    closedir(dir);
+    return count;
+}
+
+static void refresh_entry(catalog_entry *entry, bool force)
+{
+    char remote_dir[PATH_MAX];
+    char buttons_dir[PATH_MAX];
+    if (snprintf(remote_dir, sizeof(remote_dir), "%s/%s", catalog.root, entry->info.name) >= (int)sizeof(remote_dir) ||
+        snprintf(buttons_dir, sizeof(buttons_dir), "%s/buttons", remote_dir) >= (int)sizeof(buttons_dir))
+        return;
+
+    struct timespec dir_mtime;
+    struct timespec buttons_mtime;
+    stat_mtime(remote_dir, &dir_mtime);
+    stat_mtime(buttons_dir, &buttons_mtime);
+
+    bool dir_changed = force || !same_time(&dir_mtime, &entry->dir_mtime);
+    bool buttons_changed = force || !same_time(&buttons_mtime, &entry->buttons_mtime);
+    if (!dir_changed && !buttons_changed)
+        return;
+
+    if (dir_changed)
+        read_label(remote_dir, entry);
+    if (buttons_changed)
+        entry->info.button_count = buttons_mtime.tv_sec ? count_buttons(buttons_dir) : 0;
+
+    entry->dir_mtime = dir_mtime;
+    entry->buttons_mtime = buttons_mtime;
+    catalog.dirty = true;
+
+    log_debug("[IR][catalog] refreshed %s buttons=%d", entry->info.name, entry->info.button_count);
+}
+
+static bool is_directory_entry(const struct dirent *ent)
+{
+    if (ent->d_type == DT_DIR)
+        return true;
+    if (ent->d_type != DT_UNKNOWN && ent->d_type != DT_LNK)
+        return false;
+
+    char path[PATH_MAX];
+    return snprintf(path, sizeof(path), "%s/%s", catalog.root, ent->d_name) < (int)sizeof(path) &&
+           file_is_directory(path);
+}
+
+// Picks up created and deleted remotes; existing entries keep their state.
+static void rescan_root(void)
+{
+    for (size_t i = 0; i < catalog.count; i++)
+        catalog.entries[i].seen = false;
+
+    DIR *dir = opendir(catalog.root);
+    if (dir)
+    {
+        struct dirent *ent;
+        while ((ent = readdir(dir)) != NULL)
+        {
+            if (ent->d_name[0] == '.' || strlen(ent->d_name) >= IR_MAX_NAME || !is_directory_entry(ent))
+                continue;
+
+            catalog_entry *entry = find_entry(ent->d_name);
+            if (entry)
+                entry->seen = true;
+            else
+                add_entry(ent->d_name);
+        }
+        closedir(dir);
+    }
+
+    size_t i = 0;
+    while (i < catalog.count)
+    {
+        if (catalog.entries[i].seen)
+        {
+            i++;
+            continue;
+        }
+
+        catalog.entries[i] = catalog.entries[--catalog.count];
+    }
+
+    catalog.dirty = true;
+}
+
+static int compare_entries(const void *a, const void *b)
+{
+    return strcmp(((const catalog_entry *)a)->info.name, ((const catalog_entry *)b)->info.name);
+}
+
+static void json_get_time(cJSON *obj, const char *key, struct timespec *out)
+{
+    memset(out, 0, sizeof(*out));
+
+    cJSON *pair = cJSON_GetObjectItemCaseSensitive(obj, key);
+    if (!cJSON_IsArray(pair) || cJSON_GetArraySize(pair) != 2)
+        return;
+
+    out->tv_sec = (time_t)cJSON_GetArrayItem(pair, 0)->valuedouble;
+    out->tv_nsec = (long)cJSON_GetArrayItem(pair, 1)->valuedouble;
+}
+
+static void json_add_time(cJSON *obj, const char *key, const struct timespec *t)
+{
+    cJSON *pair = cJSON_AddArrayToObject(obj, key);
+    cJSON_AddItemToArray(pair, cJSON_CreateNumber((double)t->tv_sec));
+    cJSON_AddItemToArray(pair, cJSON_CreateNumber((double)t->tv_nsec));
+}
+
+static void load_index(void)
+{
+    cJSON *root = file_exists(catalog.index_path) ? read_json_file(catalog.index_path) : NULL;
+    if (!root)
+        return;
+
+    cJSON *version = cJSON_GetObjectItemCaseSensitive(root, "version");
+    cJSON *remotes = cJSON_GetObjectItemCaseSensitive(root, "remotes");
+    if (!cJSON_IsNumber(version) || version->valueint != CATALOG_VERSION || !cJSON_IsArray(remotes))
+    {
+        cJSON_Delete(root);
+        return;
+    }
+
+    cJSON *item;
+    cJSON_ArrayForEach(item, remotes)
+    {
+        cJSON *name = cJSON_GetObjectItemCaseSensitive(item, "name");
+        cJSON *label = cJSON_GetObjectItemCaseSensitive(item, "label");
+        cJSON *buttons = cJSON_GetObjectItemCaseSensitive(item, "buttons");
+        if (!cJSON_IsString(name) || !name->valuestring || find_entry(name->valuestring))
+            continue;
+
+        catalog_entry *entry = add_entry(name->valuestring);
+        if (!entry)
+            break;
+
+        if (cJSON_IsString(label) && label->valuestring)
+            snprintf(entry->info.label, sizeof(entry->info.label), "%s", label->valuestring);
+        entry->info.button_count = cJSON_IsNumber(buttons) ? buttons->valueint : 0;
+        json_get_time(item, "mtime", &entry->dir_mtime);
+        json_get_time(item, "buttons_mtime", &entry->buttons_mtime);
+    }
+
+    cJSON_Delete(root);
+    log_debug("[IR][catalog] loaded %s remotes=%d", catalog.index_path, (int)catalog.count);
+}
+
+static void save_index(void)
+{
+    cJSON *root = cJSON_CreateObject();
+    cJSON_AddNumberToObject(root, "version", CATALOG_VERSION);
+
+    cJSON *remotes = cJSON_AddArrayToObject(root, "remotes");
+    for (size_t i = 0; i < catalog.count; i++)
+    {
+        const catalog_entry *entry = &catalog.entries[i];
+        cJSON *item = cJSON_CreateObject();
+        cJSON_AddStringToObject(item, "name", entry->info.name);
+        cJSON_AddStringToObject(item, "label", entry->info.label);
+        cJSON_AddNumberToObject(item, "buttons", entry->info.button_count);
+        json_add_time(item, "mtime", &entry->dir_mtime);
+        json_add_time(item, "buttons_mtime", &entry->buttons_mtime);
+        cJSON_AddItemToArray(remotes, item);
+    }
+
+    char *printed = cJSON_PrintUnformatted(root);
+    cJSON_Delete(root);
+    if (!printed)
+        return;
+
+    char tmp_path[PATH_MAX];
+    if (snprintf(tmp_path, sizeof(tmp_path), "%s.tmp", catalog.index_path) < (int)sizeof(tmp_path) &&
+        write_entire_file(tmp_path, printed, strlen(printed)) == 0 &&
+        rename(tmp_path, catalog.index_path) != 0)
+        remove(tmp_path);
+
+    cJSON_free(printed);
+    catalog.dirty = false;
+}
+
+static void commit_changes(void)
+{
+    if (!catalog.dirty)
+        return;
+
+    qsort(catalog.entries, catalog.count, sizeof(catalog_entry), compare_entries);
+    save_index();
+
+    /*
+     * The index lives in remotes_root, so its own rename moves the root
+     * mtime. That is why the root mtime is not persisted: the first lookup
+     * after start rescans the root once, which is a single readdir().
+     */
+    stat_mtime(catalog.root, &catalog.root_mtime);
+}
+
+void ir_remote_catalog_init(const char *remotes_root)
+{
+    ir_remote_catalog_deinit();
+
+    if (!remotes_root || !remotes_root[0])
+        return;
+
+    snprintf(catalog.root, sizeof(catalog.root), "%s", remotes_root);
+    normalize_dir_path(catalog.root);
+    if (snprintf(catalog.index_path, sizeof(catalog.index_path), "%s/%s", catalog.root, IR_CATALOG_FILE) >=
+        (int)sizeof(catalog.index_path))
+        catalog.index_path[0] = '\0';
+
+    load_index();
+}
+
+void ir_remote_catalog_deinit(void)
+{
+    free(catalog.entries);
+    free(catalog.view);
+    memset(&catalog, 0, sizeof(catalog));
+}
+
+const ir_catalog_remote *ir_remote_catalog_get(size_t *count)
+{
+    *count = 0;
+    if (!catalog.root[0] || !catalog.index_path[0])
+        return NULL;
+
+    struct timespec root_mtime;
+    stat_mtime(catalog.root, &root_mtime);
+    if (!same_time(&root_mtime, &catalog.root_mtime))
+        rescan_root();
+
+    for (size_t i = 0; i < catalog.count; i++)
+        refresh_entry(&catalog.entries[i], false);
+
+    commit_changes();
+
+    if (catalog.count > catalog.view_capacity)
+    {
+        ir_catalog_remote *grown = (ir_catalog_remote *)realloc(catalog.view, catalog.count * sizeof(ir_catalog_remote));
+        if (!grown)
+            return NULL;
+
+        catalog.view = grown;
+        catalog.view_capacity = catalog.count;
+    }
+
+    for (size_t i = 0; i < catalog.count; i++)
+        catalog.view[i] = catalog.entries[i].info;
+
+    *count = catalog.count;
+    return catalog.view;
+}
+
+void ir_remote_catalog_touch(const char *remote_name)
+{
+    if (!catalog.root[0] || !remote_name || !remote_name[0] || strlen(remote_name) >= IR_MAX_NAME)
+        return;
+
+    catalog_entry *entry = find_entry(remote_name);
+    if (!entry)
+        entry = add_entry(remote_name);
+    if (!entry)
+        return;
+
+    refresh_entry(entry, true);
+    commit_changes();
+}
+
+void ir_remote_catalog_store(const ir_catalog_remote *remotes, size_t count)
+{
+    if (!catalog.root[0] || !remotes)
+        return;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        catalog_entry *entry = find_entry(remotes[i].name);
+        if (!entry)
+            entry = add_entry(remotes[i].name);
+        if (!entry)
+            break;
+
+        char remote_dir[PATH_MAX];
+        char buttons_dir[PATH_MAX];
+        if (snprintf(remote_dir, sizeof(remote_dir), "%s/%s", catalog.root, entry->info.name) >= (int)sizeof(remote_dir) ||
+            snprintf(buttons_dir, sizeof(buttons_dir), "%s/buttons", remote_dir) >= (int)sizeof(buttons_dir))
+            continue;
+
+        entry->info = remotes[i];
+        stat_mtime(remote_dir, &entry->dir_mtime);
+        stat_mtime(buttons_dir, &entry->buttons_mtime);
+        catalog.dirty = true;
+    }
+
+    commit_changes();
+}
+
+void ir_remote_catalog_forget(const char *remote_name)
+{
+    if (!catalog.root[0] || !remote_name)
+        return;
+
+    catalog_entry *entry = find_entry(remote_name);
+    if (!entry)
+        return;
+
+    *entry = catalog.entries[--catalog.count];
+    catalog.dirty = true;
+    commit_changes();
+}
+
+bool ir_remote_catalog_find(const char *remote_name, ir_catalog_remote *out)
+{
+    const catalog_entry *entry = remote_name ? find_entry(remote_name) : NULL;
+    if (!entry)
+        return false;
+
+    *out = entry->info;
+    return true;
+}
@@ -0,0 +1,50 @@
+#ifndef IR_REMOTE_CATALOG_H
+#define IR_REMOTE_CATALOG_H
+
+#include "service/ir_service.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define IR_CATALOG_FILE ".catalog.json"    // in remotes_root; the leading dot keeps it out of listings
+
+typedef struct {
+    char name[IR_MAX_NAME];     // directory name, the key everything else uses
+    char label[IR_MAX_NAME];    // "name" from meta.json, `name` when missing
+    int button_count;
+} ir_catalog_remote;
+
+/*
+ * Remotes under remotes_root with their button counts, persisted in
+ * IR_CATALOG_FILE. A lookup only stats remotes_root and, per remote, its
+ * directory and buttons/; a remote is read again only when one of those
+ * mtimes moved. UI thread only.
+ */
+void ir_remote_catalog_init(const char *remotes_root);
+void ir_remote_catalog_deinit(void);
+
+// Sorted by name. Valid until the next catalog call.
+const ir_catalog_remote *ir_remote_catalog_get(size_t *count);
+
+// Re-reads one remote after the controller created it or stored a button in it.
+void ir_remote_catalog_touch(const char *remote_name);
+/*
+ * Records remotes the caller just wrote, with label and button count it
+ * already knows: only the two mtimes are stat'ed, and the index is saved
+ * once for the whole batch.
+ */
+void ir_remote_catalog_store(const ir_catalog_remote *remotes, size_t count);
+// Drops a remote whose directory is gone, without rescanning the root.
+void ir_remote_catalog_forget(const char *remote_name);
+// Cached entry only, no stat.
+bool ir_remote_catalog_find(const char *remote_name, ir_catalog_remote *out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* IR_REMOTE_CATALOG_H */
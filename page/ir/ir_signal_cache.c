@@ -0,0 +1,131 @@
+#include "page/ir/ir_signal_cache.h"
+#include "utils/file.h"
+#include "utils/logger.h"
+
+#include <limits.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+typedef struct {
+    char path[PATH_MAX];
+    struct timespec mtime;
+    off_t size;
+    bool valid;         // false keeps a broken file from being parsed on every press
+    ir_signal signal;
+} cache_entry;
+
+static struct {
+    cache_entry *entries;
+    size_t count;
+    size_t capacity;
+    char dir[PATH_MAX];
+} cache;
+
+static cache_entry *find_entry(const char *raw_path)
+{
+    for (size_t i = 0; i < cache.count; i++)
+    {
+        if (strcmp(cache.entries[i].path, raw_path) == 0)
+            return &cache.entries[i];
+    }
+
+    return NULL;
+}
+
+static cache_entry *add_entry(const char *raw_path)
+{
+    if (cache.count == cache.capacity)
+    {
+        size_t new_capacity = cache.capacity ? cache.capacity * 2 : 32;
+        cache_entry *grown = (cache_entry *)realloc(cache.entries, new_capacity * sizeof(cache_entry));
+        if (!grown)
+            return NULL;
+
+        cache.entries = grown;
+        cache.capacity = new_capacity;
+    }
+
+    cache_entry *entry = &cache.entries[cache.count++];
+    memset(entry, 0, sizeof(*entry));
+    snprintf(entry->path, sizeof(entry->path), "%s", raw_path);
+    return entry;
+}
+
+static void remove_entry(cache_entry *entry)
+{
+    ir_signal_free(&entry->signal);
+
+    size_t index = (size_t)(entry - cache.entries);
+    cache.entries[index] = cache.entries[--cache.count];
+}
+
+const ir_signal *ir_signal_cache_get(const char *raw_path)
+{
+    if (!raw_path || !raw_path[0])
+        return NULL;
+
+    struct stat st;
+    cache_entry *entry = find_entry(raw_path);
+    if (stat(raw_path, &st) != 0)
+    {
+        if (entry)
+            remove_entry(entry);
+        return NULL;
+    }
+
+    if (entry && entry->size == st.st_size &&
+        entry->mtime.tv_sec == st.st_mtim.tv_sec && entry->mtime.tv_nsec == st.st_mtim.tv_nsec)
+        return entry->valid ? &entry->signal : NULL;
+
+    if (!entry)
+        entry = add_entry(raw_path);
+    if (!entry)
+        return NULL;
+
+    ir_signal_free(&entry->signal);
+    entry->valid = ir_signal_load(raw_path, &entry->signal) == 0;
+    entry->mtime = st.st_mtim;
+    entry->size = st.st_size;
+
+    log_debug("[IR][signal_cache] parsed %s valid=%d durations=%d",
+              raw_path, (int)entry->valid, entry->signal.count);
+
+    return entry->valid ? &entry->signal : NULL;
+}
+
+static void preload_item(const file_desc *desc, void *obj_target)
+{
+    (void)obj_target;
+
+    if (!desc || !desc->is_file || !ir_signal_is_file_name(desc->file_name))
+        return;
+
+    ir_signal_cache_get(desc->file_path);
+}
+
+void ir_signal_cache_preload(const char *buttons_dir)
+{
+    if (!buttons_dir || !buttons_dir[0])
+        return;
+
+    // Only the selected remote stays in memory.
+    if (strcmp(cache.dir, buttons_dir) != 0)
+    {
+        ir_signal_cache_clear();
+        snprintf(cache.dir, sizeof(cache.dir), "%s", buttons_dir);
+    }
+
+    get_file_list(buttons_dir, preload_item, NULL);
+}
+
+void ir_signal_cache_clear(void)
+{
+    for (size_t i = 0; i < cache.count; i++)
+        ir_signal_free(&cache.entries[i].signal);
+
+    free(cache.entries);
+    memset(&cache, 0, sizeof(cache));
+}
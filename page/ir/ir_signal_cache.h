@@ -0,0 +1,26 @@
+#ifndef IR_SIGNAL_CACHE_H
+#define IR_SIGNAL_CACHE_H
+
+#include "service/ir_signal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Parsed signal files (.raw or .irb) keyed by path. An entry is reused while the file keeps
+ * the same mtime and size, and parsed again otherwise. UI thread only.
+ */
+
+// NULL when the file is missing or not a valid signal.
+const ir_signal *ir_signal_cache_get(const char *raw_path);
+
+// Parses every .raw/.irb in `buttons_dir` and drops entries from other directories.
+void ir_signal_cache_preload(const char *buttons_dir);
+void ir_signal_cache_clear(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* IR_SIGNAL_CACHE_H */
@@ -0,0 +1,96 @@
+#include "page/ir/ir_waveform.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+int ir_waveform_init(ir_waveform *wf, const uint32_t *durations, int count)
+{
+    if (!wf)
+        return -1;
+
+    memset(wf, 0, sizeof(*wf));
+    if (!durations || count <= 0)
+        return -1;
+
+    wf->starts = (uint64_t *)malloc(((size_t)count + 1) * sizeof(uint64_t));
+    if (!wf->starts)
+        return -1;
+
+    uint64_t t = 0;
+    for (int i = 0; i < count; i++)
+    {
+        wf->starts[i] = t;
+        t += durations[i];
+    }
+    wf->starts[count] = t;
+
+    wf->durations = durations;
+    wf->count = count;
+    wf->total_us = t;
+    return 0;
+}
+
+void ir_waveform_free(ir_waveform *wf)
+{
+    if (!wf)
+        return;
+
+    free(wf->starts);
+    memset(wf, 0, sizeof(*wf));
+}
+
+// Index of the duration playing at `t`, or `count` once the signal is over.
+static int waveform_find(const ir_waveform *wf, uint64_t t)
+{
+    if (t >= wf->total_us)
+        return wf->count;
+
+    int lo = 0;
+    int hi = wf->count - 1;
+    while (lo < hi)
+    {
+        int mid = lo + (hi - lo + 1) / 2;
+        if (wf->starts[mid] <= t)
+            lo = mid;
+        else
+            hi = mid - 1;
+    }
+
+    return lo;
+}
+
+static uint8_t waveform_level(const ir_waveform *wf, int index)
+{
+    return index < wf->count && index % 2 == 0;
+}
+
+void ir_waveform_decimate(const ir_waveform *wf, uint64_t start_us, uint64_t span_us,
+                          ir_waveform_column *columns, int width)
+{
+    if (!wf || !columns || width <= 0)
+        return;
+
+    int index = waveform_find(wf, start_us);
+    for (int c = 0; c < width; c++)
+    {
+        // Column c covers [t0, t1); t0 itself is where the previous one stopped.
+        uint64_t t1 = start_us + span_us * (uint64_t)(c + 1) / (uint64_t)width;
+
+        ir_waveform_column *column = &columns[c];
+        column->min = column->max = waveform_level(wf, index);
+        column->edges = 0;
+
+        // A duration ending exactly on t1 draws its edge in this column.
+        while (index < wf->count && wf->starts[index + 1] <= t1)
+        {
+            index++;
+            uint8_t level = waveform_level(wf, index);
+            if (level < column->min)
+                column->min = level;
+            if (level > column->max)
+                column->max = level;
+            if (column->edges < UINT16_MAX)
+                column->edges++;
+        }
+    }
+}
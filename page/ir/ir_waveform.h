@@ -0,0 +1,44 @@
+#ifndef IR_WAVEFORM_H
+#define IR_WAVEFORM_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// What the signal did during one screen column. Past the end it is idle, a space.
+typedef struct {
+    uint8_t min;                // 0 when the column saw a space
+    uint8_t max;                // 1 when it saw a pulse
+    uint16_t edges;             // level changes inside the column, saturating
+} ir_waveform_column;
+
+typedef struct {
+    const uint32_t *durations;  // borrowed, pulse first
+    uint64_t *starts;           // start of each duration, starts[count] is the total
+    int count;
+    uint64_t total_us;
+} ir_waveform;
+
+/*
+ * Indexes `durations` (pulse/space pairs in µs, as in ir_signal) so any time
+ * window can be found with a binary search. `durations` must outlive `wf`.
+ * Returns 0, or -1 when there is nothing to show.
+ */
+int ir_waveform_init(ir_waveform *wf, const uint32_t *durations, int count);
+void ir_waveform_free(ir_waveform *wf);
+
+/*
+ * Min/max decimation of [start_us, start_us + span_us) into `width` equal
+ * columns, in one pass over the durations in view: the cost is the number
+ * of edges shown plus `width`, however long the capture is.
+ */
+void ir_waveform_decimate(const ir_waveform *wf, uint64_t start_us, uint64_t span_us,
+                          ir_waveform_column *columns, int width);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* IR_WAVEFORM_H */
@@ -9,13 +9,19 @@
 #include <stdio.h>
 #include <string.h>
 
+#define LEARN_POLL_PERIOD_MS 50
+
 typedef struct {
+    lv_obj_t *page;
     lv_obj_t *keyboard;
     lv_obj_t *remote_dropdown;
     lv_obj_t *button_input;
     lv_obj_t *status;
     lv_obj_t *active_textarea;
+    lv_obj_t *finish_btn;
+    lv_timer_t *poll_timer;     // paused unless a capture runs
     bool use_on_screen_keyboard;
+    int watch_handle;
 } learn_ui_t;
 
 static learn_ui_t g_learn;
@@ -126,6 +132,37 @@ static void learn_refresh_remotes_cb(lv_event_t *e)
     load_remote_dropdown();
 }
 
+// Remotes created or deleted elsewhere show up in the dropdown; a running capture keeps its status line.
+static void learn_watch_cb(const ir_watch_event *event, void *user_data)
+{
+    char remote[IR_MAX_NAME];
+
+    (void)user_data;
+    if (!g_learn.remote_dropdown)
+        return;
+
+    bool busy = ir_controller_learn_busy();
+    switch (event->type) {
+        case IR_WATCH_REMOTE_ADDED:
+            get_dropdown_text(g_learn.remote_dropdown, remote, sizeof(remote));
+            if (dropdown_insert_sorted(g_learn.remote_dropdown, event->remote.name) && !remote[0] && !busy)
+                learn_set_status("Ready to capture.");
+            break;
+        case IR_WATCH_REMOTE_REMOVED:
+            dropdown_remove_option(g_learn.remote_dropdown, event->remote.name);
+            get_dropdown_text(g_learn.remote_dropdown, remote, sizeof(remote));
+            if (!remote[0] && !busy)
+                learn_set_status("No remotes available. Create one first.");
+            break;
+        case IR_WATCH_RESYNC:
+            if (!busy)
+                load_remote_dropdown();
+            break;
+        default:
+            break;
+    }
+}
+
 static void learn_keyboard_hide(learn_ui_t *ui)
 {
     lv_group_t *group;
@@ -204,12 +241,85 @@ static void learn_button_input_event_cb(lv_event_t *e)
         learn_keyboard_show(ui, ta);
 }
 
+static void learn_set_busy(bool busy)
+{
+    if (!g_learn.finish_btn)
+        return;
+
+    if (busy)
+        lv_obj_add_state(g_learn.finish_btn, LV_STATE_DISABLED);
+    else
+        lv_obj_clear_state(g_learn.finish_btn, LV_STATE_DISABLED);
+}
+
+static void learn_show_event(const ir_learn_event *ev)
+{
+    char text[192];
+
+    switch (ev->type) {
+    case IR_LEARN_EV_WAITING:
+        if (ev->presses > 1 && ev->attempt == 1)
+            snprintf(text, sizeof(text), "Press %d/%d: press the remote button now.", ev->press, ev->presses);
+        else if (ev->attempt > 1)
+            snprintf(text, sizeof(text), "Retry %d/%d: press the remote again.", ev->attempt, ev->max_attempts);
+        else
+            snprintf(text, sizeof(text), "Waiting for signal... Press remote now.");
+        break;
+    case IR_LEARN_EV_VALIDATING:
+        snprintf(text, sizeof(text), "Validating capture...");
+        break;
+    case IR_LEARN_EV_CAPTURED:
+        if (ev->status == IR_OK)
+            snprintf(text, sizeof(text), "Captured %d pulses.", ev->pulses);
+        else
+            snprintf(text, sizeof(text), "Captured %d pulses, not a valid signal.", ev->pulses);
+        break;
+    case IR_LEARN_EV_RETRY:
+        snprintf(text, sizeof(text), "Attempt %d/%d failed.", ev->attempt, ev->max_attempts);
+        break;
+    case IR_LEARN_EV_DONE:
+        if (ev->status == IR_OK && ev->message[0])
+            snprintf(text, sizeof(text), "Signal stored as %s.", ev->message);
+        else if (ev->status == IR_OK)
+            snprintf(text, sizeof(text), "Signal captured and stored.");
+        else if (ev->status == IR_ERR_CANCELED)
+            snprintf(text, sizeof(text), "Capture canceled.");
+        else
+            snprintf(text, sizeof(text), "%s", ev->message[0] ? ev->message : "Capture failed.");
+        break;
+    default:
+        return;
+    }
+
+    learn_set_status(text);
+}
+
+static void learn_poll_timer_cb(lv_timer_t *timer)
+{
+    (void)timer;
+    ir_learn_event ev;
+
+    while (ir_controller_learn_poll(&ev)) {
+        learn_show_event(&ev);
+        if (ev.type != IR_LEARN_EV_DONE)
+            continue;
+
+        printf("[IR][learn_ui] learn result rc=%d err='%s'\n", (int)ev.status, ev.message);
+        lv_timer_pause(g_learn.poll_timer);
+        learn_set_busy(false);
+        return;
+    }
+}
+
 static void learn_finish_cb(lv_event_t *e)
 {
     char remote[IR_MAX_NAME];
     char button[IR_MAX_NAME];
     lv_obj_t *finish_btn = (lv_obj_t *)lv_event_get_target(e);
 
+    if (ir_controller_learn_busy())
+        return;
+
     get_dropdown_text(g_learn.remote_dropdown, remote, sizeof(remote));
     snprintf(button, sizeof(button), "%s", lv_textarea_get_text(g_learn.button_input));
     zv_trim_inplace(button);
@@ -229,23 +339,27 @@ static void learn_finish_cb(lv_event_t *e)
     if (finish_btn)
         lv_group_focus_obj(finish_btn);
 
-    learn_set_status("Recording signal... Press remote now.");
-    lv_refr_now(NULL);
-
-    ir_status_t rc = ir_controller_learn_button(remote, button);
-    printf("[IR][learn_ui] learn result rc=%d err='%s'\n", (int)rc, ir_controller_last_error());
-    
-    if (rc == IR_OK) {
-        learn_set_status("Signal captured and stored.");
+    if (ir_controller_learn_button_async(remote, button) != IR_OK) {
+        learn_set_status(ir_controller_last_error());
         return;
     }
 
-    learn_set_status(ir_controller_last_error());
+    learn_set_status("Waiting for signal... Press remote now.");
+    learn_set_busy(true);
+    lv_timer_resume(g_learn.poll_timer);
 }
 
 static void learn_cancel_cb(lv_event_t *e)
 {
     (void)e;
+
+    // The DONE event still comes through the poll timer.
+    if (ir_controller_learn_busy()) {
+        ir_controller_learn_cancel();
+        learn_set_status("Canceling capture...");
+        return;
+    }
+
     learn_keyboard_hide(&g_learn);
     if (g_learn.button_input)
         lv_textarea_set_text(g_learn.button_input, "");
@@ -258,6 +372,7 @@ lv_obj_t *ir_learn_button_page_create(lv_obj_t *menu)
     lv_obj_set_scrollbar_mode(page, LV_SCROLLBAR_MODE_OFF);
 
     memset(&g_learn, 0, sizeof(g_learn));
+    g_learn.page = page;
     g_learn.use_on_screen_keyboard = true;
 
     const zv_config *cfg = config_get();
@@ -324,6 +439,7 @@ lv_obj_t *ir_learn_button_page_create(lv_obj_t *menu)
     lv_obj_set_style_border_color(finish_btn, ZV_COLOR_BORDER, 0);
     lv_obj_set_style_radius(finish_btn, 12, 0);
     lv_obj_add_event_cb(finish_btn, learn_finish_cb, LV_EVENT_CLICKED, NULL);
+    g_learn.finish_btn = finish_btn;
 
     lv_obj_t *finish_label = lv_label_create(finish_btn);
     lv_label_set_text(finish_label, "Finish");
@@ -339,7 +455,31 @@ lv_obj_t *ir_learn_button_page_create(lv_obj_t *menu)
         lv_obj_add_event_cb(g_learn.keyboard, learn_keyboard_event_cb, LV_EVENT_CANCEL, &g_learn);
     }
 
+    g_learn.poll_timer = lv_timer_create(learn_poll_timer_cb, LEARN_POLL_PERIOD_MS, NULL);
+    lv_timer_pause(g_learn.poll_timer);
+
     load_remote_dropdown();
+    g_learn.watch_handle = ir_controller_watch(learn_watch_cb, NULL);
 
     return page;
 }
+
+void ir_learn_button_page_destroy(void)
+{
+    if (g_learn.watch_handle >= 0)
+        ir_controller_unwatch(g_learn.watch_handle);
+
+    // A capture left running would outlive the page; its events are dropped.
+    ir_controller_learn_cancel();
+    if (g_learn.poll_timer)
+        lv_timer_delete(g_learn.poll_timer);
+
+    // The keyboard lives on the top layer, not under the page.
+    if (g_learn.keyboard)
+        lv_obj_del(g_learn.keyboard);
+    if (g_learn.page)
+        lv_obj_del(g_learn.page);
+
+    memset(&g_learn, 0, sizeof(g_learn));
+    g_learn.watch_handle = -1;
+}
@@ -8,6 +8,7 @@ extern "C" {
 #endif
 
 lv_obj_t *ir_learn_button_page_create(lv_obj_t *menu);
+void ir_learn_button_page_destroy(void);
 bool ir_learn_button_keyboard_is_visible(void);
 
 #ifdef __cplusplus
@@ -0,0 +1,174 @@
+#include "page/ir/macros.h"
+#include "components/component_helper.h"
+#include "components/list/ui_list.h"
+#include "components/ui_theme.h"
+#include "page/ir/ir_controller.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#define MACRO_POLL_PERIOD_MS 50
+
+typedef struct {
+    lv_obj_t *page;
+    ui_list *list;
+    lv_obj_t *status;
+    lv_timer_t *poll_timer;     // paused unless a macro runs
+} macros_ui_t;
+
+static macros_ui_t g_macros;
+
+static void macros_set_status(const char *txt, lv_color_t color)
+{
+    if (!g_macros.status)
+        return;
+
+    lv_label_set_text(g_macros.status, txt);
+    lv_obj_set_style_text_color(g_macros.status, color, 0);
+}
+
+static void macros_refresh(void)
+{
+    ir_macro_list macros;
+
+    clean_list(g_macros.list);
+    if (ir_controller_list_macros(&macros) != IR_OK) {
+        macros_set_status("Macros are not configured (ir.macros_path).", ZV_COLOR_ERROR);
+        return;
+    }
+
+    for (size_t i = 0; i < macros.count; i++) {
+        list_item_t item = {
+            .text = macros.macros[i].name,
+            .left_badge = { .label = LV_SYMBOL_PLAY, .type = BADGE_TEXT_TYPE },
+            .raw_value = macros.macros[i].name,
+        };
+        add_item(g_macros.list, &item);
+    }
+
+    if (macros.count == 0)
+        macros_set_status("No macros yet. Add .json files to ir.macros_path.", ZV_COLOR_TEXT_MAIN);
+
+    ir_controller_free_macro_list(&macros);
+}
+
+static void macros_poll_timer_cb(lv_timer_t *timer)
+{
+    (void)timer;
+    ir_macro_result result;
+
+    if (!ir_controller_macro_poll(&result))
+        return;
+
+    lv_timer_pause(g_macros.poll_timer);
+    if (result.status == IR_OK) {
+        char text[96];
+        snprintf(text, sizeof(text), "Done: %d frames, worst delay %d us.", result.frames, result.max_late_us);
+        macros_set_status(text, ZV_COLOR_TEXT_MAIN);
+    } else if (result.status == IR_ERR_CANCELED) {
+        macros_set_status("Macro canceled.", ZV_COLOR_TEXT_MAIN);
+    } else {
+        macros_set_status(result.message, ZV_COLOR_ERROR);
+    }
+}
+
+static void macros_item_clicked(ui_list *list, const list_item_t *item, void *user_data)
+{
+    (void)list;
+    (void)user_data;
+
+    if (!item || !item->raw_value || ir_controller_macro_busy())
+        return;
+
+    if (ir_controller_run_macro_async(item->raw_value) != IR_OK) {
+        macros_set_status(ir_controller_last_error(), ZV_COLOR_ERROR);
+        return;
+    }
+
+    char text[IR_MAX_NAME + 16];
+    snprintf(text, sizeof(text), "Running %s...", item->raw_value);
+    macros_set_status(text, ZV_COLOR_TEXT_MAIN);
+    lv_timer_resume(g_macros.poll_timer);
+}
+
+static void macros_refresh_cb(lv_event_t *e)
+{
+    (void)e;
+    macros_refresh();
+}
+
+static void macros_cancel_cb(lv_event_t *e)
+{
+    (void)e;
+
+    // The result still comes through the poll timer.
+    if (ir_controller_macro_busy()) {
+        ir_controller_macro_cancel();
+        macros_set_status("Canceling macro...", ZV_COLOR_TEXT_MAIN);
+    }
+}
+
+lv_obj_t *ir_macros_page_create(lv_obj_t *menu)
+{
+    lv_obj_t *page = lv_menu_page_create(menu, "Macros");
+    lv_obj_set_scrollbar_mode(page, LV_SCROLLBAR_MODE_OFF);
+
+    memset(&g_macros, 0, sizeof(g_macros));
+    g_macros.page = page;
+
+    lv_obj_t *root = lv_obj_create(page);
+    lv_obj_set_size(root, LV_PCT(100), LV_PCT(100));
+    lv_obj_set_style_bg_opa(root, LV_OPA_TRANSP, 0);
+    lv_obj_set_style_border_width(root, 0, 0);
+    lv_obj_set_style_pad_all(root, 12, 0);
+    lv_obj_clear_flag(root, LV_OBJ_FLAG_SCROLLABLE);
+
+    lv_obj_set_layout(root, LV_LAYOUT_FLEX);
+    lv_obj_set_flex_flow(root, LV_FLEX_FLOW_COLUMN);
+    lv_obj_set_style_pad_row(root, 10, 0);
+
+    lv_obj_t *header_row = create_transparent_flex_row(root, LV_PCT(100), 45);
+    create_section_label(header_row, "Tap a macro to run it:");
+    create_icon_button(header_row, LV_SYMBOL_REFRESH, 45, 35, macros_refresh_cb, NULL);
+
+    g_macros.list = create_list(root, 100, 60);
+    set_event_data(g_macros.list, macros_item_clicked, NULL);
+
+    g_macros.status = lv_label_create(root);
+    lv_label_set_text(g_macros.status, "");
+    lv_obj_set_style_text_color(g_macros.status, ZV_COLOR_TEXT_MAIN, 0);
+    lv_label_set_long_mode(g_macros.status, LV_LABEL_LONG_WRAP);
+    lv_obj_set_width(g_macros.status, LV_PCT(100));
+
+    lv_obj_t *cancel_btn = lv_btn_create(root);
+    lv_obj_set_size(cancel_btn, LV_PCT(100), 40);
+    lv_obj_set_style_bg_color(cancel_btn, ZV_COLOR_BG_PANEL, 0);
+    lv_obj_set_style_bg_opa(cancel_btn, LV_OPA_COVER, 0);
+    lv_obj_set_style_border_width(cancel_btn, 2, 0);
+    lv_obj_set_style_border_color(cancel_btn, ZV_COLOR_BORDER, 0);
+    lv_obj_set_style_radius(cancel_btn, 12, 0);
+    lv_obj_add_event_cb(cancel_btn, macros_cancel_cb, LV_EVENT_CLICKED, NULL);
+
+    lv_obj_t *cancel_label = lv_label_create(cancel_btn);
+    lv_label_set_text(cancel_label, LV_SYMBOL_STOP "  Cancel");
+    lv_obj_set_style_text_color(cancel_label, ZV_COLOR_TEXT_MAIN, 0);
+    lv_obj_center(cancel_label);
+
+    g_macros.poll_timer = lv_timer_create(macros_poll_timer_cb, MACRO_POLL_PERIOD_MS, NULL);
+    lv_timer_pause(g_macros.poll_timer);
+
+    macros_refresh();
+    return page;
+}
+
+void ir_macros_page_destroy(void)
+{
+    // A macro left running would outlive the page; its result is dropped.
+    ir_controller_macro_cancel();
+    if (g_macros.poll_timer)
+        lv_timer_delete(g_macros.poll_timer);
+    if (g_macros.page)
+        lv_obj_del(g_macros.page);
+
+    memset(&g_macros, 0, sizeof(g_macros));
+}
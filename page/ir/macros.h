@@ -0,0 +1,17 @@
+#ifndef IR_MACROS_H
+#define IR_MACROS_H
+
+#include "lvgl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+lv_obj_t *ir_macros_page_create(lv_obj_t *menu);
+void ir_macros_page_destroy(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* IR_MACROS_H */
@@ -10,6 +10,7 @@
 #include <string.h>
 
 typedef struct {
+    lv_obj_t *page;
     lv_obj_t *keyboard;
     lv_obj_t *name_input;
     lv_obj_t *status_label;
@@ -183,6 +184,7 @@ lv_obj_t *ir_new_remote_page_create(lv_obj_t *menu)
            g_new_remote.use_on_screen_keyboard ? 1 : 0);
 
     lv_obj_t *page = lv_menu_page_create(menu, "New Remote");
+    g_new_remote.page = page;
     lv_obj_set_scrollbar_mode(page, LV_SCROLLBAR_MODE_OFF);
 
     lv_obj_t *root = lv_obj_create(page);
@@ -300,3 +302,14 @@ lv_obj_t *ir_new_remote_page_create(lv_obj_t *menu)
 
     return page;
 }
+
+void ir_new_remote_page_destroy(void)
+{
+    // The keyboard lives on the top layer, not under the page.
+    if (g_new_remote.keyboard)
+        lv_obj_del(g_new_remote.keyboard);
+    if (g_new_remote.page)
+        lv_obj_del(g_new_remote.page);
+
+    memset(&g_new_remote, 0, sizeof(g_new_remote));
+}
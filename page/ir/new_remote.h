@@ -9,6 +9,7 @@ extern "C" {
 #endif
 
 lv_obj_t *ir_new_remote_page_create(lv_obj_t *menu);
+void ir_new_remote_page_destroy(void);
 bool ir_new_remote_keyboard_is_visible(void);
 
 #ifdef __cplusplus
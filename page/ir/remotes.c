@@ -6,9 +6,11 @@
 #include <string.h>
 
 typedef struct {
+    lv_obj_t *page;
     lv_obj_t *root;
     lv_obj_t *list_container;
     lv_obj_t *status_label;
+    int watch_handle;
 } remotes_ui_t;
 
 static remotes_ui_t g_remotes;
@@ -54,6 +56,40 @@ static lv_obj_t *ir_create_remote_card(lv_obj_t *parent, const char *icon, const
     return card;
 }
 
+// Card children: icon, text column (title, subtitle). The title is the remote name.
+static lv_obj_t *card_text(lv_obj_t *card, int32_t index)
+{
+    lv_obj_t *text_col = lv_obj_get_child(card, 1);
+    return text_col ? lv_obj_get_child(text_col, index) : NULL;
+}
+
+static lv_obj_t *find_remote_card(const char *name, int32_t *sorted_index)
+{
+    uint32_t count = lv_obj_get_child_count(g_remotes.list_container);
+    int32_t before = 0;
+    for (uint32_t i = 0; i < count; i++)
+    {
+        lv_obj_t *card = lv_obj_get_child(g_remotes.list_container, (int32_t)i);
+        lv_obj_t *title = card_text(card, 0);
+        int cmp = title ? strcmp(lv_label_get_text(title), name) : -1;
+        if (cmp == 0)
+            return card;
+        if (cmp < 0)
+            before++;
+    }
+
+    if (sorted_index)
+        *sorted_index = before;
+    return NULL;
+}
+
+static void set_card_subtitle(lv_obj_t *card, int button_count)
+{
+    lv_obj_t *subtitle = card_text(card, 1);
+    if (subtitle)
+        lv_label_set_text_fmt(subtitle, "%d buttons learned", button_count);
+}
+
 static void remotes_refresh(void)
 {
     ir_remote_list remotes = {0};
@@ -78,14 +114,55 @@ static void remotes_refresh(void)
     }
 
     for (size_t i = 0; i < remotes.count; i++) {
-        char subtitle[80];
-        snprintf(subtitle, sizeof(subtitle), "%d buttons learned", remotes.remotes[i].button_count);
-        ir_create_remote_card(g_remotes.list_container, LV_SYMBOL_VIDEO, remotes.remotes[i].name, subtitle);
+        lv_obj_t *card = ir_create_remote_card(g_remotes.list_container, LV_SYMBOL_VIDEO, remotes.remotes[i].name, "");
+        set_card_subtitle(card, remotes.remotes[i].button_count);
     }
 
     ir_controller_free_remote_list(&remotes);
 }
 
+// Keeps the cards in step with remotes_root without listing it again.
+static void remotes_watch_cb(const ir_watch_event *event, void *user_data)
+{
+    (void)user_data;
+
+    if (!g_remotes.list_container)
+        return;
+
+    if (event->type == IR_WATCH_RESYNC)
+    {
+        remotes_refresh();
+        return;
+    }
+
+    int32_t index = 0;
+    lv_obj_t *card = find_remote_card(event->remote.name, &index);
+
+    switch (event->type)
+    {
+        case IR_WATCH_REMOTE_REMOVED:
+            if (card)
+                lv_obj_del(card);
+            if (lv_obj_get_child_count(g_remotes.list_container) == 0)
+                lv_label_set_text(g_remotes.status_label, "No remotes yet. Create one first.");
+            return;
+        case IR_WATCH_REMOTE_ADDED:
+            if (!card)
+            {
+                card = ir_create_remote_card(g_remotes.list_container, LV_SYMBOL_VIDEO, event->remote.name, "");
+                lv_obj_move_to_index(card, index);
+                lv_label_set_text(g_remotes.status_label, "");
+            }
+            break;
+        default:
+            if (!card)
+                return;
+            break;
+    }
+
+    set_card_subtitle(card, event->remote.button_count);
+}
+
 static void remotes_refresh_btn_cb(lv_event_t *e)
 {
     (void)e;
@@ -103,6 +180,7 @@ lv_obj_t *ir_remotes_page_create(lv_obj_t *menu)
     memset(&g_remotes, 0, sizeof(g_remotes));
 
     page = lv_menu_page_create(menu, "IR Remotes");
+    g_remotes.page = page;
     lv_obj_set_scrollbar_mode(page, LV_SCROLLBAR_MODE_OFF);
 
     root = lv_obj_create(page);
@@ -161,6 +239,19 @@ lv_obj_t *ir_remotes_page_create(lv_obj_t *menu)
     lv_obj_center(refresh_label);
 
     remotes_refresh();
+    g_remotes.watch_handle = ir_controller_watch(remotes_watch_cb, NULL);
 
     return page;
 }
+
+void ir_remotes_page_destroy(void)
+{
+    if (g_remotes.watch_handle >= 0)
+        ir_controller_unwatch(g_remotes.watch_handle);
+
+    if (g_remotes.page)
+        lv_obj_del(g_remotes.page);
+
+    memset(&g_remotes, 0, sizeof(g_remotes));
+    g_remotes.watch_handle = -1;
+}
@@ -8,6 +8,7 @@ extern "C" {
 #endif
 
 lv_obj_t *ir_remotes_page_create(lv_obj_t *menu);
+void ir_remotes_page_destroy(void);
 
 #ifdef __cplusplus
 }
@@ -15,6 +15,7 @@ typedef struct {
     lv_obj_t *remote_dropdown;
     lv_obj_t *grid;
     ui_pills *signal_state_pill;
+    int watch_handle;
 } send_signal_ui_t;
 
 typedef struct {
@@ -125,12 +126,41 @@ static void clear_grid(void)
         lv_obj_clean(g_send_ui.grid);
 }
 
+static void add_grid_button(const char *button_name)
+{
+    send_grid_button_ctx_t *ctx = (send_grid_button_ctx_t *)calloc(1, sizeof(*ctx));
+    if (!ctx)
+        return;
+
+    snprintf(ctx->name, sizeof(ctx->name), "%s", button_name);
+
+    lv_obj_t *btn = ir_create_key_button(g_send_ui.grid, button_name);
+    lv_obj_add_event_cb(btn, send_grid_button_cb, LV_EVENT_CLICKED, ctx);
+    lv_obj_add_event_cb(btn, send_grid_button_delete_cb, LV_EVENT_DELETE, ctx);
+}
+
+// Key buttons carry their name in the label, child 0.
+static lv_obj_t *find_grid_button(const char *button_name)
+{
+    uint32_t count = lv_obj_get_child_count(g_send_ui.grid);
+    for (uint32_t i = 0; i < count; i++)
+    {
+        lv_obj_t *btn = lv_obj_get_child(g_send_ui.grid, (int32_t)i);
+        lv_obj_t *label = lv_obj_get_child(btn, 0);
+        if (label && strcmp(lv_label_get_text(label), button_name) == 0)
+            return btn;
+    }
+
+    return NULL;
+}
+
 static void rebuild_button_controls(const char *remote_name)
 {
     ir_button_list buttons = {0};
     ir_status_t rc;
 
     clear_grid();
+    ir_controller_select_remote(remote_name);
 
     rc = ir_controller_list_buttons(remote_name, &buttons);
     if (rc != IR_OK)
@@ -139,17 +169,8 @@ static void rebuild_button_controls(const char *remote_name)
         return;
     }
 
-    for (size_t i = 0; i < buttons.count; i++) {
-        send_grid_button_ctx_t *ctx = (send_grid_button_ctx_t *)calloc(1, sizeof(*ctx));
-        if (!ctx)
-            continue;
-
-        snprintf(ctx->name, sizeof(ctx->name), "%s", buttons.buttons[i].name);
-
-        lv_obj_t *btn = ir_create_key_button(g_send_ui.grid, buttons.buttons[i].name);
-        lv_obj_add_event_cb(btn, send_grid_button_cb, LV_EVENT_CLICKED, ctx);
-        lv_obj_add_event_cb(btn, send_grid_button_delete_cb, LV_EVENT_DELETE, ctx);
-    }
+    for (size_t i = 0; i < buttons.count; i++)
+        add_grid_button(buttons.buttons[i].name);
 
     if (buttons.count == 0)
         send_signal_status("No buttons learned yet.", ZV_COLOR_WARNING);
@@ -210,6 +231,61 @@ static void load_remote_dropdown(void)
     remote_changed_cb(NULL);
 }
 
+// Patches the dropdown and the grid of the selected remote instead of listing again.
+static void send_watch_cb(const ir_watch_event *event, void *user_data)
+{
+    char remote[IR_MAX_NAME];
+
+    (void)user_data;
+    if (!g_send_ui.remote_dropdown || !g_send_ui.grid)
+        return;
+
+    if (event->type == IR_WATCH_RESYNC) {
+        load_remote_dropdown();
+        return;
+    }
+
+    get_dropdown_text(g_send_ui.remote_dropdown, remote, sizeof(remote));
+    bool is_selected = remote[0] && strcmp(remote, event->remote.name) == 0;
+
+    switch (event->type) {
+        case IR_WATCH_REMOTE_ADDED:
+            if (dropdown_insert_sorted(g_send_ui.remote_dropdown, event->remote.name) && !remote[0])
+                remote_changed_cb(NULL);
+            break;
+        case IR_WATCH_REMOTE_REMOVED:
+            if (!dropdown_remove_option(g_send_ui.remote_dropdown, event->remote.name) || !is_selected)
+                break;
+
+            get_dropdown_text(g_send_ui.remote_dropdown, remote, sizeof(remote));
+            if (remote[0]) {
+                remote_changed_cb(NULL);
+            } else {
+                clear_grid();
+                send_signal_status("No remotes available.", ZV_COLOR_WARNING);
+            }
+            break;
+        case IR_WATCH_BUTTON_ADDED:
+            if (is_selected && !find_grid_button(event->button)) {
+                add_grid_button(event->button);
+                send_signal_status("IDLE", ZV_COLOR_TEXT_MUTED);
+            }
+            break;
+        case IR_WATCH_BUTTON_REMOVED: {
+            lv_obj_t *btn = is_selected ? find_grid_button(event->button) : NULL;
+            if (!btn)
+                break;
+
+            lv_obj_del(btn);
+            if (lv_obj_get_child_count(g_send_ui.grid) == 0)
+                send_signal_status("No buttons learned yet.", ZV_COLOR_WARNING);
+            break;
+        }
+        default:
+            break;
+    }
+}
+
 lv_obj_t *ir_send_signal_page_create(lv_obj_t *menu)
 {
     base_view *view;
@@ -255,6 +331,19 @@ lv_obj_t *ir_send_signal_page_create(lv_obj_t *menu)
     }
 
     load_remote_dropdown();
+    g_send_ui.watch_handle = ir_controller_watch(send_watch_cb, NULL);
 
     return g_send_ui.base.page;
 }
+
+void ir_send_signal_page_destroy(void)
+{
+    if (g_send_ui.watch_handle >= 0)
+        ir_controller_unwatch(g_send_ui.watch_handle);
+
+    if (g_send_ui.base.page)
+        lv_obj_del(g_send_ui.base.page);
+
+    memset(&g_send_ui, 0, sizeof(g_send_ui));
+    g_send_ui.watch_handle = -1;
+}
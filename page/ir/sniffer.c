@@ -0,0 +1,184 @@
+#include "page/ir/sniffer.h"
+#include "components/component_helper.h"
+#include "components/ui_theme.h"
+#include "page/ir/ir_controller.h"
+#include "service/ir_protocol.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#define SNIFFER_POLL_PERIOD_MS 50
+#define SNIFFER_FRAMES_PER_TICK 16  // the rest waits in the controller queue, or is dropped there
+#define SNIFFER_MAX_ROWS 40         // older rows are reused for new frames
+
+typedef struct {
+    lv_obj_t *page;
+    lv_obj_t *toggle;
+    lv_obj_t *counters;
+    lv_obj_t *rows;
+    lv_timer_t *poll_timer;         // paused unless the monitor runs
+    unsigned int row_count;
+} sniffer_ui_t;
+
+static sniffer_ui_t g_sniffer;
+
+static void sniffer_set_counters(const char *txt, lv_color_t color)
+{
+    if (!g_sniffer.counters)
+        return;
+
+    lv_label_set_text(g_sniffer.counters, txt);
+    lv_obj_set_style_text_color(g_sniffer.counters, color, 0);
+}
+
+static void sniffer_format_frame(const ir_monitor_frame *frame, char *out, size_t out_sz)
+{
+    char code[64];
+    if (frame->protocol != IR_PROTO_NONE)
+        snprintf(code, sizeof(code), "%s 0x%X/0x%X", ir_protocol_name(frame->protocol),
+                 (unsigned int)frame->address, (unsigned int)frame->command);
+    else
+        snprintf(code, sizeof(code), "raw");
+
+    char gap[24];
+    if (frame->gap_us > 0)
+        snprintf(gap, sizeof(gap), "gap %u.%u ms", frame->gap_us / 1000, (frame->gap_us % 1000) / 100);
+    else
+        snprintf(gap, sizeof(gap), "cut");
+
+    snprintf(out, out_sz, "#%u %s%s\n%d edges  %u.%u ms  %s  pulse %u-%u us",
+             frame->seq, code, frame->repeat ? "  (repeat)" : "",
+             frame->count, frame->duration_us / 1000, (frame->duration_us % 1000) / 100, gap,
+             frame->min_pulse_us, frame->max_pulse_us);
+}
+
+// Newest on top; past SNIFFER_MAX_ROWS the bottom label is moved up instead of creating one.
+static void sniffer_add_row(const ir_monitor_frame *frame)
+{
+    lv_obj_t *row;
+    if (g_sniffer.row_count < SNIFFER_MAX_ROWS) {
+        row = lv_label_create(g_sniffer.rows);
+        lv_label_set_long_mode(row, LV_LABEL_LONG_WRAP);
+        lv_obj_set_width(row, LV_PCT(100));
+        g_sniffer.row_count++;
+    } else {
+        row = lv_obj_get_child(g_sniffer.rows, -1);
+    }
+
+    char text[160];
+    sniffer_format_frame(frame, text, sizeof(text));
+    lv_label_set_text(row, text);
+    lv_obj_set_style_text_color(row, frame->protocol != IR_PROTO_NONE ? ZV_COLOR_TEXT_MAIN : ZV_COLOR_BORDER, 0);
+    lv_obj_move_to_index(row, 0);
+}
+
+static void sniffer_poll_timer_cb(lv_timer_t *timer)
+{
+    (void)timer;
+
+    ir_monitor_frame frame;
+    for (int i = 0; i < SNIFFER_FRAMES_PER_TICK && ir_controller_monitor_poll(&frame); i++)
+        sniffer_add_row(&frame);
+
+    ir_monitor_stats stats;
+    ir_controller_monitor_stats(&stats);
+
+    char text[160];
+    if (!stats.running && stats.status != IR_OK) {
+        lv_timer_pause(g_sniffer.poll_timer);
+        lv_obj_clear_state(g_sniffer.toggle, LV_STATE_CHECKED);
+        snprintf(text, sizeof(text), "Stopped: %s", stats.message);
+        sniffer_set_counters(text, ZV_COLOR_ERROR);
+        return;
+    }
+
+    snprintf(text, sizeof(text), "Frames: %u  Dropped: %u", stats.frames, stats.dropped);
+    sniffer_set_counters(text, stats.dropped > 0 ? ZV_COLOR_ERROR : ZV_COLOR_TEXT_MAIN);
+}
+
+static void sniffer_toggle_cb(lv_event_t *e)
+{
+    lv_obj_t *sw = (lv_obj_t *)lv_event_get_target(e);
+    if (!sw)
+        return;
+
+    if (!lv_obj_has_state(sw, LV_STATE_CHECKED)) {
+        ir_controller_monitor_stop();
+        lv_timer_pause(g_sniffer.poll_timer);
+        // Frames queued before the stop are still shown.
+        sniffer_poll_timer_cb(g_sniffer.poll_timer);
+        return;
+    }
+
+    if (ir_controller_monitor_start() != IR_OK) {
+        lv_obj_clear_state(sw, LV_STATE_CHECKED);
+        sniffer_set_counters(ir_controller_last_error(), ZV_COLOR_ERROR);
+        return;
+    }
+
+    lv_obj_clean(g_sniffer.rows);
+    g_sniffer.row_count = 0;
+    sniffer_set_counters("Listening... point a remote at the receiver.", ZV_COLOR_TEXT_MAIN);
+    lv_timer_resume(g_sniffer.poll_timer);
+}
+
+lv_obj_t *ir_sniffer_page_create(lv_obj_t *menu)
+{
+    lv_obj_t *page = lv_menu_page_create(menu, "IR Monitor");
+    lv_obj_set_scrollbar_mode(page, LV_SCROLLBAR_MODE_OFF);
+
+    memset(&g_sniffer, 0, sizeof(g_sniffer));
+    g_sniffer.page = page;
+
+    lv_obj_t *root = lv_obj_create(page);
+    lv_obj_set_size(root, LV_PCT(100), LV_PCT(100));
+    lv_obj_set_style_bg_opa(root, LV_OPA_TRANSP, 0);
+    lv_obj_set_style_border_width(root, 0, 0);
+    lv_obj_set_style_pad_all(root, 12, 0);
+    lv_obj_clear_flag(root, LV_OBJ_FLAG_SCROLLABLE);
+
+    lv_obj_set_layout(root, LV_LAYOUT_FLEX);
+    lv_obj_set_flex_flow(root, LV_FLEX_FLOW_COLUMN);
+    lv_obj_set_style_pad_row(root, 10, 0);
+
+    lv_obj_t *header_row = create_transparent_flex_row(root, LV_PCT(100), 30);
+    create_section_label(header_row, "Listen continuously");
+    g_sniffer.toggle = lv_switch_create(header_row);
+    lv_obj_add_event_cb(g_sniffer.toggle, sniffer_toggle_cb, LV_EVENT_VALUE_CHANGED, NULL);
+
+    g_sniffer.counters = lv_label_create(root);
+    lv_label_set_text(g_sniffer.counters, "Needs the lircdev backend.");
+    lv_obj_set_style_text_color(g_sniffer.counters, ZV_COLOR_TEXT_MAIN, 0);
+    lv_label_set_long_mode(g_sniffer.counters, LV_LABEL_LONG_WRAP);
+    lv_obj_set_width(g_sniffer.counters, LV_PCT(100));
+
+    g_sniffer.rows = lv_obj_create(root);
+    lv_obj_set_width(g_sniffer.rows, LV_PCT(100));
+    lv_obj_set_flex_grow(g_sniffer.rows, 1);
+    lv_obj_set_style_bg_color(g_sniffer.rows, ZV_COLOR_BG_PANEL, 0);
+    lv_obj_set_style_bg_opa(g_sniffer.rows, LV_OPA_COVER, 0);
+    lv_obj_set_style_border_width(g_sniffer.rows, 2, 0);
+    lv_obj_set_style_border_color(g_sniffer.rows, ZV_COLOR_BORDER, 0);
+    lv_obj_set_style_radius(g_sniffer.rows, 12, 0);
+    lv_obj_set_style_pad_all(g_sniffer.rows, 8, 0);
+    lv_obj_set_layout(g_sniffer.rows, LV_LAYOUT_FLEX);
+    lv_obj_set_flex_flow(g_sniffer.rows, LV_FLEX_FLOW_COLUMN);
+    lv_obj_set_style_pad_row(g_sniffer.rows, 6, 0);
+
+    g_sniffer.poll_timer = lv_timer_create(sniffer_poll_timer_cb, SNIFFER_POLL_PERIOD_MS, NULL);
+    lv_timer_pause(g_sniffer.poll_timer);
+
+    return page;
+}
+
+void ir_sniffer_page_destroy(void)
+{
+    // rx_dev is only held while the page exists.
+    ir_controller_monitor_stop();
+    if (g_sniffer.poll_timer)
+        lv_timer_delete(g_sniffer.poll_timer);
+    if (g_sniffer.page)
+        lv_obj_del(g_sniffer.page);
+
+    memset(&g_sniffer, 0, sizeof(g_sniffer));
+}
@@ -0,0 +1,17 @@
+#ifndef IR_SNIFFER_H
+#define IR_SNIFFER_H
+
+#include "lvgl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+lv_obj_t *ir_sniffer_page_create(lv_obj_t *menu);
+void ir_sniffer_page_destroy(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* IR_SNIFFER_H */
@@ -0,0 +1,403 @@
+#include "page/ir/waveform.h"
+#include "components/component_helper.h"
+#include "components/ui_theme.h"
+#include "page/base_view.h"
+#include "page/ir/ir_controller.h"
+#include "page/ir/ir_waveform.h"
+#include "service/ir_protocol.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#define WAVE_HEIGHT 110
+#define WAVE_MAX_COLUMNS 480        // wider than any panel the app runs on
+#define WAVE_MIN_SPAN_US 400        // deepest zoom, around 1 µs per pixel
+#define WAVE_MARGIN 12              // between the levels and the frame
+
+typedef struct {
+    base_view base;
+    lv_obj_t *remote_dropdown;
+    lv_obj_t *capture_dropdown;
+    lv_obj_t *wave;
+    lv_obj_t *info;
+
+    ir_signal signal;
+    ir_waveform waveform;           // indexes signal.durations
+    uint64_t view_start_us;
+    uint64_t view_span_us;
+    ir_waveform_column columns[WAVE_MAX_COLUMNS];
+} waveform_ui_t;
+
+static waveform_ui_t g_wave;
+
+static lv_obj_t *wave_create_dropdown_box(lv_obj_t *parent, lv_coord_t width)
+{
+    lv_obj_t *obj = lv_dropdown_create(parent);
+    lv_obj_set_width(obj, width);
+    lv_obj_set_height(obj, 40);
+    lv_obj_set_style_bg_color(obj, ZV_COLOR_BG_PANEL, 0);
+    lv_obj_set_style_bg_opa(obj, LV_OPA_COVER, 0);
+    lv_obj_set_style_border_width(obj, 2, 0);
+    lv_obj_set_style_border_color(obj, ZV_COLOR_BORDER, 0);
+    lv_obj_set_style_radius(obj, 10, 0);
+    lv_obj_set_style_text_color(obj, ZV_COLOR_TEXT_MAIN, 0);
+    lv_obj_set_style_pad_left(obj, 10, 0);
+
+    return obj;
+}
+
+static void wave_set_info(const char *txt, lv_color_t color)
+{
+    if (!g_wave.info)
+        return;
+
+    lv_label_set_text(g_wave.info, txt);
+    lv_obj_set_style_text_color(g_wave.info, color, 0);
+}
+
+static void wave_release_signal(void)
+{
+    ir_waveform_free(&g_wave.waveform);
+    ir_signal_free(&g_wave.signal);
+    g_wave.view_start_us = 0;
+    g_wave.view_span_us = 0;
+}
+
+static void wave_clamp_view(void)
+{
+    uint64_t total = g_wave.waveform.total_us;
+    uint64_t min_span = total < WAVE_MIN_SPAN_US ? total : WAVE_MIN_SPAN_US;
+
+    if (g_wave.view_span_us < min_span)
+        g_wave.view_span_us = min_span;
+    if (g_wave.view_span_us > total)
+        g_wave.view_span_us = total;
+    if (g_wave.view_start_us > total - g_wave.view_span_us)
+        g_wave.view_start_us = total - g_wave.view_span_us;
+}
+
+static void wave_update_info(const char *capture)
+{
+    const ir_signal *signal = &g_wave.signal;
+    uint32_t min_pulse = UINT32_MAX;
+    uint32_t max_pulse = 0;
+    for (int i = 0; i < signal->count; i += 2) {
+        if (signal->durations[i] < min_pulse)
+            min_pulse = signal->durations[i];
+        if (signal->durations[i] > max_pulse)
+            max_pulse = signal->durations[i];
+    }
+
+    char code[64] = "";
+    ir_decoded decoded;
+    if (ir_protocol_decode(signal->durations, signal->count, &decoded))
+        snprintf(code, sizeof(code), "  %s 0x%X/0x%X", ir_protocol_name(decoded.protocol),
+                 (unsigned int)decoded.address, (unsigned int)decoded.command);
+
+    int32_t width = lv_obj_get_content_width(g_wave.wave);
+    uint64_t us_per_px = width > 0 ? g_wave.view_span_us / (uint64_t)width : 0;
+
+    char text[IR_MAX_NAME + 192];
+    snprintf(text, sizeof(text), "%s%s\n%d edges  %llu.%llu ms  pulse %u-%u us\nView %llu-%llu ms, %llu us/px",
+             capture, code, signal->count,
+             (unsigned long long)(g_wave.waveform.total_us / 1000),
+             (unsigned long long)(g_wave.waveform.total_us % 1000 / 100),
+             min_pulse, max_pulse,
+             (unsigned long long)(g_wave.view_start_us / 1000),
+             (unsigned long long)((g_wave.view_start_us + g_wave.view_span_us) / 1000),
+             (unsigned long long)us_per_px);
+    wave_set_info(text, ZV_COLOR_TEXT_MAIN);
+}
+
+static void wave_view_changed(void)
+{
+    char capture[IR_MAX_NAME];
+
+    wave_clamp_view();
+    lv_dropdown_get_selected_str(g_wave.capture_dropdown, capture, sizeof(capture));
+    wave_update_info(capture);
+    lv_obj_invalidate(g_wave.wave);
+}
+
+static void wave_draw_run(lv_layer_t *layer, const lv_area_t *area, int32_t x1, int32_t x2, int kind)
+{
+    int32_t y_high = area->y1 + WAVE_MARGIN;
+    int32_t y_low = area->y2 - WAVE_MARGIN;
+
+    // Columns with an edge fill from low to high: one edge reads as a vertical line, a burst as a block.
+    if (kind == 2) {
+        lv_draw_rect_dsc_t rect;
+        lv_draw_rect_dsc_init(&rect);
+        rect.bg_color = ZV_COLOR_TERMINAL;
+        rect.bg_opa = LV_OPA_COVER;
+
+        lv_area_t block = { x1, y_high, x2, y_low };
+        lv_draw_rect(layer, &rect, &block);
+        return;
+    }
+
+    lv_draw_line_dsc_t line;
+    lv_draw_line_dsc_init(&line);
+    line.color = ZV_COLOR_TERMINAL;
+    line.width = 2;
+    line.p1.x = x1;
+    line.p2.x = x2 + 1;
+    line.p1.y = line.p2.y = kind == 1 ? y_high : y_low;
+    lv_draw_line(layer, &line);
+}
+
+/*
+ * The whole trace is drawn here, from the decimated columns: flat columns
+ * are merged into one line per run, so a frame costs a few hundred draw
+ * calls at most whatever its number of edges.
+ */
+static void wave_draw_cb(lv_event_t *e)
+{
+    if (g_wave.signal.count <= 0 || g_wave.view_span_us == 0)
+        return;
+
+    lv_layer_t *layer = lv_event_get_layer(e);
+    lv_area_t area;
+    lv_obj_get_content_coords(g_wave.wave, &area);
+
+    int width = (int)(area.x2 - area.x1 + 1);
+    if (width > WAVE_MAX_COLUMNS)
+        width = WAVE_MAX_COLUMNS;
+    if (width <= 0)
+        return;
+
+    ir_waveform_decimate(&g_wave.waveform, g_wave.view_start_us, g_wave.view_span_us, g_wave.columns, width);
+
+    int run_start = 0;
+    int run_kind = -1;
+    for (int c = 0; c <= width; c++) {
+        int kind = -1;
+        if (c < width)
+            kind = g_wave.columns[c].min == g_wave.columns[c].max ? g_wave.columns[c].max : 2;
+
+        if (kind == run_kind)
+            continue;
+
+        if (run_kind >= 0)
+            wave_draw_run(layer, &area, area.x1 + run_start, area.x1 + c - 1, run_kind);
+        run_start = c;
+        run_kind = kind;
+    }
+}
+
+static void wave_pressing_cb(lv_event_t *e)
+{
+    (void)e;
+
+    int32_t width = lv_obj_get_content_width(g_wave.wave);
+    if (g_wave.signal.count <= 0 || width <= 0)
+        return;
+
+    lv_point_t vect;
+    lv_indev_get_vect(lv_indev_active(), &vect);
+    if (vect.x == 0)
+        return;
+
+    // Dragging right shows earlier time.
+    uint64_t delta = (uint64_t)(vect.x < 0 ? -vect.x : vect.x) * g_wave.view_span_us / (uint64_t)width;
+    if (vect.x > 0)
+        g_wave.view_start_us = delta > g_wave.view_start_us ? 0 : g_wave.view_start_us - delta;
+    else
+        g_wave.view_start_us += delta;
+
+    wave_view_changed();
+}
+
+static void wave_zoom(bool in)
+{
+    if (g_wave.signal.count <= 0)
+        return;
+
+    uint64_t center = g_wave.view_start_us + g_wave.view_span_us / 2;
+    g_wave.view_span_us = in ? g_wave.view_span_us / 2 : g_wave.view_span_us * 2;
+    if (g_wave.view_span_us < WAVE_MIN_SPAN_US)
+        g_wave.view_span_us = WAVE_MIN_SPAN_US;
+
+    g_wave.view_start_us = center > g_wave.view_span_us / 2 ? center - g_wave.view_span_us / 2 : 0;
+    wave_view_changed();
+}
+
+static void wave_zoom_in_cb(lv_event_t *e)
+{
+    (void)e;
+    wave_zoom(true);
+}
+
+static void wave_zoom_out_cb(lv_event_t *e)
+{
+    (void)e;
+    wave_zoom(false);
+}
+
+static void wave_fit_cb(lv_event_t *e)
+{
+    (void)e;
+    if (g_wave.signal.count <= 0)
+        return;
+
+    g_wave.view_start_us = 0;
+    g_wave.view_span_us = g_wave.waveform.total_us;
+    wave_view_changed();
+}
+
+static void capture_changed_cb(lv_event_t *e)
+{
+    char remote[IR_MAX_NAME];
+    char capture[IR_MAX_NAME];
+
+    (void)e;
+    wave_release_signal();
+    lv_obj_invalidate(g_wave.wave);
+
+    lv_dropdown_get_selected_str(g_wave.remote_dropdown, remote, sizeof(remote));
+    lv_dropdown_get_selected_str(g_wave.capture_dropdown, capture, sizeof(capture));
+    if (!remote[0] || !capture[0])
+        return;
+
+    if (ir_controller_load_capture(remote, capture, &g_wave.signal) != IR_OK) {
+        wave_set_info(ir_controller_last_error(), ZV_COLOR_WARNING);
+        return;
+    }
+
+    if (ir_waveform_init(&g_wave.waveform, g_wave.signal.durations, g_wave.signal.count) != 0) {
+        ir_signal_free(&g_wave.signal);
+        wave_set_info("Capture is empty or unreadable", ZV_COLOR_WARNING);
+        return;
+    }
+
+    g_wave.view_start_us = 0;
+    g_wave.view_span_us = g_wave.waveform.total_us;
+    wave_view_changed();
+}
+
+static void load_capture_dropdown(void)
+{
+    char remote[IR_MAX_NAME];
+    char opts[2048];
+    ir_button_list captures = {0};
+
+    opts[0] = '\0';
+    lv_dropdown_get_selected_str(g_wave.remote_dropdown, remote, sizeof(remote));
+    if (!remote[0] || ir_controller_list_captures(remote, &captures) != IR_OK || captures.count == 0) {
+        lv_dropdown_set_options(g_wave.capture_dropdown, "");
+        wave_release_signal();
+        lv_obj_invalidate(g_wave.wave);
+        wave_set_info("No captures for this remote.", ZV_COLOR_WARNING);
+        ir_controller_free_button_list(&captures);
+        return;
+    }
+
+    for (size_t i = 0; i < captures.count; i++) {
+        strncat(opts, captures.buttons[i].name, sizeof(opts) - strlen(opts) - 1);
+        if (i + 1 < captures.count)
+            strncat(opts, "\n", sizeof(opts) - strlen(opts) - 1);
+    }
+
+    lv_dropdown_set_options(g_wave.capture_dropdown, opts);
+    lv_dropdown_set_selected(g_wave.capture_dropdown, 0);
+    ir_controller_free_button_list(&captures);
+
+    capture_changed_cb(NULL);
+}
+
+static void remote_changed_cb(lv_event_t *e)
+{
+    (void)e;
+    load_capture_dropdown();
+}
+
+static void load_remote_dropdown(void)
+{
+    ir_remote_list remotes = {0};
+    char opts[2048];
+
+    opts[0] = '\0';
+    if (ir_controller_list_remotes(&remotes) != IR_OK || remotes.count == 0) {
+        lv_dropdown_set_options(g_wave.remote_dropdown, "");
+        lv_dropdown_set_options(g_wave.capture_dropdown, "");
+        wave_set_info("No remotes available.", ZV_COLOR_WARNING);
+        ir_controller_free_remote_list(&remotes);
+        return;
+    }
+
+    for (size_t i = 0; i < remotes.count; i++) {
+        strncat(opts, remotes.remotes[i].name, sizeof(opts) - strlen(opts) - 1);
+        if (i + 1 < remotes.count)
+            strncat(opts, "\n", sizeof(opts) - strlen(opts) - 1);
+    }
+
+    lv_dropdown_set_options(g_wave.remote_dropdown, opts);
+    lv_dropdown_set_selected(g_wave.remote_dropdown, 0);
+    ir_controller_free_remote_list(&remotes);
+
+    load_capture_dropdown();
+}
+
+static void wave_refresh_cb(lv_event_t *e)
+{
+    (void)e;
+    load_remote_dropdown();
+}
+
+lv_obj_t *ir_waveform_page_create(lv_obj_t *menu)
+{
+    base_view *view;
+
+    memset(&g_wave, 0, sizeof(g_wave));
+
+    view = zv_view_create(&g_wave.base, menu, "Waveform");
+    if (!view)
+        return NULL;
+
+    g_wave.base.set_flex_layout(&g_wave.base, LV_FLEX_FLOW_COLUMN, 12, 10);
+    lv_obj_t *root = g_wave.base.root;
+
+    lv_obj_t *remote_row = create_transparent_flex_row(root, LV_PCT(100), 45);
+    g_wave.remote_dropdown = wave_create_dropdown_box(remote_row, LV_PCT(80));
+    lv_obj_add_event_cb(g_wave.remote_dropdown, remote_changed_cb, LV_EVENT_VALUE_CHANGED, NULL);
+    create_icon_button(remote_row, LV_SYMBOL_REFRESH, 45, 35, wave_refresh_cb, NULL);
+
+    g_wave.capture_dropdown = wave_create_dropdown_box(root, LV_PCT(100));
+    lv_obj_add_event_cb(g_wave.capture_dropdown, capture_changed_cb, LV_EVENT_VALUE_CHANGED, NULL);
+
+    // One plain object; the trace is drawn in its DRAW_MAIN handler, not built from children.
+    g_wave.wave = lv_obj_create(root);
+    lv_obj_set_size(g_wave.wave, LV_PCT(100), WAVE_HEIGHT);
+    lv_obj_set_style_bg_color(g_wave.wave, ZV_COLOR_BG_PANEL, 0);
+    lv_obj_set_style_bg_opa(g_wave.wave, LV_OPA_COVER, 0);
+    lv_obj_set_style_border_width(g_wave.wave, 2, 0);
+    lv_obj_set_style_border_color(g_wave.wave, ZV_COLOR_BORDER, 0);
+    lv_obj_set_style_radius(g_wave.wave, 12, 0);
+    lv_obj_set_style_pad_all(g_wave.wave, 4, 0);
+    lv_obj_clear_flag(g_wave.wave, LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_clear_flag(g_wave.wave, LV_OBJ_FLAG_SCROLL_CHAIN);
+    lv_obj_add_event_cb(g_wave.wave, wave_draw_cb, LV_EVENT_DRAW_MAIN, NULL);
+    lv_obj_add_event_cb(g_wave.wave, wave_pressing_cb, LV_EVENT_PRESSING, NULL);
+
+    lv_obj_t *zoom_row = create_transparent_flex_row(root, LV_PCT(100), 45);
+    create_icon_button(zoom_row, LV_SYMBOL_MINUS, 60, 35, wave_zoom_out_cb, NULL);
+    create_icon_button(zoom_row, "Fit", 60, 35, wave_fit_cb, NULL);
+    create_icon_button(zoom_row, LV_SYMBOL_PLUS, 60, 35, wave_zoom_in_cb, NULL);
+
+    g_wave.info = lv_label_create(root);
+    lv_label_set_text(g_wave.info, "");
+    lv_label_set_long_mode(g_wave.info, LV_LABEL_LONG_WRAP);
+    lv_obj_set_width(g_wave.info, LV_PCT(100));
+
+    load_remote_dropdown();
+    return g_wave.base.page;
+}
+
+void ir_waveform_page_destroy(void)
+{
+    wave_release_signal();
+    if (g_wave.base.page)
+        lv_obj_del(g_wave.base.page);
+
+    memset(&g_wave, 0, sizeof(g_wave));
+}
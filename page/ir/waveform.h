@@ -0,0 +1,17 @@
+#ifndef IR_WAVEFORM_VIEW_H
+#define IR_WAVEFORM_VIEW_H
+
+#include "lvgl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+lv_obj_t *ir_waveform_page_create(lv_obj_t *menu);
+void ir_waveform_page_destroy(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* IR_WAVEFORM_VIEW_H */
@@ -0,0 +1,197 @@
+#!/usr/bin/env python3
+"""
+Generates page/bt/bt_assigned_numbers.c from the Bluetooth SIG assigned
+numbers repository (https://bitbucket.org/bluetooth-SIG/public).
+
+    git clone https://bitbucket.org/bluetooth-SIG/public.git /tmp/sig
+    python3 scripts/gen_bt_assigned_numbers.py /tmp/sig > page/bt/bt_assigned_numbers.c
+
+Needs PyYAML. Tables are emitted sorted by key with names stored as offsets
+into a single string pool (see page/bt/bt_assigned_numbers.h).
+
+The checked-in file was generated from a trimmed snapshot (the entries the
+UI is likely to meet); its header lists how many entries each table holds.
+Run this against a full checkout to get every company ID and UUID.
+"""
+
+import os
+import sys
+
+import yaml
+
+# Names shown on the 320px detail page. SIG names are kept for everything else.
+SHORT_NAMES = {
+    "service": {
+        0x1800: "GAP",
+        0x1801: "GATT",
+        0x180A: "Device Info",
+        0x180F: "Battery",
+        0x1812: "HID",
+        0x1816: "Cycling Speed",
+        0x181A: "Environmental",
+    },
+    "characteristic": {
+        0x2A19: "Battery Lvl",
+        0x2A24: "Model Number",
+        0x2A25: "Serial Number",
+        0x2A26: "Firmware Rev",
+        0x2A27: "Hardware Rev",
+        0x2A28: "Software Rev",
+        0x2A29: "Manufacturer",
+        0x2A37: "HR Meas.",
+        0x2A38: "Body Loc.",
+        0x2A4D: "HID Report",
+    },
+    "descriptor": {
+        0x2902: "CCCD",
+    },
+}
+
+# Well-known vendor 128-bit UUIDs. The SIG does not publish these.
+VENDOR_UUIDS = [
+    ("6E400001-B5A3-F393-E0A9-E50E24DCCA9E", "Nordic UART"),
+    ("6E400002-B5A3-F393-E0A9-E50E24DCCA9E", "Nordic UART RX"),
+    ("6E400003-B5A3-F393-E0A9-E50E24DCCA9E", "Nordic UART TX"),
+    ("00001530-1212-EFDE-1523-785FEABCD123", "Nordic Legacy DFU"),
+    ("00001531-1212-EFDE-1523-785FEABCD123", "Nordic DFU Control"),
+    ("00001532-1212-EFDE-1523-785FEABCD123", "Nordic DFU Packet"),
+    ("8EC90001-F315-4F60-9FB8-838830DAEA50", "Buttonless DFU"),
+    ("7905F431-B5CE-4E99-A40F-4B1E122D00D0", "Apple ANCS"),
+    ("9FBF120D-6301-42D9-8C58-25E699A21DBD", "ANCS Notif. Source"),
+    ("69D1D8F3-45E1-49A8-9821-9BBDFDAAD9D9", "ANCS Control Point"),
+    ("22EAC6E9-24D6-4BB5-BE44-B36ACE7C7BFB", "ANCS Data Source"),
+    ("89D3502B-0F36-433A-8EF4-C502AD55F8DC", "Apple Media Service"),
+    ("D0611E78-BBB4-4591-A5F8-487910AE4366", "Apple Continuity"),
+    ("8667556C-9A37-4C91-84ED-54EE27D90049", "Continuity Char."),
+    ("9FA480E0-4967-4542-9390-D343DC5D04AE", "Apple Nearby"),
+    ("AF0BADB1-5B99-43CD-917A-A77BC549E3CC", "Nearby Char."),
+]
+
+
+def load(root, *parts):
+    with open(os.path.join(root, *parts), "r", encoding="utf-8") as f:
+        return yaml.safe_load(f)
+
+
+def as_int(value):
+    return value if isinstance(value, int) else int(str(value), 0)
+
+
+def uuid16_table(doc, kind):
+    overrides = SHORT_NAMES.get(kind, {})
+    table = {}
+    for entry in doc["uuids"]:
+        key = as_int(entry["uuid"])
+        table[key] = overrides.get(key, entry["name"].strip())
+    return table
+
+
+def company_table(doc):
+    return {as_int(e["value"]): e["name"].strip() for e in doc["company_identifiers"]}
+
+
+def appearance_table(doc):
+    table = {}
+    for cat in doc["appearance_values"]:
+        category = as_int(cat["category"])
+        table[category << 6] = cat["name"].strip()
+        for sub in cat.get("subcategory", []) or []:
+            table[(category << 6) | as_int(sub["value"])] = sub["name"].strip()
+    return table
+
+
+def uuid_bytes(text):
+    raw = bytes.fromhex(text.replace("-", ""))
+    if len(raw) != 16:
+        raise ValueError("bad 128-bit uuid: %s" % text)
+    return raw
+
+
+class Pool:
+    def __init__(self):
+        self.data = bytearray()
+        self.offsets = {}
+
+    def add(self, text):
+        if text not in self.offsets:
+            self.offsets[text] = len(self.data)
+            self.data += text.encode("utf-8") + b"\0"
+        return self.offsets[text]
+
+    def emit(self, out):
+        out.append("const char bt_an_names[] =")
+        line = ""
+        for text in self.offsets:
+            piece = text.replace("\\", "\\\\").replace('"', '\\"') + "\\000"
+            if len(line) + len(piece) > 90:
+                out.append('    "%s"' % line)
+                line = ""
+            line += piece
+        if line:
+            out.append('    "%s"' % line)
+        out.append("    ;")
+        out.append("")
+
+
+def emit_table16(out, pool, symbol, table):
+    out.append("const bt_an_entry16_t %s[] = {" % symbol)
+    for key in sorted(table):
+        out.append("    { 0x%04X, %6d }, // %s" % (key, pool.add(table[key]), table[key]))
+    out.append("};")
+    out.append("const size_t %s_count = sizeof(%s) / sizeof(%s[0]);" % (symbol, symbol, symbol))
+    out.append("")
+
+
+def emit_table128(out, pool, symbol, entries):
+    out.append("const bt_an_entry128_t %s[] = {" % symbol)
+    for raw, name in sorted(entries):
+        data = ", ".join("0x%02X" % b for b in raw)
+        out.append("    { { %s }, %d }, // %s" % (data, pool.add(name), name))
+    out.append("};")
+    out.append("const size_t %s_count = sizeof(%s) / sizeof(%s[0]);" % (symbol, symbol, symbol))
+    out.append("")
+
+
+def main(argv):
+    if len(argv) != 2:
+        sys.stderr.write("usage: %s <bluetooth-SIG/public checkout>\n" % argv[0])
+        return 1
+
+    root = argv[1]
+    uuids = ("assigned_numbers", "uuids")
+
+    tables = [
+        ("bt_an_services", uuid16_table(load(root, *uuids, "service_uuids.yaml"), "service")),
+        ("bt_an_characteristics", uuid16_table(load(root, *uuids, "characteristic_uuids.yaml"), "characteristic")),
+        ("bt_an_descriptors", uuid16_table(load(root, *uuids, "descriptors.yaml"), "descriptor")),
+        ("bt_an_member_services", uuid16_table(load(root, *uuids, "member_uuids.yaml"), "member")),
+        ("bt_an_companies", company_table(load(root, "assigned_numbers", "company_identifiers",
+                                               "company_identifiers.yaml"))),
+        ("bt_an_appearances", appearance_table(load(root, "assigned_numbers", "core",
+                                                    "appearance_values.yaml"))),
+    ]
+    vendor = [(uuid_bytes(u), name) for u, name in VENDOR_UUIDS]
+
+    pool = Pool()
+    body = []
+    for symbol, table in tables:
+        emit_table16(body, pool, symbol, table)
+    emit_table128(body, pool, "bt_an_vendor_uuids", vendor)
+
+    counts = ", ".join("%d %s" % (len(table), symbol[len("bt_an_"):]) for symbol, table in tables)
+    out = [
+        "// Generated by scripts/gen_bt_assigned_numbers.py. Do not edit by hand.",
+        "// Entries: %s, %d vendor_uuids." % (counts, len(vendor)),
+        "",
+        '#include "bt_assigned_numbers.h"',
+        "",
+    ]
+    pool.emit(out)
+    out.extend(body)
+
+    sys.stdout.write("\n".join(out).rstrip() + "\n")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
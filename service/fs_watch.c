@@ -0,0 +1,299 @@
+#include "service/fs_watch.h"
+#include "utils/file.h"
+#include "utils/logger.h"
+
+#include <dirent.h>
+#include <errno.h>
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+
+#define FS_WATCH_MASK (IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO | IN_CLOSE_WRITE | IN_ONLYDIR)
+#define FS_WATCH_READ_BUF 4096
+
+typedef struct {
+    bool active;
+    int depth;
+    fs_watch_cb cb;
+    void *user_data;
+} subscription;
+
+// One per watched directory; the same directory may appear once per subscription.
+typedef struct {
+    int wd;
+    int sub;
+    int level;              // 0 for the subscribed path
+    char path[PATH_MAX];
+} watch_entry;
+
+static struct {
+    int fd;
+    subscription subs[FS_WATCH_MAX_SUBSCRIPTIONS];
+    watch_entry *watches;
+    size_t count;
+    size_t capacity;
+} fsw = { -1, {}, NULL, 0, 0 };
+
+static watch_entry *find_watch(int wd, int sub)
+{
+    for (size_t i = 0; i < fsw.count; i++)
+    {
+        if (fsw.watches[i].wd == wd && fsw.watches[i].sub == sub)
+            return &fsw.watches[i];
+    }
+
+    return NULL;
+}
+
+static bool wd_in_use(int wd)
+{
+    for (size_t i = 0; i < fsw.count; i++)
+    {
+        if (fsw.watches[i].wd == wd)
+            return true;
+    }
+
+    return false;
+}
+
+static void add_tree(const char *path, int sub, int level)
+{
+    int wd = inotify_add_watch(fsw.fd, path, FS_WATCH_MASK);
+    if (wd < 0)
+    {
+        log_warning("[FS][watch]::add_tree %s errno=%d(%s)", path, errno, strerror(errno));
+        return;
+    }
+
+    if (!find_watch(wd, sub))
+    {
+        if (fsw.count == fsw.capacity)
+        {
+            size_t new_capacity = fsw.capacity ? fsw.capacity * 2 : 32;
+            watch_entry *grown = (watch_entry *)realloc(fsw.watches, new_capacity * sizeof(watch_entry));
+            if (!grown)
+                return;
+
+            fsw.watches = grown;
+            fsw.capacity = new_capacity;
+        }
+
+        watch_entry *entry = &fsw.watches[fsw.count++];
+        entry->wd = wd;
+        entry->sub = sub;
+        entry->level = level;
+        snprintf(entry->path, sizeof(entry->path), "%s", path);
+    }
+
+    if (level >= fsw.subs[sub].depth)
+        return;
+
+    DIR *dir = opendir(path);
+    if (!dir)
+        return;
+
+    struct dirent *ent;
+    while ((ent = readdir(dir)) != NULL)
+    {
+        if (ent->d_name[0] == '.')
+            continue;
+
+        char child[PATH_MAX];
+        if (snprintf(child, sizeof(child), "%s/%s", path, ent->d_name) >= (int)sizeof(child))
+            continue;
+
+        if (ent->d_type == DT_DIR || (ent->d_type == DT_UNKNOWN && file_is_directory(child)))
+            add_tree(child, sub, level + 1);
+    }
+
+    closedir(dir);
+}
+
+static void drop_watch(size_t index, bool rm_watch)
+{
+    int wd = fsw.watches[index].wd;
+    fsw.watches[index] = fsw.watches[--fsw.count];
+
+    if (rm_watch && !wd_in_use(wd))
+        inotify_rm_watch(fsw.fd, wd);
+}
+
+// Watches of `sub` on `path` and below, when a watched directory is removed or moved out.
+static void drop_tree(const char *path, int sub)
+{
+    size_t len = strlen(path);
+    size_t i = 0;
+    while (i < fsw.count)
+    {
+        const watch_entry *w = &fsw.watches[i];
+        bool under = strncmp(w->path, path, len) == 0 && (w->path[len] == '\0' || w->path[len] == '/');
+        if (under && w->sub == sub)
+            drop_watch(i, true);
+        else
+            i++;
+    }
+}
+
+int fs_watch_init(void)
+{
+    if (fsw.fd >= 0)
+        return 0;
+
+    fsw.fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (fsw.fd < 0)
+    {
+        log_error("[FS][watch]::fs_watch_init inotify_init1 errno=%d(%s)", errno, strerror(errno));
+        return -1;
+    }
+
+    return 0;
+}
+
+void fs_watch_deinit(void)
+{
+    if (fsw.fd >= 0)
+        close(fsw.fd);
+
+    free(fsw.watches);
+    memset(&fsw, 0, sizeof(fsw));
+    fsw.fd = -1;
+}
+
+int fs_watch_add(const char *path, int depth, fs_watch_cb cb, void *user_data)
+{
+    if (fsw.fd < 0 || !path || !path[0] || !cb || depth < 0)
+        return -1;
+
+    for (int i = 0; i < FS_WATCH_MAX_SUBSCRIPTIONS; i++)
+    {
+        if (fsw.subs[i].active)
+            continue;
+
+        fsw.subs[i].active = true;
+        fsw.subs[i].depth = depth;
+        fsw.subs[i].cb = cb;
+        fsw.subs[i].user_data = user_data;
+
+        char root[PATH_MAX];
+        snprintf(root, sizeof(root), "%s", path);
+        normalize_dir_path(root);
+        add_tree(root, i, 0);
+        log_debug("[FS][watch]::fs_watch_add %s depth=%d handle=%d watches=%d", path, depth, i, (int)fsw.count);
+        return i;
+    }
+
+    log_warning("[FS][watch]::fs_watch_add no free subscription for %s", path);
+    return -1;
+}
+
+void fs_watch_remove(int handle)
+{
+    if (handle < 0 || handle >= FS_WATCH_MAX_SUBSCRIPTIONS || !fsw.subs[handle].active)
+        return;
+
+    size_t i = 0;
+    while (i < fsw.count)
+    {
+        if (fsw.watches[i].sub == handle)
+            drop_watch(i, true);
+        else
+            i++;
+    }
+
+    memset(&fsw.subs[handle], 0, sizeof(fsw.subs[handle]));
+}
+
+static void dispatch(const struct inotify_event *ev)
+{
+    if (ev->mask & IN_Q_OVERFLOW)
+    {
+        fs_watch_event out = { FS_WATCH_OVERFLOW, "", "", false };
+        for (int s = 0; s < FS_WATCH_MAX_SUBSCRIPTIONS; s++)
+        {
+            if (fsw.subs[s].active)
+                fsw.subs[s].cb(&out, fsw.subs[s].user_data);
+        }
+        return;
+    }
+
+    // The kernel dropped the watch (directory deleted or unmounted).
+    if (ev->mask & IN_IGNORED)
+    {
+        size_t i = 0;
+        while (i < fsw.count)
+        {
+            if (fsw.watches[i].wd == ev->wd)
+                drop_watch(i, false);
+            else
+                i++;
+        }
+        return;
+    }
+
+    if (ev->len == 0)
+        return;
+
+    fs_watch_event out;
+    out.name = ev->name;
+    out.is_dir = (ev->mask & IN_ISDIR) != 0;
+    if (ev->mask & (IN_CREATE | IN_MOVED_TO))
+        out.type = FS_WATCH_ADDED;
+    else if (ev->mask & (IN_DELETE | IN_MOVED_FROM))
+        out.type = FS_WATCH_REMOVED;
+    else if (ev->mask & IN_CLOSE_WRITE)
+        out.type = FS_WATCH_MODIFIED;
+    else
+        return;
+
+    // Callbacks may add or remove subscriptions, so look the watch up per subscription.
+    for (int s = 0; s < FS_WATCH_MAX_SUBSCRIPTIONS; s++)
+    {
+        watch_entry *w = find_watch(ev->wd, s);
+        if (!w || !fsw.subs[s].active)
+            continue;
+
+        char dir[PATH_MAX];
+        char child[PATH_MAX];
+        int level = w->level;
+        snprintf(dir, sizeof(dir), "%s", w->path);
+
+        if (out.is_dir && snprintf(child, sizeof(child), "%s/%s", dir, ev->name) < (int)sizeof(child))
+        {
+            if (out.type == FS_WATCH_ADDED && level < fsw.subs[s].depth)
+                add_tree(child, s, level + 1);
+            else if (out.type == FS_WATCH_REMOVED)
+                drop_tree(child, s);
+        }
+
+        out.dir = dir;
+        fsw.subs[s].cb(&out, fsw.subs[s].user_data);
+    }
+}
+
+void fs_watch_process(void)
+{
+    if (fsw.fd < 0)
+        return;
+
+    char buf[FS_WATCH_READ_BUF] __attribute__((aligned(__alignof__(struct inotify_event))));
+    for (;;)
+    {
+        ssize_t len = read(fsw.fd, buf, sizeof(buf));
+        if (len <= 0)
+        {
+            if (len < 0 && errno != EAGAIN && errno != EINTR)
+                log_warning("[FS][watch]::fs_watch_process read errno=%d(%s)", errno, strerror(errno));
+            return;
+        }
+
+        for (char *p = buf; p < buf + len;)
+        {
+            const struct inotify_event *ev = (const struct inotify_event *)p;
+            dispatch(ev);
+            p += sizeof(struct inotify_event) + ev->len;
+        }
+    }
+}
@@ -0,0 +1,48 @@
+#ifndef FS_WATCH_H
+#define FS_WATCH_H
+
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define FS_WATCH_MAX_SUBSCRIPTIONS 8
+
+typedef enum {
+    FS_WATCH_ADDED,         // created or moved in
+    FS_WATCH_REMOVED,       // deleted or moved out
+    FS_WATCH_MODIFIED,      // a file closed after writing
+    FS_WATCH_OVERFLOW       // the kernel queue overflowed: events were lost, rescan once
+} fs_watch_event_type;
+
+typedef struct {
+    fs_watch_event_type type;
+    const char *dir;        // watched directory holding the entry, without trailing '/'
+    const char *name;       // entry name, "" for FS_WATCH_OVERFLOW
+    bool is_dir;
+} fs_watch_event;
+
+typedef void (*fs_watch_cb)(const fs_watch_event *event, void *user_data);
+
+/*
+ * One inotify instance for the whole app. fs_watch_process() is called from
+ * the main loop next to uart_process_loop(), so callbacks run on the UI thread.
+ */
+int fs_watch_init(void);
+void fs_watch_deinit(void);
+void fs_watch_process(void);
+
+/*
+ * Watches `path` and its subdirectories down to `depth` levels (0 = only
+ * `path`). Directories created later inside that range are watched as they
+ * appear. Returns a handle for fs_watch_remove(), or -1.
+ */
+int fs_watch_add(const char *path, int depth, fs_watch_cb cb, void *user_data);
+void fs_watch_remove(int handle);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FS_WATCH_H */
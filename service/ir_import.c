@@ -0,0 +1,633 @@
+#include "service/ir_import.h"
+#include "service/ir_protocol.h"
+#include "utils/file.h"
+
+#include <ctype.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define IMPORT_WORD_MAX         128
+#define IMPORT_DEFAULT_CARRIER  38000
+
+// lircd.conf "flags" bits this importer understands; anything else marks the remote unsupported.
+#define LIRCD_RAW_CODES         0x01
+#define LIRCD_SHIFT_ENC         0x02    // RC5 style bi-phase
+#define LIRCD_REVERSE           0x04
+#define LIRCD_UNSUPPORTED       0x80
+
+typedef struct {
+    FILE *fp;
+    long offset;
+} reader;
+
+typedef struct {
+    char name[IMPORT_WORD_MAX];
+    unsigned int flags;
+    int bits;
+    int pre_data_bits;
+    int post_data_bits;
+    uint64_t pre_data;
+    uint64_t post_data;
+    uint32_t header[2];
+    uint32_t one[2];
+    uint32_t zero[2];
+    uint32_t pre[2];
+    uint32_t post[2];
+    uint32_t plead;
+    uint32_t ptrail;
+    uint32_t frequency;
+    uint8_t duty_cycle;
+} lircd_remote;
+
+typedef struct {
+    ir_import_cb cb;
+    void *user_data;
+    ir_import_stats *stats;
+    const bool *cancel;
+    reader in;
+    bool stop;
+
+    // The one button being read; reused for the whole file.
+    char remote[IMPORT_WORD_MAX];
+    char button[IMPORT_WORD_MAX];
+    uint32_t durations[IR_SIGNAL_MAX_DURATIONS];
+    int count;
+    int values;                 // raw values read, their parity says pulse or space
+    bool overflow;
+} import_ctx;
+
+// Checked once per word, so skipped and unsupported remotes stop as fast as stored ones.
+static bool import_stopped(const import_ctx *ctx)
+{
+    return ctx->stop || (ctx->cancel && __atomic_load_n(ctx->cancel, __ATOMIC_ACQUIRE));
+}
+
+static int reader_getc(reader *r)
+{
+    int c = fgetc(r->fp);
+    if (c != EOF)
+        r->offset++;
+    return c;
+}
+
+static void reader_ungetc(reader *r, int c)
+{
+    if (c == EOF)
+        return;
+
+    ungetc(c, r->fp);
+    r->offset--;
+}
+
+// Consumes the rest of the line, newline included.
+static void skip_line(reader *r)
+{
+    int c;
+    while ((c = reader_getc(r)) != EOF && c != '\n')
+        ;
+}
+
+/*
+ * Next whitespace separated word, '#' comments skipped. With `same_line`
+ * it stops in front of the newline, so skip_line() is always safe after.
+ * Longer words are truncated.
+ */
+static bool read_word(reader *r, char *out, size_t out_sz, bool same_line)
+{
+    int c;
+    for (;;)
+    {
+        c = reader_getc(r);
+        if (c == EOF)
+            return false;
+
+        if (c == '#')
+        {
+            while ((c = reader_getc(r)) != EOF && c != '\n')
+                ;
+            reader_ungetc(r, c);
+            continue;
+        }
+
+        if (c == '\n' && same_line)
+        {
+            reader_ungetc(r, c);
+            return false;
+        }
+
+        if (!isspace(c))
+            break;
+    }
+
+    size_t n = 0;
+    while (c != EOF && !isspace(c))
+    {
+        if (n + 1 < out_sz)
+            out[n++] = (char)c;
+        c = reader_getc(r);
+    }
+    out[n] = '\0';
+
+    if (c == '\n')
+        reader_ungetc(r, c);
+    return true;
+}
+
+// Rest of the line without surrounding blanks; the newline stays for skip_line().
+static void read_rest_of_line(reader *r, char *out, size_t out_sz)
+{
+    int c;
+    while ((c = reader_getc(r)) == ' ' || c == '\t')
+        ;
+
+    size_t n = 0;
+    while (c != EOF && c != '\n')
+    {
+        if (n + 1 < out_sz)
+            out[n++] = (char)c;
+        c = reader_getc(r);
+    }
+    reader_ungetc(r, c);
+
+    while (n > 0 && isspace((unsigned char)out[n - 1]))
+        n--;
+    out[n] = '\0';
+}
+
+static bool parse_number(const char *word, uint64_t *out)
+{
+    char *end = NULL;
+    *out = strtoull(word, &end, 0);
+    return end != word && *end == '\0';
+}
+
+static void reset_button(import_ctx *ctx)
+{
+    ctx->button[0] = '\0';
+    ctx->count = 0;
+    ctx->values = 0;
+    ctx->overflow = false;
+}
+
+// Same merging as ir_signal_parse(): no leading space, same-kind values added up.
+static void push_duration(import_ctx *ctx, bool is_pulse, uint32_t value)
+{
+    if (value == 0 || (ctx->count == 0 && !is_pulse))
+        return;
+
+    if (ctx->count > 0 && (ctx->count % 2 == 1) == is_pulse)
+    {
+        ctx->durations[ctx->count - 1] += value;
+        return;
+    }
+
+    if (ctx->count == IR_SIGNAL_MAX_DURATIONS)
+    {
+        ctx->overflow = true;
+        return;
+    }
+
+    ctx->durations[ctx->count++] = value;
+}
+
+static void emit(import_ctx *ctx, const ir_signal *signal)
+{
+    ir_import_entry entry = { ctx->remote, ctx->button, signal, ctx->in.offset };
+    ctx->stats->buttons++;
+    if (!ctx->cb(&entry, ctx->user_data))
+        ctx->stop = true;
+}
+
+static void emit_decoded(import_ctx *ctx, const ir_decoded *code)
+{
+    ir_signal signal;
+    memset(&signal, 0, sizeof(signal));
+    signal.protocol = code->protocol;
+    signal.address = code->address;
+    signal.command = code->command;
+    emit(ctx, &signal);
+}
+
+// Durations collected for the current button: stored decoded when a protocol matches.
+static void emit_durations(import_ctx *ctx, uint32_t carrier, uint8_t duty_cycle)
+{
+    // The trailing gap is not sent, the kernel wants the frame to end in a pulse.
+    if (ctx->count % 2 == 0 && ctx->count > 0)
+        ctx->count--;
+
+    if (!ctx->remote[0] || !ctx->button[0] || ctx->overflow || ctx->count == 0)
+    {
+        ctx->stats->skipped++;
+        return;
+    }
+
+    ir_decoded code;
+    if (ir_protocol_decode(ctx->durations, ctx->count, &code))
+    {
+        emit_decoded(ctx, &code);
+        return;
+    }
+
+    ir_signal signal;
+    memset(&signal, 0, sizeof(signal));
+    signal.durations = ctx->durations;
+    signal.count = ctx->count;
+    signal.carrier = carrier ? carrier : IMPORT_DEFAULT_CARRIER;
+    signal.duty_cycle = duty_cycle;
+    emit(ctx, &signal);
+}
+
+/* ---------------- Flipper .ir ---------------- */
+
+typedef struct {
+    const char *name;
+    uint16_t protocol;
+    uint32_t address_max;
+    uint32_t command_max;
+} flipper_protocol;
+
+/*
+ * Flipper stores the same address/command fields as ir_protocol.h for
+ * these. Kaseikyo packs its fields differently and is left out.
+ */
+static const flipper_protocol flipper_protocols[] = {
+    { "NEC",        IR_PROTO_NEC,       0xFF,   0xFF },
+    { "NECext",     IR_PROTO_NECX,      0xFFFF, 0xFFFF },
+    { "Samsung32",  IR_PROTO_SAMSUNG,   0xFF,   0xFF },
+    { "SIRC",       IR_PROTO_SONY12,    0x1F,   0x7F },
+    { "SIRC15",     IR_PROTO_SONY15,    0xFF,   0x7F },
+    { "SIRC20",     IR_PROTO_SONY20,    0x1FFF, 0x7F },
+    { "RC5",        IR_PROTO_RC5,       0x1F,   0x3F },
+    { "RC5X",       IR_PROTO_RC5,       0x1F,   0x7F },
+    { "RC6",        IR_PROTO_RC6,       0xFF,   0xFF },
+};
+
+static bool flipper_code(const char *protocol, uint32_t address, uint32_t command, ir_decoded *out)
+{
+    for (size_t i = 0; i < sizeof(flipper_protocols) / sizeof(flipper_protocols[0]); i++)
+    {
+        const flipper_protocol *p = &flipper_protocols[i];
+        if (strcmp(p->name, protocol) != 0)
+            continue;
+
+        if (address > p->address_max || command > p->command_max)
+            return false;
+
+        // NECext sends a 16-bit command; only "command, ~command" fits IR_PROTO_NECX.
+        if (p->protocol == IR_PROTO_NECX && (command >> 8) != (~command & 0xFF))
+            return false;
+
+        out->protocol = p->protocol;
+        out->address = address;
+        out->command = p->protocol == IR_PROTO_NECX ? (command & 0xFF) : command;
+        if (strcmp(p->name, "RC5X") == 0)
+            out->command |= 0x40;
+        return true;
+    }
+
+    return false;
+}
+
+// "07 00 00 00": little-endian hex bytes.
+static uint32_t read_le_bytes(reader *r)
+{
+    char word[IMPORT_WORD_MAX];
+    uint32_t value = 0;
+    for (int i = 0; i < 4 && read_word(r, word, sizeof(word), true); i++)
+        value |= (uint32_t)(strtoul(word, NULL, 16) & 0xFF) << (8 * i);
+
+    return value;
+}
+
+typedef struct {
+    char type[IMPORT_WORD_MAX];
+    char protocol[IMPORT_WORD_MAX];
+    uint32_t address;
+    uint32_t command;
+    uint32_t frequency;
+    uint8_t duty_cycle;
+} flipper_button;
+
+static void flipper_flush(import_ctx *ctx, const flipper_button *fb)
+{
+    if (!ctx->button[0])
+        return;
+
+    if (strcmp(fb->type, "parsed") == 0)
+    {
+        ir_decoded code;
+        if (flipper_code(fb->protocol, fb->address, fb->command, &code))
+            emit_decoded(ctx, &code);
+        else
+            ctx->stats->skipped++;
+    }
+    else if (strcmp(fb->type, "raw") == 0)
+        emit_durations(ctx, fb->frequency, fb->duty_cycle);
+    else
+        ctx->stats->skipped++;
+}
+
+static void parse_flipper(import_ctx *ctx)
+{
+    char key[IMPORT_WORD_MAX];
+    char value[IMPORT_WORD_MAX];
+    flipper_button fb;
+    memset(&fb, 0, sizeof(fb));
+
+    while (!import_stopped(ctx) && read_word(&ctx->in, key, sizeof(key), false))
+    {
+        if (strcmp(key, "name:") == 0)
+        {
+            flipper_flush(ctx, &fb);
+            reset_button(ctx);
+            memset(&fb, 0, sizeof(fb));
+            read_rest_of_line(&ctx->in, ctx->button, sizeof(ctx->button));
+        }
+        else if (strcmp(key, "type:") == 0 && read_word(&ctx->in, value, sizeof(value), true))
+            snprintf(fb.type, sizeof(fb.type), "%s", value);
+        else if (strcmp(key, "protocol:") == 0 && read_word(&ctx->in, value, sizeof(value), true))
+            snprintf(fb.protocol, sizeof(fb.protocol), "%s", value);
+        else if (strcmp(key, "address:") == 0)
+            fb.address = read_le_bytes(&ctx->in);
+        else if (strcmp(key, "command:") == 0)
+            fb.command = read_le_bytes(&ctx->in);
+        else if (strcmp(key, "frequency:") == 0 && read_word(&ctx->in, value, sizeof(value), true))
+            fb.frequency = (uint32_t)strtoul(value, NULL, 10);
+        else if (strcmp(key, "duty_cycle:") == 0 && read_word(&ctx->in, value, sizeof(value), true))
+            fb.duty_cycle = (uint8_t)(strtod(value, NULL) * 100.0 + 0.5);
+        else if (strcmp(key, "data:") == 0)
+        {
+            // Pulse first, then alternating; a raw line can hold a thousand values.
+            uint64_t v;
+            while (read_word(&ctx->in, value, sizeof(value), true))
+            {
+                if (parse_number(value, &v))
+                    push_duration(ctx, ctx->values++ % 2 == 0, (uint32_t)v);
+            }
+        }
+
+        skip_line(&ctx->in);
+    }
+
+    if (!import_stopped(ctx))
+        flipper_flush(ctx, &fb);
+}
+
+/* ---------------- lircd.conf ---------------- */
+
+static unsigned int lircd_flags(const char *text)
+{
+    unsigned int flags = 0;
+    char copy[IMPORT_WORD_MAX];
+    snprintf(copy, sizeof(copy), "%s", text);
+
+    for (char *save = NULL, *flag = strtok_r(copy, "|", &save); flag; flag = strtok_r(NULL, "|", &save))
+    {
+        if (strcmp(flag, "RAW_CODES") == 0)
+            flags |= LIRCD_RAW_CODES;
+        else if (strcmp(flag, "RC5") == 0 || strcmp(flag, "SHIFT_ENC") == 0)
+            flags |= LIRCD_SHIFT_ENC;
+        else if (strcmp(flag, "REVERSE") == 0)
+            flags |= LIRCD_REVERSE;
+        else if (strcmp(flag, "SPACE_ENC") != 0 && strcmp(flag, "CONST_LENGTH") != 0 &&
+                 strcmp(flag, "NO_HEAD_REP") != 0 && strcmp(flag, "NO_FOOT_REP") != 0 &&
+                 strcmp(flag, "REPEAT_HEADER") != 0)
+            flags |= LIRCD_UNSUPPORTED;     // RC6, RCMM, SERIAL, XMP, BO, GRUNDIG...
+    }
+
+    return flags;
+}
+
+static uint32_t read_u32(reader *r)
+{
+    char word[IMPORT_WORD_MAX];
+    uint64_t v = 0;
+    if (read_word(r, word, sizeof(word), true) && parse_number(word, &v))
+        return (uint32_t)v;
+    return 0;
+}
+
+static void read_pair(reader *r, uint32_t pair[2])
+{
+    pair[0] = read_u32(r);
+    pair[1] = read_u32(r);
+}
+
+// One parameter line inside "begin remote"; the caller skips the rest of the line.
+static void lircd_param(import_ctx *ctx, lircd_remote *rm, const char *key)
+{
+    char value[IMPORT_WORD_MAX];
+    uint64_t v = 0;
+
+    if (strcmp(key, "name") == 0 && read_word(&ctx->in, value, sizeof(value), true))
+    {
+        snprintf(rm->name, sizeof(rm->name), "%s", value);
+        snprintf(ctx->remote, sizeof(ctx->remote), "%s", value);
+    }
+    else if (strcmp(key, "flags") == 0 && read_word(&ctx->in, value, sizeof(value), true))
+        rm->flags = lircd_flags(value);
+    else if (strcmp(key, "bits") == 0)
+        rm->bits = (int)read_u32(&ctx->in);
+    else if (strcmp(key, "pre_data_bits") == 0)
+        rm->pre_data_bits = (int)read_u32(&ctx->in);
+    else if (strcmp(key, "post_data_bits") == 0)
+        rm->post_data_bits = (int)read_u32(&ctx->in);
+    else if (strcmp(key, "pre_data") == 0 && read_word(&ctx->in, value, sizeof(value), true) &&
+             parse_number(value, &v))
+        rm->pre_data = v;
+    else if (strcmp(key, "post_data") == 0 && read_word(&ctx->in, value, sizeof(value), true) &&
+             parse_number(value, &v))
+        rm->post_data = v;
+    else if (strcmp(key, "header") == 0)
+        read_pair(&ctx->in, rm->header);
+    else if (strcmp(key, "one") == 0)
+        read_pair(&ctx->in, rm->one);
+    else if (strcmp(key, "zero") == 0)
+        read_pair(&ctx->in, rm->zero);
+    else if (strcmp(key, "pre") == 0)
+        read_pair(&ctx->in, rm->pre);
+    else if (strcmp(key, "post") == 0)
+        read_pair(&ctx->in, rm->post);
+    else if (strcmp(key, "plead") == 0)
+        rm->plead = read_u32(&ctx->in);
+    else if (strcmp(key, "ptrail") == 0)
+        rm->ptrail = read_u32(&ctx->in);
+    else if (strcmp(key, "frequency") == 0)
+        rm->frequency = read_u32(&ctx->in);
+    else if (strcmp(key, "duty_cycle") == 0)
+        rm->duty_cycle = (uint8_t)read_u32(&ctx->in);
+}
+
+static void push_pair(import_ctx *ctx, const uint32_t pair[2])
+{
+    push_duration(ctx, true, pair[0]);
+    push_duration(ctx, false, pair[1]);
+}
+
+// MSB first unless REVERSE; bi-phase sends a 1 as space-pulse, like lircd.
+static void push_bits(import_ctx *ctx, const lircd_remote *rm, uint64_t value, int bits)
+{
+    for (int i = 0; i < bits; i++)
+    {
+        int index = (rm->flags & LIRCD_REVERSE) ? i : bits - 1 - i;
+        bool one = (value >> index) & 1;
+
+        if (!(rm->flags & LIRCD_SHIFT_ENC))
+            push_pair(ctx, one ? rm->one : rm->zero);
+        else if (one)
+        {
+            push_duration(ctx, false, rm->one[0]);
+            push_duration(ctx, true, rm->one[1]);
+        }
+        else
+            push_pair(ctx, rm->zero);
+    }
+}
+
+static void lircd_emit_code(import_ctx *ctx, const lircd_remote *rm, uint64_t code)
+{
+    int total_bits = rm->pre_data_bits + rm->bits + rm->post_data_bits;
+    if ((rm->flags & LIRCD_UNSUPPORTED) || rm->bits <= 0 || rm->bits > 64 || total_bits > 128 ||
+        (!rm->one[0] && !rm->one[1]) || (!rm->zero[0] && !rm->zero[1]))
+    {
+        ctx->stats->skipped++;
+        return;
+    }
+
+    ctx->count = 0;
+    ctx->overflow = false;
+    push_pair(ctx, rm->header);
+    push_duration(ctx, true, rm->plead);
+    push_bits(ctx, rm, rm->pre_data, rm->pre_data_bits);
+    push_pair(ctx, rm->pre);
+    push_bits(ctx, rm, code, rm->bits);
+    push_pair(ctx, rm->post);
+    push_bits(ctx, rm, rm->post_data, rm->post_data_bits);
+    push_duration(ctx, true, rm->ptrail);
+
+    emit_durations(ctx, rm->frequency, rm->duty_cycle);
+}
+
+static void parse_lircd(import_ctx *ctx)
+{
+    enum { OUTSIDE, IN_REMOTE, IN_CODES, IN_RAW_CODES } state = OUTSIDE;
+    lircd_remote rm;
+    char word[IMPORT_WORD_MAX];
+    char what[IMPORT_WORD_MAX];
+    memset(&rm, 0, sizeof(rm));
+
+    while (!import_stopped(ctx) && read_word(&ctx->in, word, sizeof(word), false))
+    {
+        bool is_begin = strcmp(word, "begin") == 0;
+        if (is_begin || strcmp(word, "end") == 0)
+        {
+            if (!read_word(&ctx->in, what, sizeof(what), true))
+                what[0] = '\0';
+            skip_line(&ctx->in);
+
+            if (state == IN_RAW_CODES && ctx->button[0])
+                emit_durations(ctx, rm.frequency, rm.duty_cycle);
+            reset_button(ctx);
+
+            if (is_begin && strcmp(what, "remote") == 0)
+            {
+                memset(&rm, 0, sizeof(rm));
+                ctx->remote[0] = '\0';
+                state = IN_REMOTE;
+            }
+            else if (is_begin && strcmp(what, "codes") == 0)
+                state = IN_CODES;
+            else if (is_begin && strcmp(what, "raw_codes") == 0)
+                state = IN_RAW_CODES;
+            else if (!is_begin && strcmp(what, "remote") == 0)
+                state = OUTSIDE;
+            else if (!is_begin)
+                state = IN_REMOTE;
+            continue;
+        }
+
+        switch (state)
+        {
+            case IN_REMOTE:
+                lircd_param(ctx, &rm, word);
+                skip_line(&ctx->in);
+                break;
+            case IN_CODES: {
+                uint64_t code;
+                if (read_word(&ctx->in, what, sizeof(what), true) && parse_number(what, &code))
+                {
+                    snprintf(ctx->button, sizeof(ctx->button), "%s", word);
+                    lircd_emit_code(ctx, &rm, code);
+                }
+                skip_line(&ctx->in);
+                break;
+            }
+            case IN_RAW_CODES: {
+                uint64_t v;
+                if (strcmp(word, "name") == 0)
+                {
+                    if (ctx->button[0])
+                        emit_durations(ctx, rm.frequency, rm.duty_cycle);
+                    reset_button(ctx);
+                    if (read_word(&ctx->in, what, sizeof(what), true))
+                        snprintf(ctx->button, sizeof(ctx->button), "%s", what);
+                    skip_line(&ctx->in);
+                }
+                else if (parse_number(word, &v))
+                    push_duration(ctx, ctx->values++ % 2 == 0, (uint32_t)v);
+                break;
+            }
+            default:
+                skip_line(&ctx->in);
+                break;
+        }
+    }
+}
+
+bool ir_import_is_library_file(const char *name)
+{
+    return name && name[0] != '.' &&
+           (file_has_extension(name, IR_IMPORT_EXT_LIRCD) || file_has_extension(name, IR_IMPORT_EXT_FLIPPER));
+}
+
+int ir_import_file(const char *path, ir_import_cb cb, void *user_data, ir_import_stats *stats, const bool *cancel)
+{
+    if (!path || !cb || !stats)
+        return -1;
+
+    FILE *fp = fopen(path, "r");
+    if (!fp)
+        return -1;
+
+    // ~4 KiB of durations plus two names, kept off the worker's stack.
+    import_ctx *ctx = (import_ctx *)calloc(1, sizeof(import_ctx));
+    if (!ctx)
+    {
+        fclose(fp);
+        return -1;
+    }
+
+    ctx->cb = cb;
+    ctx->user_data = user_data;
+    ctx->stats = stats;
+    ctx->cancel = cancel;
+    ctx->in.fp = fp;
+
+    if (file_has_extension(path, IR_IMPORT_EXT_FLIPPER))
+    {
+        // The remote is the file: "Samsung_TV.ir" -> "Samsung_TV".
+        const char *base = strrchr(path, '/');
+        base = base ? base + 1 : path;
+        snprintf(ctx->remote, sizeof(ctx->remote), "%.*s",
+                 (int)(strlen(base) - strlen(IR_IMPORT_EXT_FLIPPER)), base);
+        parse_flipper(ctx);
+    }
+    else
+        parse_lircd(ctx);
+
+    fclose(fp);
+    free(ctx);
+    return 0;
+}
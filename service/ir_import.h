@@ -0,0 +1,46 @@
+#ifndef IR_IMPORT_H
+#define IR_IMPORT_H
+
+#include <stdbool.h>
+
+#include "service/ir_signal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define IR_IMPORT_EXT_LIRCD     ".conf"     // lircd.conf, also "*.lircd.conf"
+#define IR_IMPORT_EXT_FLIPPER   ".ir"       // Flipper Zero "IR signals file"
+
+typedef struct {
+    const char *remote;         // lircd "name", or the .ir file name without extension
+    const char *button;
+    const ir_signal *signal;    // a decoded signal has `protocol` set and no durations
+    long offset;                // bytes of the file read so far, for progress
+} ir_import_entry;
+
+// Returning false stops the import of the current file.
+typedef bool (*ir_import_cb)(const ir_import_entry *entry, void *user_data);
+
+typedef struct {
+    int buttons;                // entries handed to the callback
+    int skipped;                // encodings not handled, unknown protocols, oversized captures
+} ir_import_stats;
+
+bool ir_import_is_library_file(const char *name);
+
+/*
+ * Streams one library file, lircd.conf (raw and coded remotes) or Flipper
+ * .ir, calling `cb` once per button. Memory does not grow with the file:
+ * only the button being read is held. Coded buttons are synthesised and
+ * kept decoded when ir_protocol_decode() recognises them. Returns 0, or -1
+ * when the file can't be opened. `stats` is added to, not reset. Reading
+ * stops early once `*cancel` (may be NULL) is set, from any thread.
+ */
+int ir_import_file(const char *path, ir_import_cb cb, void *user_data, ir_import_stats *stats, const bool *cancel);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* IR_IMPORT_H */
@@ -0,0 +1,537 @@
+#include "service/ir_protocol.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#define MATCH_TOLERANCE_PCT 35
+#define FRAME_GAP_MIN_US    5000    // any space this long ends a frame
+#define MAX_LEVELS          128     // half-bit slots of the longest Manchester frame
+
+typedef enum {
+    CODING_PULSE_DISTANCE,  // fixed pulse, the space carries the bit
+    CODING_PULSE_WIDTH,     // the pulse carries the bit, fixed space
+    CODING_RC5,             // Manchester, 1 = space-pulse
+    CODING_RC6,             // Manchester, 1 = pulse-space, leader and double-width trailer bit
+} coding_t;
+
+/*
+ * Timings in µs. For the Manchester codings `zero_pulse` is the half-bit
+ * unit. `raw` values are LSB-first for the pulse codings and MSB-first for
+ * Manchester, as they come off the air.
+ */
+typedef struct {
+    uint16_t id;
+    const char *name;
+    coding_t coding;
+    uint32_t carrier;
+    uint16_t header_pulse;
+    uint16_t header_space;
+    uint16_t zero_pulse;
+    uint16_t zero_space;
+    uint16_t one_pulse;
+    uint16_t one_space;
+    uint16_t stop_pulse;
+    uint16_t repeat_space;  // NEC repeat code: header pulse, this space, stop pulse
+    uint8_t bits;
+    uint32_t period_us;     // frame start to next frame start
+    uint8_t min_repeats;
+    bool (*unpack)(uint64_t raw, ir_decoded *out);
+    uint64_t (*pack)(const ir_decoded *code);
+} protocol_desc;
+
+static uint8_t byte_at(uint64_t raw, int index)
+{
+    return (uint8_t)(raw >> (8 * index));
+}
+
+static bool nec_unpack(uint64_t raw, ir_decoded *out)
+{
+    if ((byte_at(raw, 0) ^ byte_at(raw, 1)) != 0xFF || (byte_at(raw, 2) ^ byte_at(raw, 3)) != 0xFF)
+        return false;
+
+    out->address = byte_at(raw, 0);
+    out->command = byte_at(raw, 2);
+    return true;
+}
+
+static uint64_t nec_pack(const ir_decoded *code)
+{
+    uint8_t a = (uint8_t)code->address;
+    uint8_t c = (uint8_t)code->command;
+    return a | (uint64_t)(uint8_t)~a << 8 | (uint64_t)c << 16 | (uint64_t)(uint8_t)~c << 24;
+}
+
+// Extended NEC: the second byte is address, not its inverse.
+static bool necx_unpack(uint64_t raw, ir_decoded *out)
+{
+    if ((byte_at(raw, 0) ^ byte_at(raw, 1)) == 0xFF || (byte_at(raw, 2) ^ byte_at(raw, 3)) != 0xFF)
+        return false;
+
+    out->address = (uint32_t)(raw & 0xFFFF);
+    out->command = byte_at(raw, 2);
+    return true;
+}
+
+static uint64_t necx_pack(const ir_decoded *code)
+{
+    uint8_t c = (uint8_t)code->command;
+    return (code->address & 0xFFFF) | (uint64_t)c << 16 | (uint64_t)(uint8_t)~c << 24;
+}
+
+static bool samsung_unpack(uint64_t raw, ir_decoded *out)
+{
+    if (byte_at(raw, 0) != byte_at(raw, 1) || (byte_at(raw, 2) ^ byte_at(raw, 3)) != 0xFF)
+        return false;
+
+    out->address = byte_at(raw, 0);
+    out->command = byte_at(raw, 2);
+    return true;
+}
+
+static uint64_t samsung_pack(const ir_decoded *code)
+{
+    uint8_t a = (uint8_t)code->address;
+    uint8_t c = (uint8_t)code->command;
+    return a | (uint64_t)a << 8 | (uint64_t)c << 16 | (uint64_t)(uint8_t)~c << 24;
+}
+
+// 7 command bits, then 5, 8 or 5 + 8 (extended) address bits.
+static bool sony_unpack(uint64_t raw, ir_decoded *out)
+{
+    out->command = (uint32_t)(raw & 0x7F);
+    out->address = (uint32_t)(raw >> 7);
+    return true;
+}
+
+static uint64_t sony_pack(const ir_decoded *code)
+{
+    return (code->command & 0x7F) | (uint64_t)code->address << 7;
+}
+
+// S1 S2 T A4..A0 C5..C0; an inverted S2 is command bit 6 (RC5X).
+static bool rc5_unpack(uint64_t raw, ir_decoded *out)
+{
+    if (!((raw >> 13) & 1))
+        return false;
+
+    out->address = (uint32_t)((raw >> 6) & 0x1F);
+    out->command = (uint32_t)(raw & 0x3F) | (((raw >> 12) & 1) ? 0 : 0x40);
+    return true;
+}
+
+static uint64_t rc5_pack(const ir_decoded *code)
+{
+    uint64_t s2 = (code->command & 0x40) ? 0 : 1;
+    return 1ull << 13 | s2 << 12 | (uint64_t)(code->address & 0x1F) << 6 | (code->command & 0x3F);
+}
+
+// Start, mode 2..0, trailer (toggle), A7..A0, C7..C0. Only mode 0 is handled.
+static bool rc6_unpack(uint64_t raw, ir_decoded *out)
+{
+    if (!((raw >> 20) & 1) || ((raw >> 17) & 7) != 0)
+        return false;
+
+    out->address = (uint32_t)((raw >> 8) & 0xFF);
+    out->command = (uint32_t)(raw & 0xFF);
+    return true;
+}
+
+static uint64_t rc6_pack(const ir_decoded *code)
+{
+    return 1ull << 20 | (uint64_t)(code->address & 0xFF) << 8 | (code->command & 0xFF);
+}
+
+static uint8_t kaseikyo_vendor_parity(uint16_t vendor)
+{
+    return (uint8_t)((vendor ^ (vendor >> 4) ^ (vendor >> 8) ^ (vendor >> 12)) & 0xF);
+}
+
+// Vendor 16, vendor parity 4, address 12, command 8, parity of bytes 2..4.
+static bool kaseikyo_unpack(uint64_t raw, ir_decoded *out)
+{
+    uint16_t vendor = (uint16_t)(raw & 0xFFFF);
+    if (((raw >> 16) & 0xF) != kaseikyo_vendor_parity(vendor))
+        return false;
+    if (byte_at(raw, 5) != (byte_at(raw, 2) ^ byte_at(raw, 3) ^ byte_at(raw, 4)))
+        return false;
+
+    out->address = (uint32_t)vendor << 16 | (uint32_t)((raw >> 20) & 0xFFF);
+    out->command = byte_at(raw, 4);
+    return true;
+}
+
+static uint64_t kaseikyo_pack(const ir_decoded *code)
+{
+    uint16_t vendor = (uint16_t)(code->address >> 16);
+    uint64_t raw = vendor | (uint64_t)kaseikyo_vendor_parity(vendor) << 16 |
+                   (uint64_t)(code->address & 0xFFF) << 20 | (uint64_t)(code->command & 0xFF) << 32;
+    return raw | (uint64_t)(byte_at(raw, 2) ^ byte_at(raw, 3) ^ byte_at(raw, 4)) << 40;
+}
+
+/*
+ * Tried in order; NEC before NECx so a frame with an inverted address byte
+ * is plain NEC. Sony frames of different lengths are told apart by the gap
+ * that has to follow the last bit.
+ */
+static const protocol_desc protocols[] = {
+    { IR_PROTO_NEC, "NEC", CODING_PULSE_DISTANCE, 38000,
+      9000, 4500, 560, 560, 560, 1690, 560, 2250, 32, 108000, 0, nec_unpack, nec_pack },
+    { IR_PROTO_NECX, "NECx", CODING_PULSE_DISTANCE, 38000,
+      9000, 4500, 560, 560, 560, 1690, 560, 2250, 32, 108000, 0, necx_unpack, necx_pack },
+    { IR_PROTO_SAMSUNG, "Samsung", CODING_PULSE_DISTANCE, 38000,
+      4500, 4500, 560, 560, 560, 1690, 560, 0, 32, 108000, 0, samsung_unpack, samsung_pack },
+    { IR_PROTO_SONY12, "Sony12", CODING_PULSE_WIDTH, 40000,
+      2400, 600, 600, 600, 1200, 600, 0, 0, 12, 45000, 2, sony_unpack, sony_pack },
+    { IR_PROTO_SONY15, "Sony15", CODING_PULSE_WIDTH, 40000,
+      2400, 600, 600, 600, 1200, 600, 0, 0, 15, 45000, 2, sony_unpack, sony_pack },
+    { IR_PROTO_SONY20, "Sony20", CODING_PULSE_WIDTH, 40000,
+      2400, 600, 600, 600, 1200, 600, 0, 0, 20, 45000, 2, sony_unpack, sony_pack },
+    { IR_PROTO_RC5, "RC5", CODING_RC5, 36000,
+      0, 0, 889, 0, 0, 0, 0, 0, 14, 113778, 0, rc5_unpack, rc5_pack },
+    { IR_PROTO_RC6, "RC6", CODING_RC6, 36000,
+      2666, 889, 444, 0, 0, 0, 0, 0, 21, 106667, 0, rc6_unpack, rc6_pack },
+    { IR_PROTO_KASEIKYO, "Kaseikyo", CODING_PULSE_DISTANCE, 37000,
+      3456, 1728, 432, 432, 432, 1296, 432, 0, 48, 130000, 0, kaseikyo_unpack, kaseikyo_pack },
+};
+
+#define PROTOCOL_COUNT (sizeof(protocols) / sizeof(protocols[0]))
+#define RC6_TRAILER_BIT 4
+
+static const protocol_desc *find_protocol(uint16_t id)
+{
+    for (size_t i = 0; i < PROTOCOL_COUNT; i++)
+    {
+        if (protocols[i].id == id)
+            return &protocols[i];
+    }
+
+    return NULL;
+}
+
+const char *ir_protocol_name(uint16_t protocol)
+{
+    const protocol_desc *p = find_protocol(protocol);
+    return p ? p->name : "Raw";
+}
+
+static bool match(uint32_t value, uint32_t expected)
+{
+    uint32_t slack = expected * MATCH_TOLERANCE_PCT / 100;
+    return value + slack >= expected && value <= expected + slack;
+}
+
+// A frame is either the whole capture or followed by a long space.
+static bool ends_frame(const uint32_t *d, int count, int space_index)
+{
+    return space_index >= count || d[space_index] >= FRAME_GAP_MIN_US;
+}
+
+static bool decode_pulse_coded(const protocol_desc *p, const uint32_t *d, int count, uint64_t *raw)
+{
+    int needed = p->stop_pulse ? 2 + 2 * p->bits + 1 : 2 + 2 * p->bits - 1;
+    if (count < needed || !match(d[0], p->header_pulse) || !match(d[1], p->header_space))
+        return false;
+
+    uint64_t value = 0;
+    for (int b = 0; b < p->bits; b++)
+    {
+        int i = 2 + 2 * b;
+        bool last = b == p->bits - 1;
+        bool one;
+
+        if (p->coding == CODING_PULSE_DISTANCE)
+        {
+            if (!match(d[i], p->zero_pulse))
+                return false;
+
+            if (match(d[i + 1], p->one_space))
+                one = true;
+            else if (match(d[i + 1], p->zero_space))
+                one = false;
+            else
+                return false;
+        }
+        else
+        {
+            if (match(d[i], p->one_pulse))
+                one = true;
+            else if (match(d[i], p->zero_pulse))
+                one = false;
+            else
+                return false;
+
+            // Without a stop pulse the space after the last bit is the gap.
+            if (!(last && !p->stop_pulse) && !match(d[i + 1], p->zero_space))
+                return false;
+        }
+
+        if (one)
+            value |= 1ull << b;
+    }
+
+    int end = 2 + 2 * p->bits;
+    if (p->stop_pulse)
+    {
+        if (!match(d[end], p->stop_pulse))
+            return false;
+        end++;
+    }
+    else
+    {
+        end--;
+    }
+
+    if (!ends_frame(d, count, end))
+        return false;
+
+    *raw = value;
+    return true;
+}
+
+// Expands durations from `start` into half-bit levels (1 = pulse) up to the first gap.
+static int to_levels(const uint32_t *d, int count, int start, uint32_t unit, uint8_t *levels, int used)
+{
+    for (int i = start; i < count; i++)
+    {
+        bool pulse = i % 2 == 0;
+        if (!pulse && d[i] >= FRAME_GAP_MIN_US)
+            break;
+
+        uint32_t n = (d[i] + unit / 2) / unit;
+        if (n == 0 || n > 3 || !match(d[i], n * unit))
+            return -1;
+
+        for (uint32_t k = 0; k < n; k++)
+        {
+            if (used == MAX_LEVELS)
+                return -1;
+            levels[used++] = pulse;
+        }
+    }
+
+    return used;
+}
+
+static bool decode_manchester(const protocol_desc *p, const uint32_t *d, int count, uint64_t *raw)
+{
+    uint8_t levels[MAX_LEVELS];
+    int used = 0;
+    int start = 0;
+    int needed = 2 * p->bits;
+
+    if (p->coding == CODING_RC5)
+    {
+        // The first half of the start bit is a space nobody can see.
+        levels[used++] = 0;
+    }
+    else
+    {
+        if (count < 2 || !match(d[0], p->header_pulse) || !match(d[1], p->header_space))
+            return false;
+        start = 2;
+        needed += 2;
+    }
+
+    used = to_levels(d, count, start, p->zero_pulse, levels, used);
+
+    // The last half may be a space merged into the gap.
+    if (used < needed - 1 || used > needed)
+        return false;
+    if (used < needed)
+        levels[used++] = 0;
+
+    uint64_t value = 0;
+    int pos = 0;
+    for (int b = 0; b < p->bits; b++)
+    {
+        int width = (p->coding == CODING_RC6 && b == RC6_TRAILER_BIT) ? 2 : 1;
+        uint8_t first = levels[pos];
+        uint8_t second = levels[pos + width];
+        for (int k = 1; k < width; k++)
+        {
+            if (levels[pos + k] != first || levels[pos + width + k] != second)
+                return false;
+        }
+        if (first == second)
+            return false;
+
+        bool one = p->coding == CODING_RC5 ? second : first;
+        value = value << 1 | (one ? 1 : 0);
+        pos += 2 * width;
+    }
+
+    *raw = value;
+    return true;
+}
+
+bool ir_protocol_decode(const uint32_t *durations, int count, ir_decoded *out)
+{
+    if (!durations || count <= 0 || !out)
+        return false;
+
+    for (size_t i = 0; i < PROTOCOL_COUNT; i++)
+    {
+        const protocol_desc *p = &protocols[i];
+        uint64_t raw = 0;
+        bool framed = (p->coding == CODING_RC5 || p->coding == CODING_RC6)
+                          ? decode_manchester(p, durations, count, &raw)
+                          : decode_pulse_coded(p, durations, count, &raw);
+
+        ir_decoded decoded;
+        memset(&decoded, 0, sizeof(decoded));
+        if (framed && p->unpack(raw, &decoded))
+        {
+            decoded.protocol = p->id;
+            *out = decoded;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+typedef struct {
+    ir_signal *out;
+    uint64_t elapsed;
+    bool overflow;
+} builder_t;
+
+static void push(builder_t *b, bool pulse, uint32_t value)
+{
+    ir_signal *s = b->out;
+    b->elapsed += value;
+
+    if (s->count == 0 && !pulse)
+        return;
+
+    if (s->count > 0 && (s->count % 2 == 1) == pulse)
+    {
+        s->durations[s->count - 1] += value;
+        return;
+    }
+
+    if (s->count == IR_SIGNAL_MAX_DURATIONS)
+    {
+        b->overflow = true;
+        return;
+    }
+
+    s->durations[s->count++] = value;
+}
+
+static void emit_frame(builder_t *b, const protocol_desc *p, uint64_t raw)
+{
+    if (p->coding == CODING_PULSE_DISTANCE || p->coding == CODING_PULSE_WIDTH)
+    {
+        push(b, true, p->header_pulse);
+        push(b, false, p->header_space);
+        for (int i = 0; i < p->bits; i++)
+        {
+            bool one = (raw >> i) & 1;
+            push(b, true, one ? p->one_pulse : p->zero_pulse);
+            push(b, false, one ? p->one_space : p->zero_space);
+        }
+        if (p->stop_pulse)
+            push(b, true, p->stop_pulse);
+        return;
+    }
+
+    if (p->coding == CODING_RC6)
+    {
+        push(b, true, p->header_pulse);
+        push(b, false, p->header_space);
+    }
+
+    for (int i = p->bits - 1; i >= 0; i--)
+    {
+        bool one = (raw >> i) & 1;
+        uint32_t half = p->zero_pulse * ((p->coding == CODING_RC6 && p->bits - 1 - i == RC6_TRAILER_BIT) ? 2 : 1);
+        bool pulse_first = p->coding == CODING_RC5 ? !one : one;
+        push(b, pulse_first, half);
+        push(b, !pulse_first, half);
+    }
+}
+
+int ir_protocol_encode(const ir_decoded *code, int repeats, ir_signal *out)
+{
+    const protocol_desc *p = code ? find_protocol(code->protocol) : NULL;
+    if (!p || !out)
+        return -1;
+
+    memset(out, 0, sizeof(*out));
+    out->durations = (uint32_t *)malloc(IR_SIGNAL_MAX_DURATIONS * sizeof(uint32_t));
+    if (!out->durations)
+        return -1;
+
+    out->carrier = p->carrier;
+    out->protocol = p->id;
+    out->address = code->address;
+    out->command = code->command;
+
+    builder_t b = { out, 0, false };
+    uint64_t raw = p->pack(code);
+    int frames = 1 + (repeats > p->min_repeats ? repeats : p->min_repeats);
+
+    for (int f = 0; f < frames; f++)
+    {
+        uint64_t frame_start = b.elapsed;
+        if (f > 0 && p->repeat_space)
+        {
+            push(&b, true, p->header_pulse);
+            push(&b, false, p->repeat_space);
+            push(&b, true, p->stop_pulse);
+        }
+        else
+        {
+            emit_frame(&b, p, raw);
+        }
+
+        uint64_t frame_len = b.elapsed - frame_start;
+        uint32_t gap = frame_len + FRAME_GAP_MIN_US < p->period_us ? (uint32_t)(p->period_us - frame_len)
+                                                                   : FRAME_GAP_MIN_US;
+        push(&b, false, gap);
+    }
+
+    if (b.overflow)
+    {
+        ir_signal_free(out);
+        return -1;
+    }
+
+    return 0;
+}
+
+int ir_protocol_frame_count(const ir_signal *signal)
+{
+    if (!signal || signal->count <= 0)
+        return 0;
+
+    int frames = 0;
+    for (int i = 1; i < signal->count; i += 2)
+    {
+        if (signal->durations[i] >= FRAME_GAP_MIN_US)
+            frames++;
+    }
+
+    // Only a signal that ends in its gap is sent again for each repeat.
+    if (signal->count % 2 == 1)
+        return frames + 1;
+    return frames * (1 + signal->repeats);
+}
+
+bool ir_protocol_decode_signal(const ir_signal *signal, ir_decoded *out, int *repeats)
+{
+    if (!signal || !out || !repeats || !ir_protocol_decode(signal->durations, signal->count, out))
+        return false;
+
+    int frames = ir_protocol_frame_count(signal);
+    *repeats = frames - 1 > UINT8_MAX ? UINT8_MAX : frames - 1;
+
+    ir_signal check;
+    if (ir_protocol_encode(out, *repeats, &check) != 0)
+        return false;
+
+    bool same = ir_protocol_frame_count(&check) == frames;
+    ir_signal_free(&check);
+    return same;
+}
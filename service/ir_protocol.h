@@ -0,0 +1,68 @@
+#ifndef IR_PROTOCOL_H
+#define IR_PROTOCOL_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "service/ir_signal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Stored in .irb files; never renumber.
+typedef enum {
+    IR_PROTO_NONE       = 0,
+    IR_PROTO_NEC        = 1,
+    IR_PROTO_NECX       = 2,
+    IR_PROTO_SAMSUNG    = 3,
+    IR_PROTO_SONY12     = 4,
+    IR_PROTO_SONY15     = 5,
+    IR_PROTO_SONY20     = 6,
+    IR_PROTO_RC5        = 7,
+    IR_PROTO_RC6        = 8,
+    IR_PROTO_KASEIKYO   = 9,
+} ir_protocol_id;
+
+/*
+ * One decoded frame. Field widths per protocol:
+ *   NEC 8/8, NECx 16/8, Samsung 8/8, Sony 5|8|13/7, RC5 5/7, RC6 (mode 0) 8/8,
+ *   Kaseikyo (vendor << 16 | 12-bit address)/8.
+ */
+typedef struct {
+    uint16_t protocol;
+    uint32_t address;
+    uint32_t command;
+} ir_decoded;
+
+const char *ir_protocol_name(uint16_t protocol);
+
+/*
+ * Recognises the first frame of `durations` (pulse first, µs). Fails unless
+ * the whole frame matches, including inverted bytes and parity where the
+ * protocol has them, so a failed decode just means "keep it raw".
+ */
+bool ir_protocol_decode(const uint32_t *durations, int count, ir_decoded *out);
+
+/*
+ * Regenerates the timing of `code` plus `repeats` repeat frames (NEC repeat
+ * codes, full frames for the rest; Sony always sends at least 3 frames).
+ * Fills durations and carrier of `out`, to be released with ir_signal_free().
+ */
+int ir_protocol_encode(const ir_decoded *code, int repeats, ir_signal *out);
+
+// Frames `signal` sends, its repeats included; a space of 5 ms or more ends a frame.
+int ir_protocol_frame_count(const ir_signal *signal);
+
+/*
+ * ir_protocol_decode() plus the `repeats` that makes ir_protocol_encode()
+ * send as many frames as `signal`. Fails when that count cannot be
+ * reproduced (a lone Sony frame), so the caller keeps the durations.
+ */
+bool ir_protocol_decode_signal(const ir_signal *signal, ir_decoded *out, int *repeats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* IR_PROTOCOL_H */
@@ -2,6 +2,7 @@
 #include "utils/string_utils.h"
 #include "utils/logger.h"
 #include "utils/error_handler.h"
+#include "utils/file.h"
 
 #include <limits.h>
 #include <stdarg.h>
@@ -9,12 +10,29 @@
 #include <stdlib.h>
 #include <string.h>
 #include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <stdint.h>
+#include <time.h>
+#include <unistd.h>
+#include <signal.h>
+#include <sys/eventfd.h>
+#include <sys/ioctl.h>
 #include <sys/stat.h>
 #include <sys/wait.h>
+#include <linux/lirc.h>
 
 #define IR_DEFAULT_TX_DEV "/dev/lirc0"
 #define IR_DEFAULT_RX_DEV "/dev/lirc1"
 #define IR_DEFAULT_TIMEOUT_MS 5000
+#define IR_DEFAULT_CARRIER_HZ 38000
+#define IR_DEFAULT_DUTY_CYCLE 33
+#define IRCTL_SEND_TMP        "/tmp/zv-ir-send-XXXXXX"  // mkstemp() template; ir-ctl can't read .irb files
+
+#define LIRC_MAX_SAMPLES      IR_SIGNAL_MAX_DURATIONS
+#define LIRC_END_GAP_MS       200    // silence that closes a capture once it started
+#define LIRC_TOKENS_PER_LINE  6
+#define MONITOR_FRAME_GAP_US  10000  // a space this long ends a frame, same as ir_capture
 
 typedef enum {
     SUCCESS = 0,
@@ -24,6 +42,42 @@ typedef enum {
 // The memory used by this struct is used a long the whole program.
 static ir_context context; 
 
+/*
+ * lircdev backend state. The TX device stays open between sends so a button
+ * press is one write(); carrier and duty cycle are only pushed to the driver
+ * when they change.
+ */
+static struct {
+    int tx_fd;
+    uint32_t tx_features;
+    uint32_t tx_carrier;
+    uint32_t tx_duty;
+} lirc = { -1, 0, 0, 0 };
+
+/*
+ * Cancellation of a running learn. `child` is the ir-ctl capture (irctl) and
+ * `wake_fd` an eventfd polled next to the receiver (lircdev).
+ */
+static struct {
+    bool canceled;
+    pid_t child;
+    int wake_fd;
+} learn = { false, 0, -1 };
+
+/*
+ * The continuous receiver (ir_monitor_run). Same eventfd wake-up as the
+ * lircdev learn, kept apart so stopping one never cancels the other.
+ */
+static struct {
+    bool stopped;
+    int wake_fd;
+} monitor = { false, -1 };
+
+static bool learn_canceled(void)
+{
+    return __atomic_load_n(&learn.canceled, __ATOMIC_ACQUIRE);
+}
+
 static void shell_escape_single_quotes(const char *src, char *dst, size_t dst_sz)
 {
     size_t j = 0;
@@ -62,14 +116,53 @@ static int system_status_code(int rc)
     return -1;
 }
 
-static ir_status_t irctl_send_raw(const char *raw_path)
+/*
+ * Writes the text form of `signal_path` to a new file created with mkstemp(),
+ * so concurrent senders and other users of /tmp never share it. `tmp_path`
+ * gets its name; the caller removes it.
+ */
+static int irctl_render_text(const char *signal_path, char *tmp_path, size_t tmp_sz)
 {
-    if ( zv_is_empty(raw_path))
+    ir_signal signal;
+    if (ir_signal_load(signal_path, &signal) != 0)
+        return -1;
+
+    size_t len = 0;
+    char *text = ir_signal_to_text(&signal, &len);
+    ir_signal_free(&signal);
+    if (!text)
+        return -1;
+
+    snprintf(tmp_path, tmp_sz, "%s", IRCTL_SEND_TMP);
+    int fd = mkstemp(tmp_path);
+    FILE *f = fd >= 0 ? fdopen(fd, "wb") : NULL;
+    if (!f)
     {
-        set_last_error("The raw path is empty, can't send the signal");
-        return IR_ERR_INVALID;
+        if (fd >= 0)
+        {
+            close(fd);
+            unlink(tmp_path);
+        }
+        free(text);
+        tmp_path[0] = '\0';
+        return -1;
+    }
+
+    size_t n = fwrite(text, 1, len, f);
+    int rc = (fclose(f) == 0 && n == len) ? 0 : -2;
+    free(text);
+
+    if (rc != 0)
+    {
+        unlink(tmp_path);
+        tmp_path[0] = '\0';
     }
 
+    return rc;
+}
+
+static ir_status_t irctl_send_file(const char *raw_path)
+{
     char escaped_dev[ESCAPED_DEV_PATH];
     char escaped_path[ESCAPED_TMP_PATH];
     char cmd[COMMAND_SIZE];
@@ -81,22 +174,87 @@ static ir_status_t irctl_send_raw(const char *raw_path)
     snprintf(cmd, sizeof(cmd),
              "timeout %ds ir-ctl -d '%s' -s '%s' >/dev/null 2>&1", send_timeout_sec, escaped_dev, escaped_path);
 
-    log_debug("[IR][service]::irctl_send_raw send cmd: %s\n", cmd);
+    log_debug("[IR][service]::irctl_send_file send cmd: %s\n", cmd);
 
     // TODO: dont use system to make a call to the sustem, use fork or something like that
     int exit_code = system_status_code(system(cmd));
     if (exit_code != 0)
     {
         set_last_error("ir-ctl send failed");
-        log_error("[IR][service]::irctl_send_raw send failed exit_code=%d tx_dev=%s raw=%s", exit_code, context.tx_dev, raw_path);
+        log_error("[IR][service]::irctl_send_file send failed exit_code=%d tx_dev=%s raw=%s", exit_code, context.tx_dev, raw_path);
         return IR_ERR_IO;
     }
 
     set_last_error(NULL);
-    log_debug("[IR][service]::irctl_send_raw send ok tx_dev=%s raw=%s", context.tx_dev, raw_path);
+    log_debug("[IR][service]::irctl_send_file send ok tx_dev=%s raw=%s", context.tx_dev, raw_path);
     return IR_OK;
 }
 
+static ir_status_t irctl_send_raw(const char *raw_path)
+{
+    if ( zv_is_empty(raw_path))
+    {
+        set_last_error("The raw path is empty, can't send the signal");
+        return IR_ERR_INVALID;
+    }
+
+    if (!file_has_extension(raw_path, IR_SIGNAL_EXT_BIN))
+        return irctl_send_file(raw_path);
+
+    char tmp_path[] = IRCTL_SEND_TMP;
+    if (irctl_render_text(raw_path, tmp_path, sizeof(tmp_path)) != 0)
+    {
+        set_last_error("Invalid signal file");
+        log_error("[IR][service]::irctl_send_raw can't convert %s for ir-ctl", raw_path);
+        return IR_ERR_INVALID;
+    }
+
+    ir_status_t rc = irctl_send_file(tmp_path);
+    unlink(tmp_path);
+    return rc;
+}
+
+/*
+ * Runs `timeout <N>s ir-ctl -r -d <rx_dev>` with stdout on `tmp_path`, in its
+ * own process group so ir_learn_cancel() can stop both processes at once.
+ */
+static int irctl_run_capture(const char *tmp_path, int watchdog_sec)
+{
+    int out = open(tmp_path, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (out < 0)
+        return -1;
+
+    char timeout_arg[16];
+    snprintf(timeout_arg, sizeof(timeout_arg), "%ds", watchdog_sec);
+
+    pid_t pid = fork();
+    if (pid == 0)
+    {
+        setpgid(0, 0);
+        dup2(out, STDOUT_FILENO);
+        execlp("timeout", "timeout", timeout_arg, "ir-ctl", "-r", "-d", context.rx_dev, (char *)NULL);
+        _exit(127);
+    }
+
+    close(out);
+    if (pid < 0)
+        return -1;
+
+    setpgid(pid, pid);
+    __atomic_store_n(&learn.child, pid, __ATOMIC_RELEASE);
+
+    // A cancel that came in between fork() and the store above saw no child.
+    if (learn_canceled())
+        kill(-pid, SIGTERM);
+
+    int status = 0;
+    while (waitpid(pid, &status, 0) < 0 && errno == EINTR)
+        ;
+
+    __atomic_store_n(&learn.child, 0, __ATOMIC_RELEASE);
+    return system_status_code(status);
+}
+
 static ir_status_t irctl_learn_raw (const char *out_raw_path)
 {
     if (zv_is_empty(out_raw_path))
@@ -106,8 +264,6 @@ static ir_status_t irctl_learn_raw (const char *out_raw_path)
         return IR_ERR_INVALID;
     }
 
-    char escaped_dev[ESCAPED_DEV_PATH];
-    char escaped_tmp[ESCAPED_TMP_PATH];
     char tmp_path[PATH_MAX];
     struct stat st;
 
@@ -117,19 +273,21 @@ static ir_status_t irctl_learn_raw (const char *out_raw_path)
         return IR_ERR_INVALID;
     }
 
-    shell_escape_single_quotes(context.rx_dev, escaped_dev, sizeof(escaped_dev));
-    shell_escape_single_quotes(tmp_path, escaped_tmp, sizeof(escaped_tmp));
-
-    char cmd[COMMAND_SIZE];
     int sec = context.timeout_ms / 1000;
     int watchdog_sec = sec + 2;
 
     // This will be store a raw signal file in tmp directory
-    snprintf(cmd, sizeof(cmd),
-             "timeout %ds ir-ctl -r -d '%s' > '%s'", watchdog_sec, escaped_dev, escaped_tmp);
+    log_debug("[IR][service]::irctl_learn_raw learn signal: timeout %ds ir-ctl -r -d '%s' > '%s'",
+              watchdog_sec, context.rx_dev, tmp_path);
+    int exit_code = irctl_run_capture(tmp_path, watchdog_sec);
+    if (learn_canceled())
+    {
+        remove(tmp_path);
+        set_last_error("Capture canceled");
+        log_debug("[IR][service]::irctl_learn_raw learn canceled");
+        return IR_ERR_CANCELED;
+    }
 
-    log_debug("[IR][service]::irctl_learn_raw learn signal command: %s", cmd);
-    int exit_code = system_status_code(system(cmd));
     if (exit_code == TIMEOUT)
     {
         /* timeout can still leave a valid capture in the output file */
@@ -186,8 +344,418 @@ static ir_status_t irctl_learn_raw (const char *out_raw_path)
     return IR_OK;
 }
 
+static void lirc_close_tx(void)
+{
+    if (lirc.tx_fd >= 0)
+        close(lirc.tx_fd);
+
+    lirc.tx_fd = -1;
+    lirc.tx_features = 0;
+    lirc.tx_carrier = 0;
+    lirc.tx_duty = 0;
+}
+
+static long long monotonic_ms(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (long long)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+static ir_status_t lirc_open_tx(void)
+{
+    if (lirc.tx_fd >= 0)
+        return IR_OK;
+
+    int fd = open(context.tx_dev, O_WRONLY | O_CLOEXEC);
+    if (fd < 0)
+    {
+        set_last_error("Can't open the IR transmitter");
+        log_error("[IR][service]::lirc_open_tx open failed tx_dev=%s errno=%d(%s)",
+                  context.tx_dev, errno, strerror(errno));
+        return IR_ERR_IO;
+    }
+
+    uint32_t features = 0;
+    if (ioctl(fd, LIRC_GET_FEATURES, &features) != 0 || !(features & LIRC_CAN_SEND_PULSE))
+    {
+        close(fd);
+        set_last_error("The IR device can't transmit");
+        log_error("[IR][service]::lirc_open_tx %s does not support LIRC_MODE_PULSE", context.tx_dev);
+        return IR_ERR_UNSUPPORTED;
+    }
+
+    uint32_t mode = LIRC_MODE_PULSE;
+    ioctl(fd, LIRC_SET_SEND_MODE, &mode);
+
+    lirc.tx_fd = fd;
+    lirc.tx_features = features;
+    lirc.tx_carrier = 0;
+    lirc.tx_duty = 0;
+    return IR_OK;
+}
+
+static void lirc_apply_modulation(uint32_t carrier, uint32_t duty)
+{
+    if (carrier != lirc.tx_carrier && (lirc.tx_features & LIRC_CAN_SET_SEND_CARRIER))
+    {
+        if (ioctl(lirc.tx_fd, LIRC_SET_SEND_CARRIER, &carrier) == 0)
+            lirc.tx_carrier = carrier;
+        else
+            log_warning("[IR][service]::lirc_apply_modulation carrier=%u rejected", carrier);
+    }
+
+    if (duty != lirc.tx_duty && (lirc.tx_features & LIRC_CAN_SET_SEND_DUTY_CYCLE))
+    {
+        if (ioctl(lirc.tx_fd, LIRC_SET_SEND_DUTY_CYCLE, &duty) == 0)
+            lirc.tx_duty = duty;
+        else
+            log_warning("[IR][service]::lirc_apply_modulation duty=%u rejected", duty);
+    }
+}
+
+// Blocks until the frame is on the air; `count` must be odd.
+static ir_status_t lirc_write_frame(const uint32_t *durations, int count)
+{
+    ssize_t len = (ssize_t)(count * sizeof(uint32_t));
+    ssize_t written;
+    do {
+        written = write(lirc.tx_fd, durations, (size_t)len);
+    } while (written < 0 && errno == EINTR);
+
+    if (written != len)
+    {
+        set_last_error("IR send failed");
+        log_error("[IR][service]::lirc_write_frame write failed tx_dev=%s errno=%d(%s)",
+                  context.tx_dev, errno, strerror(errno));
+
+        // Reopen on the next send, the device may have gone away.
+        lirc_close_tx();
+        return IR_ERR_IO;
+    }
+
+    return IR_OK;
+}
+
+static ir_status_t lircdev_send_signal(const ir_signal *signal)
+{
+    // The driver wants an odd count: the signal always ends on a pulse.
+    int count = signal->count % 2 == 0 ? signal->count - 1 : signal->count;
+    if (count <= 0)
+    {
+        set_last_error("Invalid raw signal");
+        return IR_ERR_INVALID;
+    }
+
+    ir_status_t status = lirc_open_tx();
+    if (status != IR_OK)
+        return status;
+
+    uint32_t carrier = signal->carrier ? signal->carrier : (uint32_t)context.carrier_hz;
+    uint32_t duty = signal->duty_cycle ? signal->duty_cycle : (uint32_t)context.duty_cycle;
+    lirc_apply_modulation(carrier, duty);
+
+    // Repeats only make sense when the durations end in the frame gap.
+    int repeats = signal->count % 2 == 0 ? signal->repeats : 0;
+
+    // The driver blocks until the whole frame has been transmitted, so the
+    // gap between repeats is slept here.
+    for (int r = 0; r <= repeats; r++)
+    {
+        if (r > 0)
+            usleep(signal->durations[signal->count - 1]);
+
+        status = lirc_write_frame(signal->durations, count);
+        if (status != IR_OK)
+            return status;
+    }
+
+    set_last_error(NULL);
+    log_debug("[IR][service]::lircdev_send_signal send ok tx_dev=%s samples=%d repeats=%d carrier=%u",
+              context.tx_dev, count, repeats, carrier);
+    return IR_OK;
+}
+
+static ir_status_t lircdev_send_raw(const char *raw_path)
+{
+    if (zv_is_empty(raw_path))
+    {
+        set_last_error("The raw path is empty, can't send the signal");
+        return IR_ERR_INVALID;
+    }
+
+    ir_signal signal;
+    if (ir_signal_load(raw_path, &signal) != 0)
+    {
+        set_last_error("Invalid raw signal file");
+        log_error("[IR][service]::lircdev_send_raw can't parse raw=%s", raw_path);
+        return IR_ERR_INVALID;
+    }
+
+    ir_status_t status = lircdev_send_signal(&signal);
+    ir_signal_free(&signal);
+    return status;
+}
+
+static int lirc_open_rx(void)
+{
+    int fd = open(context.rx_dev, O_RDONLY | O_NONBLOCK | O_CLOEXEC);
+    if (fd < 0)
+    {
+        set_last_error("Can't open the IR receiver");
+        log_error("[IR][service]::lirc_open_rx open failed rx_dev=%s errno=%d(%s)",
+                  context.rx_dev, errno, strerror(errno));
+        return -1;
+    }
+
+    uint32_t features = 0;
+    uint32_t mode = LIRC_MODE_MODE2;
+    if (ioctl(fd, LIRC_GET_FEATURES, &features) != 0 || !(features & LIRC_CAN_REC_MODE2) ||
+        ioctl(fd, LIRC_SET_REC_MODE, &mode) != 0)
+    {
+        close(fd);
+        set_last_error("The IR device can't receive");
+        log_error("[IR][service]::lirc_open_rx %s does not support LIRC_MODE_MODE2", context.rx_dev);
+        return -1;
+    }
+
+    // Drop whatever was queued before the user was asked to press the button.
+    uint32_t stale[64];
+    while (read(fd, stale, sizeof(stale)) > 0)
+        ;
+
+    return fd;
+}
+
+static int lirc_write_capture(const char *path, const uint32_t *samples, int count)
+{
+    // Sign, up to 10 digits (merged samples can exceed 8) and a separator.
+    size_t cap = (size_t)count * 12 + 2;
+    char *text = (char *)malloc(cap);
+    if (!text)
+        return -1;
+
+    size_t used = 0;
+    for (int i = 0; i < count && used < cap; i++)
+    {
+        const char *sep = (i % LIRC_TOKENS_PER_LINE == LIRC_TOKENS_PER_LINE - 1 || i == count - 1) ? "\n" : " ";
+        int n = snprintf(text + used, cap - used, "%c%u%s", i % 2 == 0 ? '+' : '-', samples[i], sep);
+        if (n < 0)
+            break;
+        used += (size_t)n;
+    }
+
+    if (used >= cap)
+    {
+        free(text);
+        return -1;
+    }
+
+    int rc = write_entire_file(path, text, used);
+    free(text);
+    return rc;
+}
+
+/*
+ * Reads mode2 samples until the receiver reports its timeout, LIRC_END_GAP_MS
+ * of silence follow the last sample, or the buffer is full. Leading spaces are
+ * skipped and the capture always ends with a space, like ir-ctl output.
+ */
+static ir_status_t lircdev_learn_raw(const char *out_raw_path)
+{
+    if (zv_is_empty(out_raw_path))
+    {
+        log_error("[IR][service]::lircdev_learn_raw Empty out path to learn the signal\n");
+        set_last_error("Empty out path to learn the signal");
+        return IR_ERR_INVALID;
+    }
+
+    char tmp_path[PATH_MAX];
+    if (snprintf(tmp_path, sizeof(tmp_path), "%s.tmp", out_raw_path) <= 0)
+    {
+        set_last_error("Invalid output path");
+        return IR_ERR_INVALID;
+    }
+
+    int fd = lirc_open_rx();
+    if (fd < 0)
+        return IR_ERR_IO;
+
+    uint32_t samples[LIRC_MAX_SAMPLES];
+    int count = 0;
+    bool done = false;
+    long long deadline = monotonic_ms() + context.timeout_ms;
+
+    while (!done)
+    {
+        if (learn_canceled())
+        {
+            close(fd);
+            set_last_error("Capture canceled");
+            log_debug("[IR][service]::lircdev_learn_raw learn canceled");
+            return IR_ERR_CANCELED;
+        }
+
+        long long now = monotonic_ms();
+        if (now >= deadline)
+            break;
+
+        int wait_ms = (int)(deadline - now);
+        if (count > 0 && wait_ms > LIRC_END_GAP_MS)
+            wait_ms = LIRC_END_GAP_MS;
+
+        struct pollfd pfd[2] = { { fd, POLLIN, 0 }, { learn.wake_fd, POLLIN, 0 } };
+        int ready = poll(pfd, learn.wake_fd >= 0 ? 2 : 1, wait_ms);
+        if (ready < 0 && errno == EINTR)
+            continue;
+
+        if (ready < 0 || (pfd[0].revents & (POLLERR | POLLHUP | POLLNVAL)))
+        {
+            close(fd);
+            set_last_error("IR receive failed");
+            log_error("[IR][service]::lircdev_learn_raw poll failed errno=%d(%s)", errno, strerror(errno));
+            return IR_ERR_IO;
+        }
+
+        if (!(pfd[0].revents & POLLIN))
+        {
+            if (ready == 0 && count > 0)
+            {
+                if (count % 2 == 1)
+                    samples[count++] = LIRC_END_GAP_MS * 1000;
+                done = true;
+            }
+            continue;
+        }
+
+        uint32_t chunk[64];
+        ssize_t n = read(fd, chunk, sizeof(chunk));
+        if (n < 0 && (errno == EAGAIN || errno == EINTR))
+            continue;
+
+        if (n <= 0)
+        {
+            close(fd);
+            set_last_error("IR receive failed");
+            log_error("[IR][service]::lircdev_learn_raw read failed errno=%d(%s)", errno, strerror(errno));
+            return IR_ERR_IO;
+        }
+
+        for (size_t i = 0; i < (size_t)n / sizeof(uint32_t) && !done; i++)
+        {
+            uint32_t type = chunk[i] & LIRC_MODE2_MASK;
+            uint32_t value = LIRC_VALUE(chunk[i]);
+            bool is_pulse = type == LIRC_MODE2_PULSE;
+
+            if (type == LIRC_MODE2_TIMEOUT)
+            {
+                if (count == 0)
+                    continue;
+
+                // The receiver timeout is the gap after the last pulse.
+                if (count % 2 == 1)
+                    samples[count++] = value;
+                else
+                    samples[count - 1] += value;
+                done = true;
+                continue;
+            }
+
+            if (type != LIRC_MODE2_PULSE && type != LIRC_MODE2_SPACE)
+                continue;
+
+            if (count == 0 && !is_pulse)
+                continue;
+
+            if (count > 0 && (count % 2 == 1) == is_pulse)
+            {
+                samples[count - 1] += value;
+                continue;
+            }
+
+            samples[count++] = value;
+
+            // Leave room for the closing space.
+            if (count >= LIRC_MAX_SAMPLES - 1)
+            {
+                if (count % 2 == 1)
+                    samples[count++] = LIRC_END_GAP_MS * 1000;
+                done = true;
+            }
+        }
+    }
+
+    close(fd);
+
+    if (count == 0)
+    {
+        set_last_error("Learn timed out");
+        log_debug("[IR][service]::lircdev_learn_raw learn timeout after %dms", context.timeout_ms);
+        return IR_ERR_TIMEOUT;
+    }
+
+    if (count % 2 == 1)
+        samples[count++] = LIRC_END_GAP_MS * 1000;
+
+    if (lirc_write_capture(tmp_path, samples, count) != 0)
+    {
+        remove(tmp_path);
+        set_last_error("Failed to store raw file");
+        log_error("[IR][service]::lircdev_learn_raw write failed path=%s", tmp_path);
+        return IR_ERR_IO;
+    }
+
+    if (rename(tmp_path, out_raw_path) != 0)
+    {
+        remove(tmp_path);
+        set_last_error("Failed to store raw file");
+        log_error("learn rename failed src=%s dst=%s errno=%d(%s)",
+                 tmp_path, out_raw_path, errno, strerror(errno));
+        return IR_ERR_IO;
+    }
+
+    set_last_error(NULL);
+    log_debug("[IR][service]::lircdev_learn_raw learn stored samples=%d path=%s", count, out_raw_path);
+    return IR_OK;
+}
+
+void ir_learn_cancel(void)
+{
+    __atomic_store_n(&learn.canceled, true, __ATOMIC_RELEASE);
+
+    pid_t child = __atomic_load_n(&learn.child, __ATOMIC_ACQUIRE);
+    if (child > 0)
+        kill(-child, SIGTERM);
+
+    if (learn.wake_fd >= 0)
+    {
+        uint64_t one = 1;
+        ssize_t n = write(learn.wake_fd, &one, sizeof(one));
+        (void)n;
+    }
+}
+
+void ir_learn_reset(void)
+{
+    if (learn.wake_fd < 0)
+        learn.wake_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+
+    uint64_t pending;
+    if (learn.wake_fd >= 0)
+        while (read(learn.wake_fd, &pending, sizeof(pending)) > 0)
+            ;
+
+    __atomic_store_n(&learn.canceled, false, __ATOMIC_RELEASE);
+}
+
 ir_status_t ir_learn_raw (const char *out_raw_path) 
 {
+    if (learn_canceled())
+    {
+        set_last_error("Capture canceled");
+        return IR_ERR_CANCELED;
+    }
+
     if (context.backend == NULL)
     {
         log_error("[IR][service]::ir_learn_raw backend is null\n");
@@ -200,9 +768,7 @@ ir_status_t ir_learn_raw (const char *out_raw_path)
     }
     else if (strcmp(context.backend, BACKEND_TYPE_LIRC) == 0) 
     {
-        log_error("[IR][service]::ir_learn_raw lircdev backend not implemented yet\n");
-        set_last_error("lircdev backend not implemented yet");
-        return IR_ERR_UNSUPPORTED;
+        return lircdev_learn_raw(out_raw_path);
     } 
     else 
     {
@@ -225,9 +791,7 @@ ir_status_t ir_send_raw(const char *raw_path)
         return irctl_send_raw(raw_path);
     }
     else if (strcmp(context.backend, BACKEND_TYPE_LIRC) == 0) {
-        log_error("[IR][service::ir_send_raw lircdev backend not implemented yet\n");
-        set_last_error("lircdev backend not implemented yet");
-        return IR_ERR_UNSUPPORTED;
+        return lircdev_send_raw(raw_path);
     } 
     else 
     {
@@ -237,6 +801,235 @@ ir_status_t ir_send_raw(const char *raw_path)
     }
 }
 
+ir_status_t ir_send_signal(const ir_signal *signal, const char *raw_path)
+{
+    if (context.backend == NULL)
+    {
+        log_error("[IR][service]::ir_send_signal backend is null\n");
+        set_last_error("[ir_send_signal]:: backend is null");
+        return IR_ERR_INVALID;
+    }
+
+    // ir-ctl only reads files; only lircdev can send straight from memory.
+    if (signal && strcmp(context.backend, BACKEND_TYPE_LIRC) == 0)
+        return lircdev_send_signal(signal);
+
+    return ir_send_raw(raw_path);
+}
+
+static void timespec_add_us(struct timespec *ts, uint64_t us)
+{
+    ts->tv_sec += (time_t)(us / 1000000);
+    ts->tv_nsec += (long)(us % 1000000) * 1000;
+    if (ts->tv_nsec >= 1000000000L)
+    {
+        ts->tv_sec++;
+        ts->tv_nsec -= 1000000000L;
+    }
+}
+
+static long long timespec_diff_us(const struct timespec *a, const struct timespec *b)
+{
+    return (long long)(a->tv_sec - b->tv_sec) * 1000000 + (a->tv_nsec - b->tv_nsec) / 1000;
+}
+
+ir_status_t ir_send_frames(const ir_frame *frames, int count, const bool *cancel, int *max_late_us)
+{
+    if (max_late_us)
+        *max_late_us = 0;
+
+    if (!frames || count <= 0)
+        return IR_ERR_INVALID;
+
+    // ir-ctl is a process per send, there is no timing to keep.
+    if (context.backend == NULL || strcmp(context.backend, BACKEND_TYPE_LIRC) != 0)
+    {
+        set_last_error("Timed sends need the lircdev backend");
+        return IR_ERR_UNSUPPORTED;
+    }
+
+    ir_status_t status = lirc_open_tx();
+    if (status != IR_OK)
+        return status;
+
+    struct timespec start;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+
+    for (int i = 0; i < count; i++)
+    {
+        const ir_frame *frame = &frames[i];
+        if (cancel && __atomic_load_n(cancel, __ATOMIC_ACQUIRE))
+        {
+            set_last_error("Canceled");
+            return IR_ERR_CANCELED;
+        }
+
+        if (frame->count <= 0 || frame->count % 2 == 0)
+        {
+            set_last_error("Invalid raw signal");
+            return IR_ERR_INVALID;
+        }
+
+        // Absolute deadlines: time spent writing or waking up late is not added to the next frame.
+        struct timespec deadline = start;
+        timespec_add_us(&deadline, frame->at_us);
+        while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, NULL) == EINTR)
+            ;
+
+        struct timespec now;
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        long long late = timespec_diff_us(&now, &deadline);
+        if (max_late_us && late > *max_late_us)
+            *max_late_us = (int)late;
+
+        lirc_apply_modulation(frame->carrier ? frame->carrier : (uint32_t)context.carrier_hz,
+                              frame->duty_cycle ? frame->duty_cycle : (uint32_t)context.duty_cycle);
+
+        status = lirc_write_frame(frame->durations, frame->count);
+        if (status != IR_OK)
+            return status;
+    }
+
+    set_last_error(NULL);
+    log_debug("[IR][service]::ir_send_frames sent %d frames max_late_us=%d", count, max_late_us ? *max_late_us : -1);
+    return IR_OK;
+}
+
+void ir_monitor_reset(void)
+{
+    if (monitor.wake_fd < 0)
+        monitor.wake_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+
+    uint64_t pending;
+    if (monitor.wake_fd >= 0)
+        while (read(monitor.wake_fd, &pending, sizeof(pending)) > 0)
+            ;
+
+    __atomic_store_n(&monitor.stopped, false, __ATOMIC_RELEASE);
+}
+
+void ir_monitor_stop(void)
+{
+    __atomic_store_n(&monitor.stopped, true, __ATOMIC_RELEASE);
+
+    if (monitor.wake_fd >= 0)
+    {
+        uint64_t one = 1;
+        ssize_t n = write(monitor.wake_fd, &one, sizeof(one));
+        (void)n;
+    }
+}
+
+ir_status_t ir_monitor_run(ir_monitor_cb cb, void *user_data)
+{
+    if (!cb)
+        return IR_ERR_INVALID;
+
+    // ir-ctl has no streaming mode we could read without a process per frame.
+    if (context.backend == NULL || strcmp(context.backend, BACKEND_TYPE_LIRC) != 0)
+    {
+        set_last_error("The monitor needs the lircdev backend");
+        return IR_ERR_UNSUPPORTED;
+    }
+
+    int fd = lirc_open_rx();
+    if (fd < 0)
+        return IR_ERR_IO;
+
+    uint32_t samples[LIRC_MAX_SAMPLES];
+    int count = 0;
+    ir_status_t status = IR_OK;
+
+    log_debug("[IR][service]::ir_monitor_run listening rx_dev=%s", context.rx_dev);
+    while (!__atomic_load_n(&monitor.stopped, __ATOMIC_ACQUIRE))
+    {
+        // A frame in progress is closed by silence when the driver sends no timeout.
+        struct pollfd pfd[2] = { { fd, POLLIN, 0 }, { monitor.wake_fd, POLLIN, 0 } };
+        int ready = poll(pfd, monitor.wake_fd >= 0 ? 2 : 1, count > 0 ? LIRC_END_GAP_MS : -1);
+        if (ready < 0 && errno == EINTR)
+            continue;
+
+        if (ready < 0 || (pfd[0].revents & (POLLERR | POLLHUP | POLLNVAL)))
+        {
+            set_last_error("IR receive failed");
+            log_error("[IR][service]::ir_monitor_run poll failed errno=%d(%s)", errno, strerror(errno));
+            status = IR_ERR_IO;
+            break;
+        }
+
+        if (ready == 0)
+        {
+            // Frames handed to `cb` end on a pulse; a trailing space is part of the gap.
+            if (count % 2 == 0)
+                count--;
+            cb(samples, count, LIRC_END_GAP_MS * 1000, user_data);
+            count = 0;
+            continue;
+        }
+
+        if (!(pfd[0].revents & POLLIN))
+            continue;
+
+        uint32_t chunk[64];
+        ssize_t n = read(fd, chunk, sizeof(chunk));
+        if (n < 0 && (errno == EAGAIN || errno == EINTR))
+            continue;
+
+        if (n <= 0)
+        {
+            set_last_error("IR receive failed");
+            log_error("[IR][service]::ir_monitor_run read failed errno=%d(%s)", errno, strerror(errno));
+            status = IR_ERR_IO;
+            break;
+        }
+
+        for (size_t i = 0; i < (size_t)n / sizeof(uint32_t); i++)
+        {
+            uint32_t type = chunk[i] & LIRC_MODE2_MASK;
+            uint32_t value = LIRC_VALUE(chunk[i]);
+
+            if (type == LIRC_MODE2_PULSE)
+            {
+                if (count % 2 == 1)
+                    samples[count - 1] += value;
+                else
+                    samples[count++] = value;
+
+                // A pulse train longer than the buffer is cut into frames.
+                if (count >= LIRC_MAX_SAMPLES - 2)
+                {
+                    cb(samples, count, 0, user_data);
+                    count = 0;
+                }
+                continue;
+            }
+
+            if ((type != LIRC_MODE2_SPACE && type != LIRC_MODE2_TIMEOUT) || count == 0)
+                continue;
+
+            // Back-to-back spaces are one space: an even `count` means the last sample
+            // is a space, so it is taken back and merged before deciding on the gap.
+            uint32_t space = value;
+            if (count % 2 == 0)
+                space += samples[--count];
+
+            if (type == LIRC_MODE2_TIMEOUT || space >= MONITOR_FRAME_GAP_US)
+            {
+                cb(samples, count, space, user_data);
+                count = 0;
+            }
+            else
+            {
+                samples[count++] = space;
+            }
+        }
+    }
+
+    close(fd);
+    log_debug("[IR][service]::ir_monitor_run stopped status=%d", (int)status);
+    return status;
+}
+
 ir_status_t ir_service_init(const ir_context *ctx)
 {
     if (!ctx) 
@@ -246,6 +1039,8 @@ ir_status_t ir_service_init(const ir_context *ctx)
         return IR_ERR_CONFIG;
     }
 
+    lirc_close_tx();
+    ir_learn_reset();
     memset(&context, 0, sizeof(ir_context));
     set_last_error(NULL);
 
@@ -257,6 +1052,8 @@ ir_status_t ir_service_init(const ir_context *ctx)
 
     context.timeout_ms = ctx->timeout_ms > 0 ? ctx->timeout_ms : IR_DEFAULT_TIMEOUT_MS;
     context.backend = (ctx->backend && ctx->backend[0]) ? ctx->backend : BACKEND_TYPE_IRCTL;
+    context.carrier_hz = ctx->carrier_hz > 0 ? ctx->carrier_hz : IR_DEFAULT_CARRIER_HZ;
+    context.duty_cycle = (ctx->duty_cycle > 0 && ctx->duty_cycle < 100) ? ctx->duty_cycle : IR_DEFAULT_DUTY_CYCLE;
 
     log_debug("[IR][service]::ir_service_init backend=%s tx=%s, rx=%s, timeout_ms=%d",
              context.backend ? context.backend : BACKEND_TYPE_IRCTL,
@@ -265,6 +1062,19 @@ ir_status_t ir_service_init(const ir_context *ctx)
     return IR_OK;
 }
 
+void ir_service_deinit(void)
+{
+    lirc_close_tx();
+
+    if (learn.wake_fd >= 0)
+        close(learn.wake_fd);
+    learn.wake_fd = -1;
+
+    if (monitor.wake_fd >= 0)
+        close(monitor.wake_fd);
+    monitor.wake_fd = -1;
+}
+
 static void collect_raw_item(const file_desc *desc, void *obj_target)
 {
     ir_callback_event *event = (ir_callback_event *)obj_target;
@@ -275,7 +1085,7 @@ static void collect_raw_item(const file_desc *desc, void *obj_target)
     if (!desc->is_file)
         return;
 
-    if (!file_has_extension(desc->file_name, ".raw"))
+    if (!ir_signal_is_file_name(desc->file_name))
         return;
 
     event->cb(desc, event->data);
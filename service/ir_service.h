@@ -1,8 +1,11 @@
 #ifndef IR_SERVICE_H
 #define IR_SERVICE_H
 
+#include <stdbool.h>
 #include <stddef.h>
+#include <stdint.h>
 #include "utils/file.h"
+#include "service/ir_signal.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -22,7 +25,8 @@ typedef enum {
     IR_ERR_IO           = -2,
     IR_ERR_TIMEOUT      = -3,
     IR_ERR_INVALID      = -4,
-    IR_ERR_UNSUPPORTED  = -5
+    IR_ERR_UNSUPPORTED  = -5,
+    IR_ERR_CANCELED     = -6
 } ir_status_t;
 
 typedef struct {
@@ -30,6 +34,8 @@ typedef struct {
     char rx_dev[MAX_IR_DEV_PATH];   // The reciever /dev path
     int timeout_ms;                 // The timeout to wait when is listening hte signal
     const char *backend;            // How to implement the comunnication with the system, by default "BACKEND_TYPE_IRCTL"
+    int carrier_hz;                 // lircdev: carrier used when the .raw file has no "carrier" line
+    int duty_cycle;                 // lircdev: carrier duty cycle in percent
 } ir_context;
 
 typedef void (*ir_raw_cb)(const file_desc *desc, void *user);
@@ -39,9 +45,55 @@ typedef struct {
 }ir_callback_event;
 
 ir_status_t ir_service_init(const ir_context *ctx);
+void ir_service_deinit(void);
 ir_status_t ir_learn_raw (const char *out_raw_path);
+
+/*
+ * Safe to call from any thread. Aborts the ir_learn_raw() in progress and
+ * makes later calls return IR_ERR_CANCELED until ir_learn_reset().
+ */
+void ir_learn_cancel(void);
+void ir_learn_reset(void);
 ir_status_t ir_send_raw(const char *raw_path);
 
+// Sends an already parsed signal; backends that need a file use `raw_path`.
+ir_status_t ir_send_signal(const ir_signal *signal, const char *raw_path);
+
+// One frame of a prepared sequence, sent `at_us` after the sequence starts.
+typedef struct {
+    const uint32_t *durations;  // odd count, ends on a pulse
+    int count;
+    uint32_t carrier;           // 0 for ir.carrier_hz
+    uint8_t duty_cycle;         // 0 for ir.duty_cycle
+    uint64_t at_us;
+} ir_frame;
+
+/*
+ * lircdev only. Sends `frames` on the calling thread, sleeping until each
+ * deadline on CLOCK_MONOTONIC, so late wake-ups don't push the following
+ * frames. Checks `cancel` before every frame; `max_late_us` gets the worst
+ * wake-up delay. Nothing else may send while this runs.
+ */
+ir_status_t ir_send_frames(const ir_frame *frames, int count, const bool *cancel, int *max_late_us);
+
+/*
+ * Called once per received frame: `durations` ends on a pulse and is only
+ * valid during the call. `gap_us` is the silence that closed the frame, 0
+ * when it was cut because the buffer filled up.
+ */
+typedef void (*ir_monitor_cb)(const uint32_t *durations, int count, uint32_t gap_us, void *user_data);
+
+/*
+ * lircdev only. Keeps rx_dev open and splits the mode2 stream into frames
+ * until ir_monitor_stop(). Blocks the calling thread; `cb` runs on it and
+ * must return quickly or the driver's buffer overflows.
+ */
+ir_status_t ir_monitor_run(ir_monitor_cb cb, void *user_data);
+
+// Safe to call from any thread. Makes ir_monitor_run() return, now or once it starts.
+void ir_monitor_stop(void);
+void ir_monitor_reset(void);
+
 ir_status_t ir_list_raw_files_cb(const char *dir, ir_callback_event *event);
 
 #ifdef __cplusplus
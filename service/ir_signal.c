@@ -0,0 +1,389 @@
+#include "service/ir_signal.h"
+#include "service/ir_protocol.h"
+#include "utils/file.h"
+
+#include <ctype.h>
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define IR_SIGNAL_VALUE_MAX 0x00FFFFFF  // what a LIRC mode2 sample can hold
+
+/*
+ * Binary container (.irb), all integers little-endian:
+ *
+ *   0  magic "ZVIR"          16 address u32
+ *   4  version u8            20 duration count u32
+ *   5  encoding u8           24 payload length u32
+ *   6  header size u16       28 command u32
+ *   8  carrier Hz u32        32 payload
+ *  12  duty cycle u8            crc32 u32 over header + payload
+ *  13  repeats u8
+ *  14  protocol u16
+ *
+ * IRB_ENCODING_DELTA stores each duration as a zigzag varint of its
+ * difference with the previous duration of the same kind. Repeated bit
+ * timings then take one byte each, against 5-6 chars in ir-ctl text.
+ *
+ * A decoded signal (protocol != 0) has no payload: count and payload
+ * length are 0 and the timing is regenerated by ir_protocol_encode(), with
+ * the repeats byte as its repeat frame count.
+ */
+#define IRB_MAGIC           "ZVIR"
+#define IRB_VERSION         1
+#define IRB_HEADER_SIZE     32
+#define IRB_ENCODING_DELTA  1
+#define IRB_MAX_VARINT      5
+
+static bool append_duration(ir_signal *out, int *capacity, bool is_pulse, uint32_t value)
+{
+    // A leading space carries no information for the transmitter.
+    if (out->count == 0 && !is_pulse)
+        return true;
+
+    if (out->count > 0 && (out->count % 2 == 1) == is_pulse)
+    {
+        out->durations[out->count - 1] += value;
+        return true;
+    }
+
+    if (out->count == IR_SIGNAL_MAX_DURATIONS)
+        return false;
+
+    if (out->count == *capacity)
+    {
+        int new_capacity = *capacity ? *capacity * 2 : 128;
+        uint32_t *grown = (uint32_t *)realloc(out->durations, (size_t)new_capacity * sizeof(uint32_t));
+        if (!grown)
+            return false;
+
+        out->durations = grown;
+        *capacity = new_capacity;
+    }
+
+    out->durations[out->count++] = value;
+    return true;
+}
+
+int ir_signal_parse(const char *text, ir_signal *out)
+{
+    if (!text || !out)
+        return -1;
+
+    memset(out, 0, sizeof(*out));
+    int capacity = 0;
+
+    const char *p = text;
+    while (*p)
+    {
+        if (isspace((unsigned char)*p))
+        {
+            p++;
+            continue;
+        }
+
+        if (*p == '#')
+        {
+            p += strcspn(p, "\n");
+            continue;
+        }
+
+        int is_pulse = -1;
+        if (*p == '+' || *p == '-')
+        {
+            is_pulse = *p == '+';
+            p++;
+        }
+        else if (strncmp(p, "pulse", 5) == 0 || strncmp(p, "space", 5) == 0)
+        {
+            is_pulse = *p == 'p';
+            p += 5;
+        }
+        else if (strncmp(p, "carrier", 7) == 0)
+        {
+            p += 7;
+        }
+        else
+        {
+            ir_signal_free(out);
+            return -1;
+        }
+
+        char *end = NULL;
+        long value = strtol(p, &end, 10);
+        if (end == p || value <= 0 || value > IR_SIGNAL_VALUE_MAX)
+        {
+            ir_signal_free(out);
+            return -1;
+        }
+        p = end;
+
+        if (is_pulse < 0)
+        {
+            out->carrier = (uint32_t)value;
+            continue;
+        }
+
+        if (!append_duration(out, &capacity, is_pulse == 1, (uint32_t)value))
+        {
+            ir_signal_free(out);
+            return -1;
+        }
+    }
+
+    if (out->count == 0)
+    {
+        ir_signal_free(out);
+        return -1;
+    }
+
+    return 0;
+}
+
+void ir_signal_free(ir_signal *signal)
+{
+    if (!signal)
+        return;
+
+    free(signal->durations);
+    memset(signal, 0, sizeof(*signal));
+}
+
+static void put_le16(uint8_t *p, uint16_t v)
+{
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+}
+
+static void put_le32(uint8_t *p, uint32_t v)
+{
+    for (int i = 0; i < 4; i++)
+        p[i] = (uint8_t)(v >> (8 * i));
+}
+
+static uint16_t get_le16(const uint8_t *p)
+{
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static uint32_t get_le32(const uint8_t *p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static uint32_t crc32_update(uint32_t crc, const uint8_t *data, size_t len)
+{
+    crc = ~crc;
+    for (size_t i = 0; i < len; i++)
+    {
+        crc ^= data[i];
+        for (int bit = 0; bit < 8; bit++)
+            crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1u)));
+    }
+    return ~crc;
+}
+
+static bool is_binary(const uint8_t *data, size_t len)
+{
+    return len >= IRB_HEADER_SIZE && memcmp(data, IRB_MAGIC, 4) == 0;
+}
+
+static int parse_binary(const uint8_t *data, size_t len, ir_signal *out)
+{
+    memset(out, 0, sizeof(*out));
+
+    uint16_t header_size = get_le16(data + 6);
+    if (data[4] != IRB_VERSION || data[5] != IRB_ENCODING_DELTA || header_size < IRB_HEADER_SIZE)
+        return -1;
+
+    uint32_t count = get_le32(data + 20);
+    uint32_t payload_len = get_le32(data + 24);
+    uint16_t protocol = get_le16(data + 14);
+    if ((count == 0 && protocol == IR_PROTO_NONE) || count > IR_SIGNAL_MAX_DURATIONS ||
+        (size_t)header_size + payload_len + 4 > len)
+        return -1;
+
+    size_t body_len = (size_t)header_size + payload_len;
+    if (crc32_update(0, data, body_len) != get_le32(data + body_len))
+        return -1;
+
+    if (count == 0)
+    {
+        ir_decoded code = { protocol, get_le32(data + 16), get_le32(data + 28) };
+        // The repeat frames are generated here; `repeats` stays 0 for the sender.
+        if (ir_protocol_encode(&code, data[13], out) != 0)
+            return -1;
+
+        if (get_le32(data + 8))
+            out->carrier = get_le32(data + 8);
+        out->duty_cycle = data[12];
+        return 0;
+    }
+
+    out->durations = (uint32_t *)malloc(count * sizeof(uint32_t));
+    if (!out->durations)
+        return -1;
+
+    const uint8_t *p = data + header_size;
+    const uint8_t *end = p + payload_len;
+    int64_t prev[2] = {0, 0};
+    for (uint32_t i = 0; i < count; i++)
+    {
+        uint64_t zz = 0;
+        int shift = 0;
+        for (;;)
+        {
+            if (p == end || shift >= 7 * IRB_MAX_VARINT)
+            {
+                ir_signal_free(out);
+                return -1;
+            }
+
+            uint8_t byte = *p++;
+            zz |= (uint64_t)(byte & 0x7F) << shift;
+            shift += 7;
+            if (!(byte & 0x80))
+                break;
+        }
+
+        int64_t value = prev[i % 2] + (int64_t)((zz >> 1) ^ (0 - (zz & 1)));
+        if (value <= 0 || value > IR_SIGNAL_VALUE_MAX)
+        {
+            ir_signal_free(out);
+            return -1;
+        }
+
+        out->durations[i] = (uint32_t)value;
+        prev[i % 2] = value;
+    }
+
+    out->count = (int)count;
+    out->carrier = get_le32(data + 8);
+    out->duty_cycle = data[12];
+    out->repeats = data[13];
+    out->protocol = protocol;
+    out->address = get_le32(data + 16);
+    out->command = get_le32(data + 28);
+    return 0;
+}
+
+int ir_signal_load(const char *raw_path, ir_signal *out)
+{
+    long sz = 0;
+    char *buf = read_file_as_buffer(raw_path, &sz);
+    if (!buf || sz <= 0 || !out)
+    {
+        free(buf);
+        return -1;
+    }
+
+    int rc;
+    if (is_binary((const uint8_t *)buf, (size_t)sz))
+        rc = parse_binary((const uint8_t *)buf, (size_t)sz, out);
+    else
+        rc = ir_signal_parse(buf, out);
+
+    free(buf);
+    return rc;
+}
+
+int ir_signal_save_binary(const char *path, const ir_signal *signal)
+{
+    if (!path || !signal || signal->count > IR_SIGNAL_MAX_DURATIONS ||
+        (signal->count <= 0 && signal->protocol == IR_PROTO_NONE))
+        return -1;
+
+    int count = signal->protocol == IR_PROTO_NONE ? signal->count : 0;
+    size_t cap = IRB_HEADER_SIZE + (size_t)count * IRB_MAX_VARINT + 4;
+    uint8_t *buf = (uint8_t *)calloc(1, cap);
+    if (!buf)
+        return -1;
+
+    uint8_t *p = buf + IRB_HEADER_SIZE;
+    int64_t prev[2] = {0, 0};
+    for (int i = 0; i < count; i++)
+    {
+        int64_t delta = (int64_t)signal->durations[i] - prev[i % 2];
+        uint64_t zz = ((uint64_t)delta << 1) ^ (uint64_t)(delta >> 63);
+        prev[i % 2] = signal->durations[i];
+
+        do {
+            uint8_t byte = zz & 0x7F;
+            zz >>= 7;
+            *p++ = zz ? (uint8_t)(byte | 0x80) : byte;
+        } while (zz);
+    }
+
+    uint32_t payload_len = (uint32_t)(p - (buf + IRB_HEADER_SIZE));
+    memcpy(buf, IRB_MAGIC, 4);
+    buf[4] = IRB_VERSION;
+    buf[5] = IRB_ENCODING_DELTA;
+    put_le16(buf + 6, IRB_HEADER_SIZE);
+    put_le32(buf + 8, signal->carrier);
+    buf[12] = signal->duty_cycle;
+    buf[13] = signal->repeats;
+    put_le16(buf + 14, signal->protocol);
+    put_le32(buf + 16, signal->address);
+    put_le32(buf + 20, (uint32_t)count);
+    put_le32(buf + 24, payload_len);
+    put_le32(buf + 28, signal->command);
+
+    size_t body_len = IRB_HEADER_SIZE + payload_len;
+    put_le32(buf + body_len, crc32_update(0, buf, body_len));
+
+    char tmp_path[PATH_MAX];
+    int rc = -1;
+    if (snprintf(tmp_path, sizeof(tmp_path), "%s.tmp", path) < (int)sizeof(tmp_path) &&
+        write_entire_file(tmp_path, (const char *)buf, body_len + 4) == 0)
+    {
+        rc = rename(tmp_path, path);
+        if (rc != 0)
+            remove(tmp_path);
+    }
+
+    free(buf);
+    return rc;
+}
+
+char *ir_signal_to_text(const ir_signal *signal, size_t *len_out)
+{
+    if (!signal || signal->count <= 0)
+        return NULL;
+
+    // "carrier N\n" plus up to "-4294967295 " per duration; merged gaps go past 8 digits.
+    int total = signal->count % 2 == 0 ? signal->count * (1 + signal->repeats) : signal->count;
+    size_t cap = 32 + (size_t)total * 12;
+    char *text = (char *)malloc(cap);
+    if (!text)
+        return NULL;
+
+    size_t used = 0;
+    if (signal->carrier)
+        used += (size_t)snprintf(text, cap, "carrier %u\n", signal->carrier);
+
+    for (int i = 0; i < total && used < cap; i++)
+    {
+        const char *sep = (i % 6 == 5 || i == total - 1) ? "\n" : " ";
+        int n = snprintf(text + used, cap - used, "%c%u%s",
+                         i % 2 == 0 ? '+' : '-', signal->durations[i % signal->count], sep);
+        if (n < 0)
+            break;
+        used += (size_t)n;
+    }
+
+    if (used >= cap)
+    {
+        free(text);
+        return NULL;
+    }
+
+    if (len_out)
+        *len_out = used;
+    return text;
+}
+
+bool ir_signal_is_file_name(const char *name)
+{
+    return file_has_extension(name, IR_SIGNAL_EXT_RAW) || file_has_extension(name, IR_SIGNAL_EXT_BIN);
+}
@@ -0,0 +1,62 @@
+#ifndef IR_SIGNAL_H
+#define IR_SIGNAL_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define IR_SIGNAL_MAX_DURATIONS 1024
+
+#define IR_SIGNAL_EXT_RAW       ".raw"      // ir-ctl text
+#define IR_SIGNAL_EXT_BIN       ".irb"      // binary container, see ir_signal.c
+
+/*
+ * A signal as alternating pulse/space durations in microseconds, pulse
+ * first. Consecutive values of the same kind are merged and leading spaces
+ * dropped, so durations[i] is a pulse for even i and a space for odd i.
+ */
+typedef struct {
+    uint32_t *durations;
+    int count;
+    uint32_t carrier;       // from a "carrier N" line, 0 when the file has none
+    uint8_t duty_cycle;     // percent, 0 when unknown
+    uint8_t repeats;        // extra times `durations` is sent; it then ends in the frame gap
+    uint16_t protocol;      // ir_protocol_id, 0 when the signal was not decoded
+    uint32_t address;       // address/command only meaningful when `protocol` is set
+    uint32_t command;
+} ir_signal;
+
+/*
+ * Parses the ir-ctl text format: "+N"/"-N" or "pulse N"/"space N" tokens,
+ * '#' comments and an optional "carrier N" line. Returns 0 on success; `out`
+ * then owns a heap buffer released with ir_signal_free().
+ */
+int ir_signal_parse(const char *text, ir_signal *out);
+
+/*
+ * Reads either format; binary files are recognised by their magic, not the
+ * extension. Decoded .irb files are expanded back to durations here.
+ */
+int ir_signal_load(const char *raw_path, ir_signal *out);
+void ir_signal_free(ir_signal *signal);
+
+/*
+ * Writes the binary container through a .tmp file and rename(). A signal
+ * with `protocol` set is stored as its header only.
+ */
+int ir_signal_save_binary(const char *path, const ir_signal *signal);
+
+// ir-ctl text for `signal` with the repeats written out, heap allocated and NUL-terminated.
+char *ir_signal_to_text(const ir_signal *signal, size_t *len_out);
+
+bool ir_signal_is_file_name(const char *name);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* IR_SIGNAL_H */
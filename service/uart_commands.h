@@ -8,6 +8,10 @@
 #define BT_COMMAND_RES_SCAN_DONE   "SCAN:DONE"
 #define BT_COMMAND_RES_SCAN_DEVICE "SCAN:DEVICE"
 #define BT_COMMAND_RES_SCAN_UPDATE "SCAN:UPDATE"
+#define BT_COMMAND_REQ_SCAN_ADV    "SCAN:ADV"
+#define BT_COMMAND_RES_SCAN_ADV    "SCAN:ADV"
+#define BT_COMMAND_REQ_SCAN_CONT   "SCAN:CONT"
+#define BT_COMMAND_REQ_SCAN_STOP   "SCAN:STOP"
 
 //-- CONNECT -- //
 #define BT_COMMAND_REQ_CONNECT          "CONNECT"
@@ -29,4 +33,36 @@
 #define BT_COMMAND_RES_DISCOVER_DONE    "DISCOVER:DONE"
 #define BT_COMMAND_RES_DISCOVER_FAIL    "DISCOVER:FAIL"
 
+//-- GATT -- //
+#define BT_COMMAND_RES_GATT_SERVICE_CHANGED "GATT:SERVICE_CHANGED"
+
+#define BT_COMMAND_REQ_GATT_READ            "GATT:READ"
+#define BT_COMMAND_RES_GATT_READ_OK         "GATT:READ:OK"
+#define BT_COMMAND_RES_GATT_READ_FAIL       "GATT:READ:FAIL"
+#define BT_COMMAND_REQ_GATT_WRITE           "GATT:WRITE"
+#define BT_COMMAND_RES_GATT_WRITE_OK        "GATT:WRITE:OK"
+#define BT_COMMAND_RES_GATT_WRITE_FAIL      "GATT:WRITE:FAIL"
+#define BT_COMMAND_REQ_GATT_SUBSCRIBE       "GATT:SUBSCRIBE"
+#define BT_COMMAND_RES_GATT_SUBSCRIBE_OK    "GATT:SUBSCRIBE:OK"
+#define BT_COMMAND_RES_GATT_SUBSCRIBE_FAIL  "GATT:SUBSCRIBE:FAIL"
+#define BT_COMMAND_RES_GATT_NOTIFY          "GATT:NOTIFY"
+
+//-- LINK -- //
+#define BT_COMMAND_REQ_LINK_MTU         "LINK:MTU"
+#define BT_COMMAND_RES_LINK_MTU_OK      "LINK:MTU:OK"
+#define BT_COMMAND_RES_LINK_MTU_FAIL    "LINK:MTU:FAIL"
+#define BT_COMMAND_REQ_LINK_DLE         "LINK:DLE"
+#define BT_COMMAND_RES_LINK_DLE_OK      "LINK:DLE:OK"
+#define BT_COMMAND_RES_LINK_DLE_FAIL    "LINK:DLE:FAIL"
+#define BT_COMMAND_REQ_LINK_PARAMS      "LINK:PARAMS"
+#define BT_COMMAND_RES_LINK_PARAMS_OK   "LINK:PARAMS:OK"
+#define BT_COMMAND_RES_LINK_PARAMS_FAIL "LINK:PARAMS:FAIL"
+
+//-- THROUGHPUT TEST -- //
+#define BT_COMMAND_REQ_TPUT_START       "TPUT:START"
+#define BT_COMMAND_REQ_TPUT_STOP        "TPUT:STOP"
+#define BT_COMMAND_RES_TPUT_PROGRESS    "TPUT:PROGRESS"
+#define BT_COMMAND_RES_TPUT_DONE        "TPUT:DONE"
+#define BT_COMMAND_RES_TPUT_FAIL        "TPUT:FAIL"
+
 #endif /* UART_COMMANDS_H */
\ No newline at end of file
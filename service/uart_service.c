@@ -5,6 +5,7 @@
 
 #include <errno.h>
 #include <fcntl.h>
+#include <sys/ioctl.h>
 #include <string.h>
 #include <termios.h>
 #include <unistd.h>
@@ -16,7 +17,7 @@
 // File descriptor that represent the open connection throught UART
 static int uart_fd = -1;
 
-static char uart_rx_accum[512];
+static char uart_rx_accum[UART_LINE_MAX];
 static size_t uart_rx_len = 0;
 
 // Internal container to keep track of any "service/object" that want to be notify
@@ -349,6 +350,7 @@ uart_status_t uart_poll_line(char *buffer, size_t buffer_size)
                     break;
             }
             set_last_error("UART line too long, discarded");
+            log_warning("[UART][service] line longer than %d bytes discarded", UART_LINE_MAX - 1);
             return UART_ERR_IO;
         }
     }
@@ -356,7 +358,7 @@ uart_status_t uart_poll_line(char *buffer, size_t buffer_size)
 
 void uart_process_loop()
 {
-    char line[512];
+    char line[UART_LINE_MAX];
     if (uart_poll_line(line, sizeof(line)) == UART_OK) 
     {
         for (int index = 0; index < events_count; index++)
@@ -368,6 +370,23 @@ void uart_process_loop()
     }
 }
 
+/*
+ * Bytes received but not dispatched yet: what the kernel still holds plus the
+ * partial line in the accumulator. Only one line is dispatched per main loop
+ * iteration, so this grows when the ESP32 talks faster than we consume.
+ */
+size_t uart_rx_pending(void)
+{
+    if (uart_fd < 0)
+        return 0;
+
+    int queued = 0;
+    if (ioctl(uart_fd, FIONREAD, &queued) != 0 || queued < 0)
+        queued = 0;
+
+    return (size_t)queued + uart_rx_len;
+}
+
 void uart_service_close(void)
 {
     if (uart_fd >= 0)
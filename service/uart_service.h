@@ -7,6 +7,13 @@ extern "C" {
 
 #include <stddef.h>
 
+/*
+ * Longest line taken from the ESP32, terminator included. A notification
+ * with a full 512-byte attribute value (MTU 517) is 1024 hex chars plus its
+ * `GATT:...|conn=|handle=|value=` header; longer lines are discarded.
+ */
+#define UART_LINE_MAX 1152
+
 typedef enum {
     UART_OK = 0,
     UART_ERR_CONFIG = -1,
@@ -23,6 +30,7 @@ uart_status_t uart_send_formatted_line(const char *message, ...);
 uart_status_t uart_poll_line(char *buffer, size_t buffer_size);
 void add_event_callback(uart_event_cb new_cb, const char *tag_id);
 void uart_process_loop();
+size_t uart_rx_pending(void);
 void uart_service_close(void);
 
 #ifdef __cplusplus
@@ -0,0 +1,213 @@
+/*
+ * zv-ir-convert: converts IR signal libraries between ir-ctl text (.raw) and
+ * the binary container (.irb) described in service/ir_signal.c.
+ *
+ *   bin/zv-ir-convert [-r] [-d] [-k] [-n] <file|dir>...
+ *
+ *   -r  .irb -> .raw (default is .raw -> .irb)
+ *   -d  store signals of a known protocol as decoded, header-only .irb
+ *   -k  keep the source file
+ *   -n  dry run, only print what would change
+ *
+ * Directories are walked recursively. Every converted file is loaded back
+ * and compared before the source is removed.
+ */
+#include "service/ir_protocol.h"
+#include "service/ir_signal.h"
+#include "utils/file.h"
+
+#include <limits.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+static struct {
+    bool to_raw;
+    bool decode;
+    bool keep;
+    bool dry_run;
+
+    int converted;
+    int failed;
+    long long bytes_in;
+    long long bytes_out;
+} opts;
+
+static long long file_size(const char *path)
+{
+    struct stat st;
+    return stat(path, &st) == 0 ? (long long)st.st_size : 0;
+}
+
+// .raw has no repeat count: the frame is written out once per repeat.
+static int sent_count(const ir_signal *s)
+{
+    return s->count % 2 == 0 ? s->count * (1 + s->repeats) : s->count;
+}
+
+static bool same_signal(const ir_signal *a, const ir_signal *b)
+{
+    // Decoded signals are regenerated on load: same code, sent as many times.
+    if (a->protocol != IR_PROTO_NONE && b->protocol != IR_PROTO_NONE)
+        return a->protocol == b->protocol && a->address == b->address && a->command == b->command &&
+               ir_protocol_frame_count(a) == ir_protocol_frame_count(b);
+
+    int total = sent_count(a);
+    if (a->carrier != b->carrier || total != sent_count(b))
+        return false;
+
+    for (int i = 0; i < total; i++)
+    {
+        if (a->durations[i % a->count] != b->durations[i % b->count])
+            return false;
+    }
+
+    return true;
+}
+
+static int write_target(const char *dst, const ir_signal *signal)
+{
+    if (!opts.to_raw)
+        return ir_signal_save_binary(dst, signal);
+
+    size_t len = 0;
+    char *text = ir_signal_to_text(signal, &len);
+    if (!text)
+        return -1;
+
+    int rc = write_entire_file(dst, text, len);
+    free(text);
+    return rc;
+}
+
+static void convert_file(const char *src)
+{
+    const char *from = opts.to_raw ? IR_SIGNAL_EXT_BIN : IR_SIGNAL_EXT_RAW;
+    const char *to = opts.to_raw ? IR_SIGNAL_EXT_RAW : IR_SIGNAL_EXT_BIN;
+
+    char dst[PATH_MAX];
+    size_t base_len = strlen(src) - strlen(from);
+    if (snprintf(dst, sizeof(dst), "%.*s%s", (int)base_len, src, to) >= (int)sizeof(dst))
+    {
+        fprintf(stderr, "skip %s: path too long\n", src);
+        opts.failed++;
+        return;
+    }
+
+    ir_signal signal;
+    if (ir_signal_load(src, &signal) != 0)
+    {
+        fprintf(stderr, "skip %s: not a valid signal\n", src);
+        opts.failed++;
+        return;
+    }
+
+    // `stored` is what goes to disk; `signal` keeps the durations to compare against.
+    ir_signal stored = signal;
+    ir_decoded code;
+    int repeats = 0;
+    if (opts.decode && !opts.to_raw && ir_protocol_decode_signal(&signal, &code, &repeats))
+    {
+        signal.protocol = stored.protocol = code.protocol;
+        signal.address = stored.address = code.address;
+        signal.command = stored.command = code.command;
+        stored.repeats = (uint8_t)repeats;
+    }
+
+    if (opts.dry_run)
+    {
+        printf("%s -> %s%s%s\n", src, dst,
+               signal.protocol ? " " : "", signal.protocol ? ir_protocol_name(signal.protocol) : "");
+        ir_signal_free(&signal);
+        opts.converted++;
+        return;
+    }
+
+    ir_signal check;
+    bool ok = write_target(dst, &stored) == 0 && ir_signal_load(dst, &check) == 0;
+    if (ok)
+    {
+        ok = same_signal(&signal, &check);
+        ir_signal_free(&check);
+    }
+
+    if (!ok)
+    {
+        fprintf(stderr, "fail %s: round trip mismatch\n", src);
+        remove(dst);
+        ir_signal_free(&signal);
+        opts.failed++;
+        return;
+    }
+
+    long long in = file_size(src);
+    long long out = file_size(dst);
+    opts.bytes_in += in;
+    opts.bytes_out += out;
+    opts.converted++;
+    printf("%s -> %s (%lld -> %lld bytes)%s%s\n", src, dst, in, out,
+           signal.protocol ? " " : "", signal.protocol ? ir_protocol_name(signal.protocol) : "");
+
+    if (!opts.keep)
+        remove(src);
+
+    ir_signal_free(&signal);
+}
+
+static void convert_path(const char *path);
+
+static void visit_entry(const file_desc *desc, void *obj_target)
+{
+    (void)obj_target;
+
+    if (desc->is_dir || file_has_extension(desc->file_name, opts.to_raw ? IR_SIGNAL_EXT_BIN : IR_SIGNAL_EXT_RAW))
+        convert_path(desc->file_path);
+}
+
+static void convert_path(const char *path)
+{
+    if (file_is_directory(path))
+    {
+        get_file_list(path, visit_entry, NULL);
+        return;
+    }
+
+    if (file_has_extension(path, opts.to_raw ? IR_SIGNAL_EXT_BIN : IR_SIGNAL_EXT_RAW))
+        convert_file(path);
+}
+
+int main(int argc, char **argv)
+{
+    int opt;
+    while ((opt = getopt(argc, argv, "rdkn")) != -1)
+    {
+        switch (opt)
+        {
+            case 'r': opts.to_raw = true;  break;
+            case 'd': opts.decode = true;  break;
+            case 'k': opts.keep = true;    break;
+            case 'n': opts.dry_run = true; break;
+            default:
+                fprintf(stderr, "usage: %s [-r] [-d] [-k] [-n] <file|dir>...\n", argv[0]);
+                return 2;
+        }
+    }
+
+    if (optind == argc)
+    {
+        fprintf(stderr, "usage: %s [-r] [-d] [-k] [-n] <file|dir>...\n", argv[0]);
+        return 2;
+    }
+
+    for (int i = optind; i < argc; i++)
+        convert_path(argv[i]);
+
+    printf("%d converted, %d failed", opts.converted, opts.failed);
+    if (opts.bytes_in > 0)
+        printf(", %lld -> %lld bytes", opts.bytes_in, opts.bytes_out);
+    printf("\n");
+
+    return opts.failed ? 1 : 0;
+}
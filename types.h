@@ -1,14 +1,21 @@
 #ifndef TYPES_H
 #define TYPES_H
+
+#include <stdint.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
 #define UNKNOWN_NAME "Unknown"
-#define BT_ALLOWED_MAX_DEVICES 20
-#define BT_MAX_SERVICES 20
-#define BT_MAX_CHARS_PER_SERVICE 16
+#define BT_ALLOWED_MAX_DEVICES 512  // fixed slots: stored devices and the search index are addressed by slot
 #define BT_UUID_STR_LEN 37
+#define BT_ADV_MAX_LEN 31   // legacy advertising / scan response payload
+
+// Binary UUID, big-endian as written. 16/32-bit UUIDs are expanded over the SIG base.
+typedef struct {
+    uint8_t bytes[16];
+} bt_uuid_t;
 
 typedef struct {
     char name[32];
@@ -19,20 +26,52 @@ typedef struct {
     char service[32];
     int connectable;
     int addr_type;
+
+    // Raw AD structures as received with SCAN:ADV; decoded on demand (bt_ad_decoder.h).
+    uint8_t adv_data[BT_ADV_MAX_LEN];
+    uint8_t adv_len;
+    uint8_t scan_rsp[BT_ADV_MAX_LEN];
+    uint8_t scan_rsp_len;
 } device_t;
 
-typedef struct {
+/*
+ * GATT attribute tree. Nodes live in the arena of bt_gatt_db (see
+ * page/bt/bt_gatt_db.h) and are linked in discovery order, so they stay valid
+ * until the database is reset on disconnect.
+ */
+typedef struct bt_descriptor_t {
+    char uuid[BT_UUID_STR_LEN];
+    bt_uuid_t uuid_key;
+    unsigned int handle;
+    struct bt_characteristic_t *characteristic;
+    struct bt_descriptor_t *next;
+} bt_descriptor_t;
+
+typedef struct bt_characteristic_t {
     int char_index;
     char uuid[BT_UUID_STR_LEN];
+    bt_uuid_t uuid_key;
     unsigned int props;
     unsigned int handle;
+    bt_descriptor_t *descs;
+    bt_descriptor_t *descs_tail;
+    int descs_count;
+    struct bt_value_ring_t *values;     // created on the first read or notification
+    bool subscribed;
+    struct bt_service_t *service;
+    struct bt_characteristic_t *next;
 } bt_characteristic_t;
 
-typedef struct {
+typedef struct bt_service_t {
     int svc_index;
     char uuid[BT_UUID_STR_LEN];
-    bt_characteristic_t chars[BT_MAX_CHARS_PER_SERVICE];
+    bt_uuid_t uuid_key;
+    unsigned int start_handle;
+    unsigned int end_handle;
+    bt_characteristic_t *chars;
+    bt_characteristic_t *chars_tail;
     int chars_count;
+    struct bt_service_t *next;
 } bt_service_t;
 
 typedef enum {
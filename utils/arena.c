@@ -0,0 +1,89 @@
+#include "arena.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#define ARENA_DEFAULT_BLOCK_SIZE 4096
+#define ARENA_ALIGN 8
+
+struct zv_arena_block {
+    zv_arena_block *next;
+    size_t capacity;
+    size_t offset;
+    // payload follows the header
+};
+
+static size_t align_up(size_t value)
+{
+    return (value + (ARENA_ALIGN - 1)) & ~(size_t)(ARENA_ALIGN - 1);
+}
+
+static zv_arena_block *new_block(size_t capacity)
+{
+    zv_arena_block *block = (zv_arena_block *)malloc(align_up(sizeof(zv_arena_block)) + capacity);
+    if (!block)
+        return NULL;
+
+    block->next = NULL;
+    block->capacity = capacity;
+    block->offset = 0;
+    return block;
+}
+
+void zv_arena_init(zv_arena *arena, size_t block_size)
+{
+    if (!arena)
+        return;
+
+    memset(arena, 0, sizeof(*arena));
+    arena->block_size = block_size > 0 ? block_size : ARENA_DEFAULT_BLOCK_SIZE;
+}
+
+void *zv_arena_alloc(zv_arena *arena, size_t size)
+{
+    if (!arena || size == 0)
+        return NULL;
+
+    if (arena->block_size == 0)
+        arena->block_size = ARENA_DEFAULT_BLOCK_SIZE;
+
+    size = align_up(size);
+
+    zv_arena_block *block = arena->head;
+    if (!block || block->offset + size > block->capacity)
+    {
+        // Oversized requests get a block of their own so they never waste a normal one.
+        size_t capacity = size > arena->block_size ? size : arena->block_size;
+        block = new_block(capacity);
+        if (!block)
+            return NULL;
+
+        block->next = arena->head;
+        arena->head = block;
+    }
+
+    unsigned char *payload = (unsigned char *)block + align_up(sizeof(zv_arena_block));
+    void *ptr = payload + block->offset;
+    block->offset += size;
+    arena->used_bytes += size;
+
+    memset(ptr, 0, size);
+    return ptr;
+}
+
+void zv_arena_reset(zv_arena *arena)
+{
+    if (!arena)
+        return;
+
+    zv_arena_block *block = arena->head;
+    while (block)
+    {
+        zv_arena_block *next = block->next;
+        free(block);
+        block = next;
+    }
+
+    arena->head = NULL;
+    arena->used_bytes = 0;
+}
@@ -0,0 +1,31 @@
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct zv_arena_block zv_arena_block;
+
+/*
+ * Bump allocator: memory is taken from big blocks and never freed one by one.
+ * zv_arena_reset() releases every block in one shot, which is what we want
+ * for data whose lifetime ends at a single point (e.g. a BLE disconnect).
+ */
+typedef struct {
+    zv_arena_block *head;
+    size_t block_size;
+    size_t used_bytes;
+} zv_arena;
+
+void zv_arena_init(zv_arena *arena, size_t block_size);
+void *zv_arena_alloc(zv_arena *arena, size_t size);
+void zv_arena_reset(zv_arena *arena);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ARENA_H */
@@ -3,8 +3,13 @@
 #define MAX_ERRORS          10
 #define MESSAGE_MAX_LENGTH  256
 
-static char errors[MAX_ERRORS][MESSAGE_MAX_LENGTH] = {0};
-static int current_index_error = 0;
+/*
+ * One ring per thread: the IR workers report through the same services as
+ * the UI, and each copies its own last_error() into its job result. A shared
+ * ring would let one thread read (or overwrite) another's message mid-write.
+ */
+static __thread char errors[MAX_ERRORS][MESSAGE_MAX_LENGTH] = {{0}};
+static __thread int current_index_error = 0;
 
 void set_last_error(const char *msg)
 {
@@ -7,6 +7,7 @@
 extern "C" {
 #endif
 
+// Per thread: last_error() only sees what the calling thread set.
 const char *last_error(void);
 void set_last_error(const char *msg);
 void print_all_errors();
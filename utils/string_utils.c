@@ -99,3 +99,53 @@ int duplicate_string(const char *src, char **dst)
     *dst = copy;
     return 0;
 }
+
+static int hex_nibble(char c)
+{
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+/*
+ * Decodes "0201061AFF..." into bytes. Returns the number of bytes written,
+ * or -1 when the string has an odd length, a non-hex char or doesn't fit.
+ */
+int zv_hex_decode(const char *hex, unsigned char *out, size_t out_size)
+{
+    if (!hex || !out)
+        return -1;
+
+    size_t len = strlen(hex);
+    if (len % 2 != 0 || len / 2 > out_size)
+        return -1;
+
+    for (size_t i = 0; i < len; i += 2)
+    {
+        int hi = hex_nibble(hex[i]);
+        int lo = hex_nibble(hex[i + 1]);
+        if (hi < 0 || lo < 0)
+            return -1;
+
+        out[i / 2] = (unsigned char)((hi << 4) | lo);
+    }
+
+    return (int)(len / 2);
+}
+
+void zv_hex_encode(const unsigned char *data, size_t len, char *out, size_t out_size)
+{
+    static const char digits[] = "0123456789ABCDEF";
+
+    if (!out || out_size == 0)
+        return;
+
+    size_t j = 0;
+    for (size_t i = 0; data && i < len && j + 2 < out_size; i++)
+    {
+        out[j++] = digits[data[i] >> 4];
+        out[j++] = digits[data[i] & 0x0F];
+    }
+    out[j] = '\0';
+}
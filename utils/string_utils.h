@@ -15,6 +15,8 @@ bool zv_starts_with(const char *str, const char *prefix);
 void zv_trim_inplace(char *s);
 int zv_is_empty(const char *str);
 int duplicate_string(const char *src, char **dst); //replacement of strdup
+int zv_hex_decode(const char *hex, unsigned char *out, size_t out_size);
+void zv_hex_encode(const unsigned char *data, size_t len, char *out, size_t out_size);
 
 #ifdef __cplusplus
 }